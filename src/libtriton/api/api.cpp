@@ -307,6 +307,9 @@ namespace triton {
   void API::buildSemantics(triton::arch::Instruction& inst) {
     this->checkArchitecture();
 
+    /* The nodes built for the instruction and owned by nothing at the end are freed */
+    triton::__uint mark = this->markAstRegion();
+
     /* Stage 1 - Update the context memory */
     std::list<triton::arch::MemoryOperand>::iterator it1;
     for (it1 = inst.memoryAccess.begin(); it1 != inst.memoryAccess.end(); it1++) {
@@ -329,6 +332,9 @@ namespace triton {
 
     /* Stage 4 - Process the IR */
     this->arch.buildSemantics(inst);
+
+    /* Stage 5 - Free the intermediate nodes (constant folding inputs, dropped operands...) */
+    this->freeAstRegion(mark);
   }
 
 
@@ -366,18 +372,21 @@ namespace triton {
 
   void API::removeEngines(void) {
     if(this->isArchitectureValid()) {
+      /* The owners of the nodes go first, the collector frees what they release */
+      delete this->sym;
+      this->sym = nullptr;
+
+      delete this->symBackup;
+      this->symBackup = nullptr;
+
       delete this->astGarbageCollector;
       delete this->astRepresentation;
       delete this->solver;
-      delete this->sym;
-      delete this->symBackup;
       delete this->taint;
 
       this->astGarbageCollector = nullptr;
       this->astRepresentation   = nullptr;
       this->solver              = nullptr;
-      this->sym                 = nullptr;
-      this->symBackup           = nullptr;
       this->taint               = nullptr;
     }
   }
@@ -408,6 +417,19 @@ namespace triton {
   }
 
 
+  void API::retainAstNode(triton::ast::AbstractNode* node) {
+    if (this->astGarbageCollector)
+      this->astGarbageCollector->retainAstNode(node);
+  }
+
+
+  void API::releaseAstNode(triton::ast::AbstractNode* node) {
+    /* Owners may outlive the engines, the nodes are gone with the collector */
+    if (this->astGarbageCollector)
+      this->astGarbageCollector->releaseAstNode(node);
+  }
+
+
   void API::freeAllAstNodes(void) {
     this->checkAstGarbageCollector();
     this->astGarbageCollector->freeAllAstNodes();
@@ -420,6 +442,18 @@ namespace triton {
   }
 
 
+  triton::__uint API::markAstRegion(void) const {
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->markAstRegion();
+  }
+
+
+  void API::freeAstRegion(triton::__uint mark) {
+    this->checkAstGarbageCollector();
+    this->astGarbageCollector->freeAstRegion(mark);
+  }
+
+
   void API::extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const {
     this->checkAstGarbageCollector();
     this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, root);
@@ -438,12 +472,18 @@ namespace triton {
   }
 
 
-  const std::set<triton::ast::AbstractNode*>& API::getAllocatedAstNodes(void) const {
+  std::set<triton::ast::AbstractNode*> API::getAllocatedAstNodes(void) const {
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAllocatedAstNodes();
   }
 
 
+  triton::__uint API::getNumberOfAllocatedAstNodes(void) const {
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->getNumberOfAllocatedAstNodes();
+  }
+
+
   const std::map<std::string, triton::ast::AbstractNode*>& API::getAstVariableNodes(void) const {
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAstVariableNodes();
@@ -616,6 +656,60 @@ namespace triton {
   }
 
 
+  triton::engines::symbolic::SymbolicSlice API::getBackwardSlice(triton::__uint symExprId) const {
+    this->checkSymbolic();
+    return this->sym->getBackwardSlice(symExprId);
+  }
+
+
+  triton::engines::symbolic::SymbolicSlice API::getBackwardSlice(triton::ast::AbstractNode* node) const {
+    this->checkSymbolic();
+    return this->sym->getBackwardSlice(node);
+  }
+
+
+  std::vector<triton::engines::symbolic::SymbolicSlice> API::getPathConstraintsBackwardSlices(void) const {
+    this->checkSymbolic();
+    return this->sym->getPathConstraintsBackwardSlices();
+  }
+
+
+  triton::__uint API::collectSymbolicExpressions(const std::vector<triton::engines::symbolic::SymbolicExpression*>& roots) {
+    this->checkSymbolic();
+    return this->sym->collectSymbolicExpressions(roots);
+  }
+
+
+  bool API::isSymbolicGarbageCollectionNeeded(void) const {
+    this->checkSymbolic();
+    return this->sym->isSymbolicGarbageCollectionNeeded();
+  }
+
+
+  void API::setSymbolicGarbageCollectionThreshold(triton::__uint threshold) {
+    this->checkSymbolic();
+    this->sym->setSymbolicGarbageCollectionThreshold(threshold);
+  }
+
+
+  triton::__uint API::getSymbolicGarbageCollectionThreshold(void) const {
+    this->checkSymbolic();
+    return this->sym->getSymbolicGarbageCollectionThreshold();
+  }
+
+
+  void API::pinSymbolicExpression(triton::__uint symExprId) {
+    this->checkSymbolic();
+    this->sym->pinSymbolicExpression(symExprId);
+  }
+
+
+  void API::unpinSymbolicExpression(triton::__uint symExprId) {
+    this->checkSymbolic();
+    this->sym->unpinSymbolicExpression(symExprId);
+  }
+
+
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::OperandWrapper& dst, const std::string& comment) {
     this->checkSymbolic();
     switch (dst.getType()) {
@@ -778,12 +872,55 @@ namespace triton {
   }
 
 
+  triton::ast::AbstractNode* API::lookupAstDictionaries(triton::uint32 kind, triton::ast::AbstractNode* const* childs, triton::uint32 size, triton::uint64 params) {
+    this->checkSymbolic();
+    if (!this->sym->isOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES))
+      return nullptr;
+    return this->sym->lookupAstDictionaries(kind, childs, size, params);
+  }
+
+
+  triton::ast::AbstractNode* API::lookupAstDictionaries(triton::uint32 kind, const triton::uint512& value, triton::uint32 size) {
+    this->checkSymbolic();
+    if (!this->sym->isOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES))
+      return nullptr;
+    return this->sym->lookupAstDictionaries(kind, value, size);
+  }
+
+
+  triton::ast::AbstractNode* API::lookupAstDictionaries(triton::uint32 kind, const std::string& value) {
+    this->checkSymbolic();
+    if (!this->sym->isOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES))
+      return nullptr;
+    return this->sym->lookupAstDictionaries(kind, value);
+  }
+
+
+  void API::removeAstDictionaries(triton::ast::AbstractNode* node) {
+    /* Nodes are also freed while the symbolic engine is removed */
+    if (this->sym)
+      this->sym->removeAstDictionaries(node);
+  }
+
+
   std::map<std::string, triton::uint32> API::getAstDictionariesStats(void) {
     this->checkSymbolic();
     return this->sym->getAstDictionariesStats();
   }
 
 
+  void API::recordRewriteRule(const std::string& pattern, const std::string& replacement) {
+    this->checkSymbolic();
+    this->sym->recordRewriteRule(pattern, replacement);
+  }
+
+
+  triton::ast::AbstractNode* API::rewriteAst(triton::ast::AbstractNode* node) const {
+    this->checkSymbolic();
+    return this->sym->rewriteAst(node);
+  }
+
+
   triton::ast::AbstractNode* API::processSimplification(triton::ast::AbstractNode* node, bool z3) const {
     this->checkSymbolic();
     return this->sym->processSimplification(node, z3);
@@ -808,6 +945,12 @@ namespace triton {
   }
 
 
+  triton::engines::symbolic::SymbolicVariable* API::getSymbolicVariableFromOrigin(triton::engines::symbolic::symkind_e kind, triton::__uint kindValue) const {
+    this->checkSymbolic();
+    return this->sym->getSymbolicVariableFromOrigin(kind, kindValue);
+  }
+
+
   const std::vector<triton::engines::symbolic::PathConstraint>& API::getPathConstraints(void) const {
     this->checkSymbolic();
     return this->sym->getPathConstraints();
@@ -942,13 +1085,43 @@ namespace triton {
   }
 
 
-  const std::map<triton::__uint, triton::engines::symbolic::SymbolicExpression*>& API::getSymbolicExpressions(void) const {
+  const triton::engines::symbolic::IdTable<triton::engines::symbolic::SymbolicExpression*>& API::getSymbolicExpressions(void) const {
     this->checkSymbolic();
     return this->sym->getSymbolicExpressions();
   }
 
 
-  const std::map<triton::__uint, triton::engines::symbolic::SymbolicVariable*>& API::getSymbolicVariables(void) const {
+  triton::ast::AstStats API::getAstStats(triton::ast::AbstractNode* node) const {
+    this->checkSymbolic();
+    return triton::ast::getAstStats(node, true);
+  }
+
+
+  triton::ast::AstStats API::getAstStats(void) const {
+    this->checkSymbolic();
+    return this->sym->getAstStats();
+  }
+
+
+  std::vector<triton::engines::symbolic::SymbolicExpression*> API::getLargestSymbolicExpressions(triton::uint32 n) const {
+    this->checkSymbolic();
+    return this->sym->getLargestSymbolicExpressions(n);
+  }
+
+
+  void API::saveSymbolicState(const std::string& filename) const {
+    this->checkSymbolic();
+    this->sym->saveSymbolicState(filename);
+  }
+
+
+  void API::loadSymbolicState(const std::string& filename) {
+    this->checkSymbolic();
+    this->sym->loadSymbolicState(filename);
+  }
+
+
+  const triton::engines::symbolic::IdTable<triton::engines::symbolic::SymbolicVariable*>& API::getSymbolicVariables(void) const {
     this->checkSymbolic();
     return this->sym->getSymbolicVariables();
   }
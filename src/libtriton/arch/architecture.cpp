@@ -201,19 +201,11 @@ namespace triton {
        * is enable we must compute semanitcs to spread the taint.
        */
       if (!triton::api.isSymbolicEngineEnabled()) {
-        std::set<triton::ast::AbstractNode*> uniqueNodes;
         std::vector<triton::engines::symbolic::SymbolicExpression*>::iterator it;
-        for (it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
-          triton::api.extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
+        for (it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++)
           triton::api.removeSymbolicExpression((*it)->getId());
-        }
-
-        if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
-          /* Remove node only if AST_DICTIONARIES is disabled */
-          triton::api.freeAstNodes(uniqueNodes);
-        }
 
-        inst.symbolicExpressions.clear();
+        inst.setSymbolicExpressions(std::vector<triton::engines::symbolic::SymbolicExpression*>());
         triton::api.restoreSymbolicEngine();
       }
 
@@ -223,24 +215,17 @@ namespace triton {
        * expressions untainted and their AST nodes.
        */
       if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ONLY_ON_TAINTED)) {
-        std::set<triton::ast::AbstractNode*> uniqueNodes;
         std::vector<triton::engines::symbolic::SymbolicExpression*> newVector;
         std::vector<triton::engines::symbolic::SymbolicExpression*>::iterator it;
         for (it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
           if ((*it)->isTainted == triton::engines::taint::UNTAINTED) {
-            triton::api.extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
             triton::api.removeSymbolicExpression((*it)->getId());
           }
           else
             newVector.push_back(*it);
         }
 
-        if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
-          /* Remove node only if AST_DICTIONARIES is disabled */
-          triton::api.freeAstNodes(uniqueNodes);
-        }
-
-        inst.symbolicExpressions = newVector;
+        inst.setSymbolicExpressions(newVector);
       }
 
       /*
@@ -249,26 +234,28 @@ namespace triton {
        * concrete expressions and their AST nodes.
        */
       if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ONLY_ON_SYMBOLIZED)) {
-        std::set<triton::ast::AbstractNode*> uniqueNodes;
         std::vector<triton::engines::symbolic::SymbolicExpression*> newVector;
         std::vector<triton::engines::symbolic::SymbolicExpression*>::iterator it;
         for (it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
           if ((*it)->getAst()->isSymbolized() == false) {
-            triton::api.extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
             triton::api.removeSymbolicExpression((*it)->getId());
           }
           else
             newVector.push_back(*it);
         }
 
-        if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES)) {
-          /* Remove node only if AST_DICTIONARIES is disabled */
-          triton::api.freeAstNodes(uniqueNodes);
-        }
-
-        inst.symbolicExpressions = newVector;
+        inst.setSymbolicExpressions(newVector);
       }
 
+      /*
+       * If the garbage collection of the symbolic expressions is enabled and
+       * enough expressions have been created, we delete the expressions which
+       * cannot be reached from the symbolic state anymore. The expressions of
+       * the instruction are kept for the user.
+       */
+      if (triton::api.isSymbolicEngineEnabled() && triton::api.isSymbolicGarbageCollectionNeeded())
+        triton::api.collectSymbolicExpressions(inst.symbolicExpressions);
+
     }
 
 
@@ -17,6 +17,38 @@
 namespace triton {
   namespace arch {
 
+    //! Adds an owner to the nodes of an access set.
+    template <typename T>
+    static void retainAccess(const std::set<std::pair<T, triton::ast::AbstractNode*>>& access) {
+      for (auto it = access.begin(); it != access.end(); it++)
+        triton::api.retainAstNode(it->second);
+    }
+
+
+    //! Removes an owner from the nodes of an access set and clears the set.
+    template <typename T>
+    static void releaseAccess(std::set<std::pair<T, triton::ast::AbstractNode*>>& access) {
+      for (auto it = access.begin(); it != access.end(); it++)
+        triton::api.releaseAstNode(it->second);
+      access.clear();
+    }
+
+
+    //! Adds an owner to symbolic expressions.
+    static void retainExpressions(const std::vector<triton::engines::symbolic::SymbolicExpression*>& exprs) {
+      for (auto it = exprs.begin(); it != exprs.end(); it++)
+        triton::engines::symbolic::retainIdTableEntry(*it);
+    }
+
+
+    //! Removes an owner from symbolic expressions and clears the vector.
+    static void releaseExpressions(std::vector<triton::engines::symbolic::SymbolicExpression*>& exprs) {
+      for (auto it = exprs.begin(); it != exprs.end(); it++)
+        triton::engines::symbolic::releaseIdTableEntry(*it);
+      exprs.clear();
+    }
+
+
     Instruction::Instruction() {
       this->address         = 0;
       this->branch          = false;
@@ -31,6 +63,12 @@ namespace triton {
 
 
     Instruction::~Instruction() {
+      releaseAccess(this->loadAccess);
+      releaseAccess(this->readImmediates);
+      releaseAccess(this->readRegisters);
+      releaseAccess(this->storeAccess);
+      releaseAccess(this->writtenRegisters);
+      releaseExpressions(this->symbolicExpressions);
     }
 
 
@@ -45,6 +83,13 @@ namespace triton {
 
 
     void Instruction::copy(const Instruction& other) {
+      if (this == &other)
+        return;
+
+      releaseAccess(this->loadAccess);
+      releaseAccess(this->storeAccess);
+      releaseExpressions(this->symbolicExpressions);
+
       this->address             = other.address;
       this->branch              = other.branch;
       this->conditionTaken      = other.conditionTaken;
@@ -64,6 +109,10 @@ namespace triton {
 
       this->disassembly.clear();
       this->disassembly.str(other.disassembly.str());
+
+      retainAccess(this->loadAccess);
+      retainAccess(this->storeAccess);
+      retainExpressions(this->symbolicExpressions);
     }
 
 
@@ -184,27 +233,32 @@ namespace triton {
 
 
     void Instruction::setLoadAccess(const triton::arch::MemoryOperand& mem, triton::ast::AbstractNode* node) {
-      this->loadAccess.insert(std::make_pair(mem, node));
+      if (this->loadAccess.insert(std::make_pair(mem, node)).second)
+        triton::api.retainAstNode(node);
     }
 
 
     void Instruction::setStoreAccess(const triton::arch::MemoryOperand& mem, triton::ast::AbstractNode* node) {
-      this->storeAccess.insert(std::make_pair(mem, node));
+      if (this->storeAccess.insert(std::make_pair(mem, node)).second)
+        triton::api.retainAstNode(node);
     }
 
 
     void Instruction::setReadRegister(const triton::arch::RegisterOperand& reg, triton::ast::AbstractNode* node) {
-      this->readRegisters.insert(std::make_pair(reg, node));
+      if (this->readRegisters.insert(std::make_pair(reg, node)).second)
+        triton::api.retainAstNode(node);
     }
 
 
     void Instruction::setWrittenRegister(const triton::arch::RegisterOperand& reg, triton::ast::AbstractNode* node) {
-      this->writtenRegisters.insert(std::make_pair(reg, node));
+      if (this->writtenRegisters.insert(std::make_pair(reg, node)).second)
+        triton::api.retainAstNode(node);
     }
 
 
     void Instruction::setReadImmediate(const triton::arch::ImmediateOperand& imm, triton::ast::AbstractNode* node) {
-      this->readImmediates.insert(std::make_pair(imm, node));
+      if (this->readImmediates.insert(std::make_pair(imm, node)).second)
+        triton::api.retainAstNode(node);
     }
 
 
@@ -239,10 +293,21 @@ namespace triton {
     void Instruction::addSymbolicExpression(triton::engines::symbolic::SymbolicExpression* expr) {
       if (expr == nullptr)
         throw std::runtime_error("Instruction::addSymbolicExpression(): Cannot add a null expression.");
+      expr->setAddress(this->address);
+      triton::engines::symbolic::retainIdTableEntry(expr);
       this->symbolicExpressions.push_back(expr);
     }
 
 
+    void Instruction::setSymbolicExpressions(const std::vector<triton::engines::symbolic::SymbolicExpression*>& exprs) {
+      /* The new ones are retained first, they may be kept from the current ones */
+      std::vector<triton::engines::symbolic::SymbolicExpression*> kept = exprs;
+      retainExpressions(kept);
+      releaseExpressions(this->symbolicExpressions);
+      this->symbolicExpressions = kept;
+    }
+
+
     bool Instruction::isBranch(void) const {
       return this->branch;
     }
@@ -306,7 +371,7 @@ namespace triton {
 
     void Instruction::preIRInit(void) {
       /* Clear previous expressions if exist */
-      this->symbolicExpressions.clear();
+      releaseExpressions(this->symbolicExpressions);
     }
 
 
@@ -334,13 +399,14 @@ namespace triton {
       this->type            = 0;
 
       this->disassembly.clear();
-      this->loadAccess.clear();
       this->operands.clear();
-      this->readImmediates.clear();
-      this->readRegisters.clear();
-      this->storeAccess.clear();
-      this->symbolicExpressions.clear();
-      this->writtenRegisters.clear();
+      releaseExpressions(this->symbolicExpressions);
+
+      releaseAccess(this->loadAccess);
+      releaseAccess(this->readImmediates);
+      releaseAccess(this->readRegisters);
+      releaseAccess(this->storeAccess);
+      releaseAccess(this->writtenRegisters);
 
       std::memset(this->opcodes, 0x00, sizeof(this->opcodes));
     }
@@ -46,11 +46,13 @@ namespace triton {
 
 
     MemoryOperand::MemoryOperand(const MemoryOperand& other) {
+      this->ast = nullptr;
       this->copy(other);
     }
 
 
     MemoryOperand::~MemoryOperand() {
+      triton::api.releaseAstNode(this->ast);
     }
 
 
@@ -77,6 +79,8 @@ namespace triton {
     void MemoryOperand::initAddress(void) {
       /* Otherwise, try to compute the address */
       if (triton::api.isArchitectureValid() && this->getBitSize() >= BYTE_SIZE_BIT) {
+        triton::ast::AbstractNode* leaAst = nullptr;
+
         RegisterOperand& base         = this->baseReg;
         RegisterOperand& index        = this->indexReg;
         RegisterOperand& segment      = this->segmentReg;
@@ -89,28 +93,33 @@ namespace triton {
         triton::uint32 bitSize        = (index.isValid() ? index.getBitSize() : base.isValid() ? base.getBitSize() : segment.isValid() ? segment.getBitSize() : triton::api.cpuRegisterBitSize());
 
         /* Initialize the AST of the memory access (LEA) */
-        this->ast = triton::ast::bvadd(
-                      (this->pcRelative ? triton::ast::bv(this->pcRelative, bitSize) : (base.isValid() ? triton::api.buildSymbolicRegisterOperand(base) : triton::ast::bv(0, bitSize))),
-                      triton::ast::bvadd(
-                        triton::ast::bvmul(
-                          (index.isValid() ? triton::api.buildSymbolicRegisterOperand(index) : triton::ast::bv(0, bitSize)),
-                          triton::ast::bv(scaleValue, bitSize)
-                        ),
-                        triton::ast::bv(dispValue, bitSize)
-                      )
-                    );
+        leaAst = triton::ast::bvadd(
+                   (this->pcRelative ? triton::ast::bv(this->pcRelative, bitSize) : (base.isValid() ? triton::api.buildSymbolicRegisterOperand(base) : triton::ast::bv(0, bitSize))),
+                   triton::ast::bvadd(
+                     triton::ast::bvmul(
+                       (index.isValid() ? triton::api.buildSymbolicRegisterOperand(index) : triton::ast::bv(0, bitSize)),
+                       triton::ast::bv(scaleValue, bitSize)
+                     ),
+                     triton::ast::bv(dispValue, bitSize)
+                   )
+                 );
 
         /*
          * If the symbolic emulation is enabled, use segments as
          * base address instead of selector into the GDT.
          */
         if (triton::api.isSymbolicEmulationEnabled()) {
-          this->ast = triton::ast::bvadd(
-                        triton::ast::bv(segmentValue, bitSize),
-                        this->ast
-                      );
+          leaAst = triton::ast::bvadd(
+                     triton::ast::bv(segmentValue, bitSize),
+                     leaAst
+                   );
         }
 
+        /* The operand owns its AST, it survives the free of the nodes of the instruction */
+        triton::api.retainAstNode(leaAst);
+        triton::api.releaseAstNode(this->ast);
+        this->ast = leaAst;
+
         /* Initialize the address only if it is not already defined */
         if (!this->address) {
           /* LEA computation */
@@ -268,6 +277,9 @@ namespace triton {
 
 
     void MemoryOperand::copy(const MemoryOperand& other) {
+      triton::api.retainAstNode(other.ast);
+      triton::api.releaseAstNode(this->ast);
+
       this->address       = other.address;
       this->ast           = other.ast;
       this->baseReg       = other.baseReg;
@@ -6,6 +6,7 @@
 */
 
 #include <cmath>
+#include <initializer_list>
 
 #include <api.hpp>
 #include <ast.hpp>
@@ -17,38 +18,470 @@
 namespace triton {
   namespace ast {
 
+    /* ====== Width-specialized evaluation */
+
+    /*
+     * Nodes are evaluated in the narrowest native domain able to hold
+     * their bits: uint64 up to 64 bits, uint128 up to 128 bits and uint512
+     * beyond. An operation is written once as `Op<T>::run(node, size)` and
+     * AbstractNode::evaluateIn() picks the domain.
+     */
+
+    //! Returns the bit-vector mask of `size` bits in the T domain.
+    template <typename T> static inline T bitvectorMask(triton::uint32 size);
+
+    template <> inline triton::uint64 bitvectorMask<triton::uint64>(triton::uint32 size) {
+      return (size >= 64) ? static_cast<triton::uint64>(-1) : ((static_cast<triton::uint64>(1) << size) - 1);
+    }
+
+    template <> inline triton::uint128 bitvectorMask<triton::uint128>(triton::uint32 size) {
+      triton::uint128 mask = -1;
+      return mask >> (128 - size);
+    }
+
+    template <> inline triton::uint512 bitvectorMask<triton::uint512>(triton::uint32 size) {
+      triton::uint512 mask = -1;
+      return mask >> (512 - size);
+    }
+
+
+    //! Returns the value of a node in the T domain.
+    template <typename T> static inline T nodeValue(const AbstractNode* node);
+
+    template <> inline triton::uint64 nodeValue<triton::uint64>(const AbstractNode* node) {
+      return node->evaluate64();
+    }
+
+    template <> inline triton::uint128 nodeValue<triton::uint128>(const AbstractNode* node) {
+      return node->evaluate128();
+    }
+
+    template <> inline triton::uint512 nodeValue<triton::uint512>(const AbstractNode* node) {
+      return node->evaluate();
+    }
+
+
+    //! Returns true if the MSB of a `size` bits value is set.
+    template <typename T> static inline bool isMsbSet(const T& value, triton::uint32 size) {
+      return ((value >> (size - 1)) & 1) != 0;
+    }
+
+
+    //! Returns the uint32 value of a shift amount, saturated to `size`.
+    template <typename T> static inline triton::uint32 shiftAmount(const T& value, triton::uint32 size) {
+      if (value >= size)
+        return size;
+      return static_cast<triton::uint32>(value);
+    }
+
+
+    //! Returns the sign-extended value of a node up to 64 bits.
+    static inline triton::sint64 signedValue64(const AbstractNode* node) {
+      triton::uint32 shift = 64 - node->getBitvectorSize();
+      return static_cast<triton::sint64>(node->evaluate64() << shift) >> shift;
+    }
+
+
+    template <typename T> struct BvaddOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return (nodeValue<T>(childs[0]) + nodeValue<T>(childs[1])) & bitvectorMask<T>(size);
+      }
+    };
+
+    template <typename T> struct BvandOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return nodeValue<T>(childs[0]) & nodeValue<T>(childs[1]);
+      }
+    };
+
+    template <typename T> struct BvashrOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        T value             = nodeValue<T>(childs[0]);
+        T mask              = bitvectorMask<T>(size);
+        triton::uint32 shift = shiftAmount<T>(nodeValue<T>(childs[1]), size);
+        bool sign           = isMsbSet<T>(value, size);
+
+        if (shift >= size)
+          return sign ? mask : T(0);
+
+        if (shift == 0)
+          return value;
+
+        value = value >> shift;
+        if (sign)
+          value = value | (mask & ~(mask >> shift));
+
+        return value;
+      }
+    };
+
+    template <typename T> struct BvlshrOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        triton::uint32 shift = shiftAmount<T>(nodeValue<T>(childs[1]), size);
+        if (shift >= size)
+          return 0;
+        return nodeValue<T>(childs[0]) >> shift;
+      }
+    };
+
+    template <typename T> struct BvmulOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return (nodeValue<T>(childs[0]) * nodeValue<T>(childs[1])) & bitvectorMask<T>(size);
+      }
+    };
+
+    template <typename T> struct BvnandOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return ~(nodeValue<T>(childs[0]) & nodeValue<T>(childs[1])) & bitvectorMask<T>(size);
+      }
+    };
+
+    template <typename T> struct BvnegOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return (T(0) - nodeValue<T>(childs[0])) & bitvectorMask<T>(size);
+      }
+    };
+
+    template <typename T> struct BvnorOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return ~(nodeValue<T>(childs[0]) | nodeValue<T>(childs[1])) & bitvectorMask<T>(size);
+      }
+    };
+
+    template <typename T> struct BvnotOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return ~nodeValue<T>(childs[0]) & bitvectorMask<T>(size);
+      }
+    };
+
+    template <typename T> struct BvorOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return nodeValue<T>(childs[0]) | nodeValue<T>(childs[1]);
+      }
+    };
+
+    template <typename T> struct BvrolOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        triton::uint32 rot = reinterpret_cast<DecimalNode*>(childs[0])->getValue().convert_to<triton::uint32>() % size;
+        T value            = nodeValue<T>(childs[1]);
+        if (rot == 0)
+          return value;
+        return ((value << rot) | (value >> (size - rot))) & bitvectorMask<T>(size);
+      }
+    };
+
+    template <typename T> struct BvrorOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        triton::uint32 rot = reinterpret_cast<DecimalNode*>(childs[0])->getValue().convert_to<triton::uint32>() % size;
+        T value            = nodeValue<T>(childs[1]);
+        if (rot == 0)
+          return value;
+        return ((value >> rot) | (value << (size - rot))) & bitvectorMask<T>(size);
+      }
+    };
+
+    /* Signed comparisons are unsigned comparisons with the sign bit of the operands flipped */
+    template <typename T> struct BvsgeOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        T sign = T(1) << (childs[0]->getBitvectorSize() - 1);
+        return (nodeValue<T>(childs[0]) ^ sign) >= (nodeValue<T>(childs[1]) ^ sign);
+      }
+    };
+
+    template <typename T> struct BvsgtOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        T sign = T(1) << (childs[0]->getBitvectorSize() - 1);
+        return (nodeValue<T>(childs[0]) ^ sign) > (nodeValue<T>(childs[1]) ^ sign);
+      }
+    };
+
+    template <typename T> struct BvsleOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        T sign = T(1) << (childs[0]->getBitvectorSize() - 1);
+        return (nodeValue<T>(childs[0]) ^ sign) <= (nodeValue<T>(childs[1]) ^ sign);
+      }
+    };
+
+    template <typename T> struct BvsltOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        T sign = T(1) << (childs[0]->getBitvectorSize() - 1);
+        return (nodeValue<T>(childs[0]) ^ sign) < (nodeValue<T>(childs[1]) ^ sign);
+      }
+    };
+
+    template <typename T> struct BvshlOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        triton::uint32 shift = shiftAmount<T>(nodeValue<T>(childs[1]), size);
+        if (shift >= size)
+          return 0;
+        return (nodeValue<T>(childs[0]) << shift) & bitvectorMask<T>(size);
+      }
+    };
+
+    template <typename T> struct BvsubOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return (nodeValue<T>(childs[0]) - nodeValue<T>(childs[1])) & bitvectorMask<T>(size);
+      }
+    };
+
+    template <typename T> struct BvudivOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        T divisor = nodeValue<T>(childs[1]);
+        if (divisor == 0)
+          return bitvectorMask<T>(size);
+        return nodeValue<T>(childs[0]) / divisor;
+      }
+    };
+
+    template <typename T> struct BvugeOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return nodeValue<T>(childs[0]) >= nodeValue<T>(childs[1]);
+      }
+    };
+
+    template <typename T> struct BvugtOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return nodeValue<T>(childs[0]) > nodeValue<T>(childs[1]);
+      }
+    };
+
+    template <typename T> struct BvuleOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return nodeValue<T>(childs[0]) <= nodeValue<T>(childs[1]);
+      }
+    };
+
+    template <typename T> struct BvultOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return nodeValue<T>(childs[0]) < nodeValue<T>(childs[1]);
+      }
+    };
+
+    template <typename T> struct BvuremOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        T divisor = nodeValue<T>(childs[1]);
+        if (divisor == 0)
+          return nodeValue<T>(childs[0]);
+        return nodeValue<T>(childs[0]) % divisor;
+      }
+    };
+
+    template <typename T> struct BvxnorOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return ~(nodeValue<T>(childs[0]) ^ nodeValue<T>(childs[1])) & bitvectorMask<T>(size);
+      }
+    };
+
+    template <typename T> struct BvxorOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return nodeValue<T>(childs[0]) ^ nodeValue<T>(childs[1]);
+      }
+    };
+
+    template <typename T> struct ConcatOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        T value = nodeValue<T>(childs[0]);
+        for (triton::uint32 index = 1; index < childs.size(); index++)
+          value = (value << childs[index]->getBitvectorSize()) | nodeValue<T>(childs[index]);
+        return value;
+      }
+    };
+
+    template <typename T> struct DistinctOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return nodeValue<T>(childs[0]) != nodeValue<T>(childs[1]);
+      }
+    };
+
+    template <typename T> struct EqualOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return nodeValue<T>(childs[0]) == nodeValue<T>(childs[1]);
+      }
+    };
+
+    template <typename T> struct ExtractOp {
+      static T run(AstChilds& childs, triton::uint32 size, triton::uint32 low) {
+        if (low >= childs[0]->getBitvectorSize())
+          return 0;
+        return (nodeValue<T>(childs[0]) >> low) & bitvectorMask<T>(size);
+      }
+    };
+
+    template <typename T> struct IteOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return childs[0]->evaluate64() ? nodeValue<T>(childs[1]) : nodeValue<T>(childs[2]);
+      }
+    };
+
+    template <typename T> struct SxOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        triton::uint32 childSize = childs[0]->getBitvectorSize();
+        T value                  = nodeValue<T>(childs[0]);
+        if (isMsbSet<T>(value, childSize))
+          value = value | ~bitvectorMask<T>(childSize);
+        return value & bitvectorMask<T>(size);
+      }
+    };
+
+    template <typename T> struct ZxOp {
+      static T run(AstChilds& childs, triton::uint32 size) {
+        return nodeValue<T>(childs[0]);
+      }
+    };
+
+
+    template <template <typename> class Op, typename... Args>
+    void AbstractNode::evaluateIn(triton::uint32 width, Args... args) {
+      if (width <= 64)
+        this->setEval(Op<triton::uint64>::run(this->childs, this->size, args...));
+
+      else if (width <= 128)
+        this->setEval(triton::uint512(Op<triton::uint128>::run(this->childs, this->size, args...)));
+
+      else
+        this->setEval(Op<triton::uint512>::run(this->childs, this->size, args...));
+    }
+
+
+    /* ====== Lazy evaluation */
+
+    /*
+     * A node does not re-evaluate its parents when it changes. It marks them as
+     * dirty (see AbstractNode::invalidate()) and a dirty node is re-evaluated
+     * the next time one of its attributes is read. Only the nodes which are
+     * read pay for the update and each one is evaluated once.
+     */
+
+    //! Returns the number of nodes the evaluation of `node` depends on.
+    static inline triton::uint32 dependencies(AbstractNode* node) {
+      if (node->getKind() == REFERENCE_NODE)
+        return 1;
+      return static_cast<triton::uint32>(node->getChilds().size());
+    }
+
+
+    //! Returns the index-th node the evaluation of `node` depends on, or nullptr.
+    static inline AbstractNode* dependency(AbstractNode* node, triton::uint32 index) {
+      if (node->getKind() == REFERENCE_NODE) {
+        triton::__uint id = reinterpret_cast<ReferenceNode*>(node)->getValue();
+        if (!triton::api.isSymbolicExpressionIdExists(id))
+          return nullptr;
+        return triton::api.getAstFromId(id);
+      }
+      return node->getChilds()[index];
+    }
+
+
+    /* ====== Structural hash */
+
+    /*
+     * Each node hashes its kind, its own data and the cached hashes of its
+     * childs once, when it is initialized. Hashing a tree is then O(1) and
+     * a shared sub-tree is hashed only once, whatever the number of paths
+     * leading to it.
+     */
+
+    //! Returns true if the order of the childs does not matter for the hash of the node.
+    static inline bool isCommutative(enum kind_e kind) {
+      switch (kind) {
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVMUL_NODE:
+        case BVNAND_NODE:
+        case BVNOR_NODE:
+        case BVOR_NODE:
+        case BVXNOR_NODE:
+        case BVXOR_NODE:
+        case DISTINCT_NODE:
+        case EQUAL_NODE:
+        case LAND_NODE:
+        case LOR_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
     /* ====== Abstract node */
 
     AbstractNode::AbstractNode(enum kind_e kind) {
-      this->eval        = 0;
-      this->kind        = kind;
-      this->size        = 0;
-      this->symbolized  = false;
+      this->allocSerial   = 0;
+      this->dirty         = false;
+      this->evalWide      = nullptr;
+      this->hashValue     = 0;
+      this->linked        = false;
+      this->nextAllocated = nullptr;
+      this->prevAllocated = nullptr;
+      this->references    = 0;
+      this->eval          = 0;
+      this->kind          = kind;
+      this->size          = 0;
+      this->symbolized    = false;
     }
 
 
     AbstractNode::AbstractNode() {
-      this->eval        = 0;
-      this->kind        = UNDEFINED_NODE;
-      this->size        = 0;
-      this->symbolized  = false;
+      this->allocSerial   = 0;
+      this->dirty         = false;
+      this->evalWide      = nullptr;
+      this->hashValue     = 0;
+      this->linked        = false;
+      this->nextAllocated = nullptr;
+      this->prevAllocated = nullptr;
+      this->references    = 0;
+      this->eval          = 0;
+      this->kind          = UNDEFINED_NODE;
+      this->size          = 0;
+      this->symbolized    = false;
     }
 
 
     AbstractNode::AbstractNode(const AbstractNode& copy) {
-      this->eval        = copy.eval;
-      this->kind        = copy.kind;
-      this->parents     = copy.parents;
-      this->size        = copy.size;
-      this->symbolized  = copy.symbolized;
+      this->allocSerial   = 0;
+      this->nextAllocated = nullptr;
+      this->prevAllocated = nullptr;
+      this->references    = 0;
+      this->eval          = copy.eval;
+      this->evalWide      = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty         = copy.dirty;
+      this->hashValue     = copy.hashValue;
+      this->kind          = copy.kind;
+      this->linked        = false;
+      this->size          = copy.size;
+      this->symbolized    = copy.symbolized;
 
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
     AbstractNode::~AbstractNode() {
-      /* virtual */
+      /*
+       * Nodes are usually freed by the garbage collector which already
+       * dropped the edges. A node deleted by hand (e.g. a duplicate
+       * rejected by the dictionaries) still owns its childs.
+       */
+      if (this->linked) {
+        for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+          this->childs[index]->removeParent(this);
+          this->childs[index]->references--;
+        }
+      }
+      delete this->evalWide;
+    }
+
+
+    void* AbstractNode::operator new(std::size_t size) {
+      return triton::ast::AstArena::instance().allocate(size);
+    }
+
+
+    void AbstractNode::operator delete(void* ptr, std::size_t size) {
+      triton::ast::AstArena::instance().release(ptr, size);
     }
 
 
@@ -58,62 +491,129 @@ namespace triton {
 
 
     triton::uint32 AbstractNode::getBitvectorSize(void) const {
+      if (this->dirty)
+        const_cast<AbstractNode*>(this)->refresh();
       return this->size;
     }
 
 
     triton::uint512 AbstractNode::getBitvectorMask(void) const {
       triton::uint512 mask = -1;
-      mask = mask >> (512 - this->size);
+      mask = mask >> (512 - this->getBitvectorSize());
       return mask;
     }
 
 
     bool AbstractNode::isSigned(void) const {
-      if ((this->eval >> (this->size-1)) & 1)
-        return true;
-      return false;
+      if (this->dirty)
+        const_cast<AbstractNode*>(this)->refresh();
+      if (this->evalWide)
+        return isMsbSet<triton::uint512>(*this->evalWide, this->size);
+      return isMsbSet<triton::uint64>(this->eval, this->size);
     }
 
 
     bool AbstractNode::isSymbolized(void) const {
+      if (this->dirty)
+        const_cast<AbstractNode*>(this)->refresh();
       return this->symbolized;
     }
 
 
     triton::uint512 AbstractNode::evaluate(void) const {
+      if (this->dirty)
+        const_cast<AbstractNode*>(this)->refresh();
+      if (this->evalWide)
+        return *this->evalWide;
       return this->eval;
     }
 
 
-    std::vector<AbstractNode*>& AbstractNode::getChilds(void) {
+    triton::uint64 AbstractNode::evaluate64(void) const {
+      if (this->dirty)
+        const_cast<AbstractNode*>(this)->refresh();
+      return this->eval;
+    }
+
+
+    triton::uint128 AbstractNode::evaluate128(void) const {
+      if (this->dirty)
+        const_cast<AbstractNode*>(this)->refresh();
+      if (this->evalWide)
+        return static_cast<triton::uint128>(*this->evalWide);
+      return this->eval;
+    }
+
+
+    void AbstractNode::setEval(triton::uint64 value) {
+      this->eval = value;
+      if (this->evalWide) {
+        delete this->evalWide;
+        this->evalWide = nullptr;
+      }
+    }
+
+
+    void AbstractNode::setEval(const triton::uint512& value) {
+      this->eval = static_cast<triton::uint64>(value);
+
+      if (this->size <= 64) {
+        if (this->evalWide) {
+          delete this->evalWide;
+          this->evalWide = nullptr;
+        }
+      }
+
+      else if (this->evalWide)
+        *this->evalWide = value;
+
+      else
+        this->evalWide = new triton::uint512(value);
+    }
+
+
+    void AbstractNode::setEval(const AbstractNode* node) {
+      if (node->evalWide)
+        this->setEval(*node->evalWide);
+      else
+        this->setEval(node->eval);
+    }
+
+
+    AstChilds& AbstractNode::getChilds(void) {
       return this->childs;
     }
 
 
-    std::set<AbstractNode*>& AbstractNode::getParents(void) {
+    AstParents& AbstractNode::getParents(void) {
       return this->parents;
     }
 
 
     void AbstractNode::setParent(AbstractNode* p) {
-      this->parents.insert(p);
+      this->parents.push_back(p);
     }
 
 
     void AbstractNode::removeParent(AbstractNode* p) {
-      this->parents.erase(p);
+      this->parents.removeOne(p);
     }
 
 
-    void AbstractNode::setParent(std::set<AbstractNode*>& p) {
-      for (std::set<AbstractNode*>::iterator it = p.begin(); it != p.end(); it++)
-        this->parents.insert(*it);
+    void AbstractNode::setParent(AstParents& p) {
+      for (AstParents::iterator it = p.begin(); it != p.end(); it++)
+        this->setParent(*it);
     }
 
 
     void AbstractNode::addChild(AbstractNode* child) {
       this->childs.push_back(child);
+
+      /* Childs added before the first init() are linked by initParents() */
+      if (this->linked) {
+        child->parents.push_back(this);
+        child->references++;
+      }
     }
 
 
@@ -124,14 +624,157 @@ namespace triton {
       if (child == nullptr)
         throw std::runtime_error("AbstractNode::setChild(): child cannot be null.");
 
-      /* Setup the parent of the child */
-      child->setParent(this);
-
-      /* Remove the parent of the old child */
-      this->childs[index]->removeParent(this);
+      /* The key of the node changes, so the node cannot be shared anymore */
+      triton::api.removeAstDictionaries(this);
+
+      /* Move the edge from the old child to the new one */
+      if (this->linked) {
+        AbstractNode* old = this->childs[index];
+        child->parents.push_back(this);
+        child->references++;
+        this->childs[index] = child;
+        old->removeParent(this);
+        triton::api.releaseAstNode(old);
+      }
 
       /* Setup the child of the parent */
-      this->childs[index] = child;
+      else
+        this->childs[index] = child;
+
+      /* This node and its ancestors must be re-evaluated */
+      this->invalidate();
+    }
+
+
+    void AbstractNode::invalidate(void) {
+      std::vector<AbstractNode*> worklist;
+
+      /*
+       * Ancestors of a dirty node are always dirty, so the walk
+       * stops as soon as it reaches an already dirty node.
+       */
+      worklist.push_back(this);
+      while (!worklist.empty()) {
+        AbstractNode* node = worklist.back();
+        worklist.pop_back();
+
+        if (node->dirty)
+          continue;
+
+        node->dirty = true;
+        for (AstParents::iterator it = node->parents.begin(); it != node->parents.end(); it++) {
+          if (!(*it)->dirty)
+            worklist.push_back(*it);
+        }
+      }
+    }
+
+
+    void AbstractNode::refresh(void) {
+      std::vector<std::pair<AbstractNode*, triton::uint32> > stack;
+
+      /* Post-order walk over the dirty nodes only */
+      stack.push_back(std::make_pair(this, 0));
+      while (!stack.empty()) {
+        AbstractNode* node = stack.back().first;
+        AbstractNode* next = nullptr;
+
+        while (next == nullptr && stack.back().second < dependencies(node)) {
+          AbstractNode* dep = dependency(node, stack.back().second++);
+          if (dep && dep->dirty)
+            next = dep;
+        }
+
+        if (next) {
+          stack.push_back(std::make_pair(next, 0));
+          continue;
+        }
+
+        /* All dependencies are up to date */
+        node->dirty = false;
+        node->init();
+        stack.pop_back();
+      }
+    }
+
+
+    void AbstractNode::initHash(void) {
+      triton::uint64 h = hashMix(this->kind);
+
+      /* Leaves carry their own data */
+      switch (this->kind) {
+        case DECIMAL_NODE:
+          h = hashCombine(h, hashUint512(reinterpret_cast<DecimalNode*>(this)->getValue()));
+          break;
+        case REFERENCE_NODE:
+          h = hashCombine(h, reinterpret_cast<ReferenceNode*>(this)->getValue());
+          break;
+        case BV_NODE:
+          h = hashCombine(hashCombine(h, hashUint512(reinterpret_cast<BvNode*>(this)->getValue())), this->size);
+          break;
+        case STRING_NODE:
+          h = hashCombine(h, hashString(reinterpret_cast<StringNode*>(this)->getValue()));
+          break;
+        case VARIABLE_NODE:
+          h = hashCombine(h, hashString(reinterpret_cast<VariableNode*>(this)->getValue()));
+          break;
+        case EXTRACT_NODE:
+          h = hashCombine(h, (static_cast<triton::uint64>(reinterpret_cast<ExtractNode*>(this)->getHigh()) << 32) | reinterpret_cast<ExtractNode*>(this)->getLow());
+          break;
+        case SX_NODE:
+          h = hashCombine(h, reinterpret_cast<SxNode*>(this)->getSizeExt());
+          break;
+        case ZX_NODE:
+          h = hashCombine(h, reinterpret_cast<ZxNode*>(this)->getSizeExt());
+          break;
+        default:
+          break;
+      }
+
+      /* Commutative operators sum their childs so that (a op b) and (b op a) have the same hash */
+      if (isCommutative(this->kind)) {
+        triton::uint64 sum = 0;
+        for (triton::uint32 index = 0; index < this->childs.size(); index++)
+          sum += hashMix(this->childs[index]->hash());
+        h = hashCombine(h, sum);
+      }
+      else {
+        for (triton::uint32 index = 0; index < this->childs.size(); index++)
+          h = hashCombine(h, this->childs[index]->hash());
+      }
+
+      this->hashValue = hashCombine(h, this->childs.size());
+    }
+
+
+    void AbstractNode::initParents(void) {
+      /*
+       * init() runs again each time the node is refreshed, but an edge
+       * must be registered only once. Registering the edges at the end of
+       * the first init() also ensures that a node rejected by init() is
+       * never left in the parents of its childs.
+       */
+      if (this->linked)
+        return;
+
+      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+        this->childs[index]->parents.push_back(this);
+        this->childs[index]->references++;
+      }
+
+      this->linked = true;
+    }
+
+
+    triton::uint32 AbstractNode::getReferenceCount(void) const {
+      return this->references;
+    }
+
+
+    triton::uint64 AbstractNode::hash(void) const {
+      if (this->dirty)
+        const_cast<AbstractNode*>(this)->refresh();
+      return this->hashValue;
     }
 
 
@@ -152,14 +795,19 @@ namespace triton {
 
     AssertNode::AssertNode(const AssertNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -173,17 +821,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = 0;
+      this->setEval(static_cast<triton::uint64>(0));
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -192,14 +840,6 @@ namespace triton {
     }
 
 
-    triton::uint512 AssertNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvadd */
 
@@ -214,14 +854,19 @@ namespace triton {
 
     BvaddNode::BvaddNode(const BvaddNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -238,17 +883,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() + this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->evaluateIn<BvaddOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -257,14 +902,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvaddNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvand */
 
@@ -279,14 +916,19 @@ namespace triton {
 
     BvandNode::BvandNode(const BvandNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -303,17 +945,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() & this->childs[1]->evaluate());
+      this->evaluateIn<BvandOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -322,14 +964,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvandNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
 
     /* ====== bvashr (shift with sign extension fill) */
@@ -345,14 +979,19 @@ namespace triton {
 
     BvashrNode::BvashrNode(const BvashrNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -361,57 +1000,25 @@ namespace triton {
 
 
     void BvashrNode::init(void) {
-      triton::uint32 shift  = 0;
-      triton::uint512 mask  = 0;
-      triton::uint512 value = 0;
-
       if (this->childs.size() < 2)
         throw std::runtime_error("BvashrNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw std::runtime_error("BvashrNode::init(): Must take two nodes of same size.");
 
-      value = this->childs[0]->evaluate();
-      shift = this->childs[1]->evaluate().convert_to<triton::uint32>();
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-
-      /* Mask based on the sign */
-      if (this->childs[0]->isSigned()) {
-        mask = 1;
-        mask = ((mask << (this->size-1)) & this->getBitvectorMask());
-      }
-
-      if (shift >= this->size && this->childs[0]->isSigned()) {
-        this->eval = -1;
-        this->eval &= this->getBitvectorMask();
-      }
-
-      else if (shift >= this->size && !this->childs[0]->isSigned()) {
-        this->eval = 0;
-      }
-
-      else if (shift == 0) {
-        this->eval = value;
-      }
-
-      else {
-        this->eval = value & this->getBitvectorMask();
-        for (triton::uint32 index = 0; index < shift; index++) {
-          this->eval = (((this->eval >> 1) | mask) & this->getBitvectorMask());
-        }
-      }
+      this->evaluateIn<BvashrOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -420,14 +1027,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvashrNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvdecl */
 
@@ -441,14 +1040,19 @@ namespace triton {
 
     BvdeclNode::BvdeclNode(const BvdeclNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -474,17 +1078,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = size;
-      this->eval = 0;
+      this->setEval(static_cast<triton::uint64>(0));
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -493,14 +1097,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvdeclNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvlshr (shift with zero filled) */
 
@@ -515,14 +1111,19 @@ namespace triton {
 
     BvlshrNode::BvlshrNode(const BvlshrNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -539,17 +1140,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() >> this->childs[1]->evaluate().convert_to<triton::uint32>());
+      this->evaluateIn<BvlshrOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -558,14 +1159,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvlshrNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvmul */
 
@@ -580,14 +1173,19 @@ namespace triton {
 
     BvmulNode::BvmulNode(const BvmulNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -604,17 +1202,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() * this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->evaluateIn<BvmulOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -623,14 +1221,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvmulNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvnand */
 
@@ -645,14 +1235,19 @@ namespace triton {
 
     BvnandNode::BvnandNode(const BvnandNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -669,17 +1264,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() & this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->evaluateIn<BvnandOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -688,14 +1283,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvnandNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvneg */
 
@@ -709,14 +1296,19 @@ namespace triton {
 
     BvnegNode::BvnegNode(const BvnegNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -730,17 +1322,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((-(this->childs[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
+      this->evaluateIn<BvnegOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -749,14 +1341,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvnegNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvnor */
 
@@ -771,14 +1355,19 @@ namespace triton {
 
     BvnorNode::BvnorNode(const BvnorNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -795,17 +1384,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() | this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->evaluateIn<BvnorOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -814,14 +1403,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvnorNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvnot */
 
@@ -835,14 +1416,19 @@ namespace triton {
 
     BvnotNode::BvnotNode(const BvnotNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -856,17 +1442,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~this->childs[0]->evaluate() & this->getBitvectorMask());
+      this->evaluateIn<BvnotOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -875,14 +1461,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvnotNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvor */
 
@@ -897,14 +1475,19 @@ namespace triton {
 
     BvorNode::BvorNode(const BvorNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -921,17 +1504,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() | this->childs[1]->evaluate());
+      this->evaluateIn<BvorOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -940,14 +1523,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvorNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvrol */
 
@@ -970,14 +1545,19 @@ namespace triton {
 
     BvrolNode::BvrolNode(const BvrolNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -987,32 +1567,25 @@ namespace triton {
 
 
     void BvrolNode::init(void) {
-      triton::uint32 rot    = 0;
-      triton::uint512 value = 0;
-
       if (this->childs.size() < 2)
         throw std::runtime_error("BvrolNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getKind() != DECIMAL_NODE)
         throw std::runtime_error("BvrolNode::init(): rot must be a DECIMAL_NODE.");
 
-      rot   = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
-      value = this->childs[1]->evaluate();
-
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      rot %= this->size;
-      this->eval = (((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
+      this->evaluateIn<BvrolOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1021,14 +1594,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvrolNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvror */
 
@@ -1051,14 +1616,19 @@ namespace triton {
 
     BvrorNode::BvrorNode(const BvrorNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1067,32 +1637,25 @@ namespace triton {
 
 
     void BvrorNode::init(void) {
-      triton::uint32 rot    = 0;
-      triton::uint512 value = 0;
-
       if (this->childs.size() < 2)
         throw std::runtime_error("BvrorNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getKind() != DECIMAL_NODE)
         throw std::runtime_error("BvrorNode::init(): rot must be a DECIMAL_NODE.");
 
-      rot   = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
-      value = this->childs[1]->evaluate();
-
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      rot %= this->size;
-      this->eval = (((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
+      this->evaluateIn<BvrorOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1101,14 +1664,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvrorNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvsdiv */
 
@@ -1123,14 +1678,19 @@ namespace triton {
 
     BvsdivNode::BvsdivNode(const BvsdivNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1139,38 +1699,53 @@ namespace triton {
 
 
     void BvsdivNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw std::runtime_error("BvsdivNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw std::runtime_error("BvsdivNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (op2Signed == 0) {
-        this->eval = (op1Signed < 0 ? 1 : -1);
-        this->eval &= this->getBitvectorMask();
+      /* Native signed arithmetic up to 64 bits */
+      if (this->size <= 64) {
+        triton::uint64 mask = bitvectorMask<triton::uint64>(this->size);
+        triton::sint64 op1 = signedValue64(this->childs[0]);
+        triton::sint64 op2 = signedValue64(this->childs[1]);
+
+        if (op2 == 0)
+          this->setEval(static_cast<triton::uint64>(op1 < 0 ? 1 : -1) & mask);
+
+        /* op1 / -1 overflows when op1 is the minimum value */
+        else if (op2 == -1)
+          this->setEval((static_cast<triton::uint64>(0) - static_cast<triton::uint64>(op1)) & mask);
+
+        else
+          this->setEval(static_cast<triton::uint64>(op1 / op2) & mask);
+      }
+
+      else {
+        triton::sint512 op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+        triton::sint512 op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+        if (op2Signed == 0) {
+          triton::uint512 value = (op1Signed < 0 ? 1 : -1);
+          this->setEval(triton::uint512(value & this->getBitvectorMask()));
+        }
+        else
+          this->setEval(triton::uint512((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask()));
       }
-      else
-        this->eval = ((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1179,14 +1754,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvsdivNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvsge */
 
@@ -1201,14 +1768,19 @@ namespace triton {
 
     BvsgeNode::BvsgeNode(const BvsgeNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1217,32 +1789,25 @@ namespace triton {
 
 
     void BvsgeNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw std::runtime_error("BvsgeNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw std::runtime_error("BvsgeNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed >= op2Signed);
+      this->evaluateIn<BvsgeOp>(this->childs[0]->getBitvectorSize());
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1251,14 +1816,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvsgeNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvsgt */
 
@@ -1273,14 +1830,19 @@ namespace triton {
 
     BvsgtNode::BvsgtNode(const BvsgtNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1289,32 +1851,25 @@ namespace triton {
 
 
     void BvsgtNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw std::runtime_error("BvsgtNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw std::runtime_error("BvsgtNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed > op2Signed);
+      this->evaluateIn<BvsgtOp>(this->childs[0]->getBitvectorSize());
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1323,14 +1878,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvsgtNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvshl */
 
@@ -1345,14 +1892,19 @@ namespace triton {
 
     BvshlNode::BvshlNode(const BvshlNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1369,17 +1921,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() << this->childs[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
+      this->evaluateIn<BvshlOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1388,14 +1940,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvshlNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvsle */
 
@@ -1410,14 +1954,19 @@ namespace triton {
 
     BvsleNode::BvsleNode(const BvsleNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1426,32 +1975,25 @@ namespace triton {
 
 
     void BvsleNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw std::runtime_error("BvsleNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw std::runtime_error("BvsleNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed <= op2Signed);
+      this->evaluateIn<BvsleOp>(this->childs[0]->getBitvectorSize());
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1460,14 +2002,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvsleNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvslt */
 
@@ -1482,14 +2016,19 @@ namespace triton {
 
     BvsltNode::BvsltNode(const BvsltNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1498,32 +2037,25 @@ namespace triton {
 
 
     void BvsltNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw std::runtime_error("BvsltNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw std::runtime_error("BvsltNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed < op2Signed);
+      this->evaluateIn<BvsltOp>(this->childs[0]->getBitvectorSize());
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1532,14 +2064,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvsltNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvsmod - 2's complement signed remainder (sign follows divisor) */
 
@@ -1554,14 +2078,19 @@ namespace triton {
 
     BvsmodNode::BvsmodNode(const BvsmodNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1570,36 +2099,53 @@ namespace triton {
 
 
     void BvsmodNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw std::runtime_error("BvsmodNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw std::runtime_error("BvsmodNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
-      else
-        this->eval = ((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
+      /* Native signed arithmetic up to 64 bits */
+      if (this->size <= 64) {
+        triton::uint64 mask = bitvectorMask<triton::uint64>(this->size);
+        triton::sint64 op1 = signedValue64(this->childs[0]);
+        triton::sint64 op2 = signedValue64(this->childs[1]);
+        triton::sint64 rem = 0;
+
+        if (op2 == 0)
+          this->setEval(this->childs[0]->evaluate64());
+
+        else {
+          /* op1 % -1 overflows when op1 is the minimum value */
+          rem = (op2 == -1) ? 0 : (op1 % op2);
+          if (rem != 0 && ((rem < 0) != (op2 < 0)))
+            rem += op2;
+          this->setEval(static_cast<triton::uint64>(rem) & mask);
+        }
+      }
+
+      else {
+        triton::sint512 op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+        triton::sint512 op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+        if (op2Signed == 0)
+          this->setEval(this->childs[0]);
+        else
+          this->setEval(triton::uint512((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask()));
+      }
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1608,14 +2154,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvsmodNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvsrem - 2's complement signed remainder (sign follows dividend) */
 
@@ -1630,14 +2168,19 @@ namespace triton {
 
     BvsremNode::BvsremNode(const BvsremNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1646,36 +2189,51 @@ namespace triton {
 
 
     void BvsremNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw std::runtime_error("BvsremNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw std::runtime_error("BvsremNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
-      else
-        this->eval = ((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask());
+      /* Native signed arithmetic up to 64 bits */
+      if (this->size <= 64) {
+        triton::uint64 mask = bitvectorMask<triton::uint64>(this->size);
+        triton::sint64 op1 = signedValue64(this->childs[0]);
+        triton::sint64 op2 = signedValue64(this->childs[1]);
+
+        if (op2 == 0)
+          this->setEval(this->childs[0]->evaluate64());
+
+        /* op1 % -1 overflows when op1 is the minimum value */
+        else if (op2 == -1)
+          this->setEval(static_cast<triton::uint64>(0));
+
+        else
+          this->setEval(static_cast<triton::uint64>(op1 % op2) & mask);
+      }
+
+      else {
+        triton::sint512 op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+        triton::sint512 op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+        if (op2Signed == 0)
+          this->setEval(this->childs[0]);
+        else
+          this->setEval(triton::uint512((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask()));
+      }
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1684,14 +2242,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvsremNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvsub */
 
@@ -1706,14 +2256,19 @@ namespace triton {
 
     BvsubNode::BvsubNode(const BvsubNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1730,17 +2285,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() - this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->evaluateIn<BvsubOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1749,14 +2304,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvsubNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvudiv */
 
@@ -1771,14 +2318,19 @@ namespace triton {
 
     BvudivNode::BvudivNode(const BvudivNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1796,20 +2348,17 @@ namespace triton {
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = (-1 & this->getBitvectorMask());
-      else
-        this->eval = (this->childs[0]->evaluate() / this->childs[1]->evaluate());
+      this->evaluateIn<BvudivOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1818,14 +2367,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvudivNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvuge */
 
@@ -1840,14 +2381,19 @@ namespace triton {
 
     BvugeNode::BvugeNode(const BvugeNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1864,17 +2410,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() >= this->childs[1]->evaluate());
+      this->evaluateIn<BvugeOp>(this->childs[0]->getBitvectorSize());
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1883,14 +2429,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvugeNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvugt */
 
@@ -1905,14 +2443,19 @@ namespace triton {
 
     BvugtNode::BvugtNode(const BvugtNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1929,17 +2472,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() > this->childs[1]->evaluate());
+      this->evaluateIn<BvugtOp>(this->childs[0]->getBitvectorSize());
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -1948,14 +2491,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvugtNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvule */
 
@@ -1970,14 +2505,19 @@ namespace triton {
 
     BvuleNode::BvuleNode(const BvuleNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -1994,17 +2534,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() <= this->childs[1]->evaluate());
+      this->evaluateIn<BvuleOp>(this->childs[0]->getBitvectorSize());
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2013,14 +2553,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvuleNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvult */
 
@@ -2035,14 +2567,19 @@ namespace triton {
 
     BvultNode::BvultNode(const BvultNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2059,17 +2596,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() < this->childs[1]->evaluate());
+      this->evaluateIn<BvultOp>(this->childs[0]->getBitvectorSize());
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2078,14 +2615,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvultNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvurem */
 
@@ -2100,14 +2629,19 @@ namespace triton {
 
     BvuremNode::BvuremNode(const BvuremNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2125,20 +2659,17 @@ namespace triton {
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
-      else
-        this->eval = (this->childs[0]->evaluate() % this->childs[1]->evaluate());
+      this->evaluateIn<BvuremOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2147,14 +2678,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvuremNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvxnor */
 
@@ -2169,14 +2692,19 @@ namespace triton {
 
     BvxnorNode::BvxnorNode(const BvxnorNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2193,17 +2721,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() ^ this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->evaluateIn<BvxnorOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2212,14 +2740,6 @@ namespace triton {
     }
 
 
-    triton::uint512 BvxnorNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bvxor */
 
@@ -2234,14 +2754,19 @@ namespace triton {
 
     BvxorNode::BvxorNode(const BvxorNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2258,17 +2783,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() ^ this->childs[1]->evaluate());
+      this->evaluateIn<BvxorOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2277,36 +2802,29 @@ namespace triton {
     }
 
 
-    triton::uint512 BvxorNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== bv */
 
 
     BvNode::BvNode(triton::uint512 value, triton::uint32 size) {
       this->kind = BV_NODE;
-      this->addChild(triton::ast::decimal(value));
-      this->addChild(triton::ast::decimal(size));
+      this->size = size;
+      this->setEval(value);
       this->init();
     }
 
 
     BvNode::BvNode(const BvNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
-      /* Copy childs */
-      for (triton::uint32 index = 0; index < copy.childs.size(); index++)
-        this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2315,37 +2833,20 @@ namespace triton {
 
 
     void BvNode::init(void) {
-      triton::uint512 value = 0;
-      triton::uint32 size   = 0;
-
-      if (this->childs.size() < 2)
-        throw std::runtime_error("BvNode::init(): Must take at least two childs.");
-
-      if (this->childs[0]->getKind() != DECIMAL_NODE || this->childs[1]->getKind() != DECIMAL_NODE)
-        throw std::runtime_error("BvNode::init(): Size and value must be a DECIMAL_NODE.");
-
-      value = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue();
-      size  = reinterpret_cast<DecimalNode*>(this->childs[1])->getValue().convert_to<triton::uint32>();
-
-      if (!size)
+      if (!this->size)
         throw std::runtime_error("BvNode::init(): Size connot be equal to zero.");
 
-      if (size > MAX_BITS_SUPPORTED)
+      if (this->size > MAX_BITS_SUPPORTED)
         throw std::runtime_error("BvNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      /* Init attributes */
-      this->size = size;
-      this->eval = (value & this->getBitvectorMask());
-
-      /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
-        this->symbolized |= this->childs[index]->isSymbolized();
-      }
+      /* Init attributes. The value is kept in the evaluation field */
+      this->setEval(triton::uint512(this->evaluate() & this->getBitvectorMask()));
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2354,15 +2855,12 @@ namespace triton {
     }
 
 
-    triton::uint512 BvNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    triton::uint512 BvNode::getValue(void) {
+      return this->evaluate();
     }
 
 
+
     /* ====== compound */
 
 
@@ -2376,14 +2874,19 @@ namespace triton {
 
     CompoundNode::CompoundNode(const CompoundNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2397,17 +2900,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 0;
-      this->eval = 0;
+      this->setEval(static_cast<triton::uint64>(0));
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2416,14 +2919,6 @@ namespace triton {
     }
 
 
-    triton::uint512 CompoundNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== concat */
 
@@ -2454,14 +2949,19 @@ namespace triton {
 
     ConcatNode::ConcatNode(const ConcatNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2482,19 +2982,17 @@ namespace triton {
       if (this->size > MAX_BITS_SUPPORTED)
         throw std::runtime_error("ConcatNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = this->childs[0]->evaluate();
-      for (triton::uint32 index = 0; index < this->childs.size()-1; index++)
-        this->eval = ((this->eval << this->childs[index+1]->getBitvectorSize()) | this->childs[index+1]->evaluate());
+      this->evaluateIn<ConcatOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2503,21 +3001,14 @@ namespace triton {
     }
 
 
-    triton::uint512 ConcatNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== Decimal node */
 
 
     DecimalNode::DecimalNode(triton::uint512 value) {
-      this->kind  = DECIMAL_NODE;
-      this->value = value;
+      this->kind      = DECIMAL_NODE;
+      this->value     = static_cast<triton::uint64>(value);
+      this->valueWide = (value > 0xffffffffffffffff) ? new triton::uint512(value) : nullptr;
       this->init();
     }
 
@@ -2525,30 +3016,38 @@ namespace triton {
     DecimalNode::DecimalNode(const DecimalNode& copy) {
       this->kind       = copy.kind;
       this->value      = copy.value;
+      this->valueWide  = copy.valueWide ? new triton::uint512(*copy.valueWide) : nullptr;
       this->size       = copy.size;
       this->eval       = copy.eval;
-      this->parents    = copy.parents;
+      this->evalWide   = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty      = copy.dirty;
+      this->hashValue  = copy.hashValue;
       this->symbolized = copy.symbolized;
     }
 
 
     DecimalNode::~DecimalNode() {
+      delete this->valueWide;
     }
 
 
     void DecimalNode::init(void) {
       /* Init attributes */
-      this->eval        = 0;
       this->size        = 0;
+      this->setEval(static_cast<triton::uint64>(0));
       this->symbolized  = false;
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
     triton::uint512 DecimalNode::getValue(void) {
+      if (this->valueWide)
+        return *this->valueWide;
       return this->value;
     }
 
@@ -2558,11 +3057,6 @@ namespace triton {
     }
 
 
-    triton::uint512 DecimalNode::hash(triton::uint32 deep) {
-      triton::uint512 hash = this->kind ^ this->value;
-      return hash;
-    }
-
 
     /* ====== Declare node */
 
@@ -2577,14 +3071,19 @@ namespace triton {
 
     DeclareFunctionNode::DeclareFunctionNode(const DeclareFunctionNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2604,17 +3103,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      this->eval = this->childs[1]->evaluate();
+      this->setEval(this->childs[1]);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2623,14 +3122,6 @@ namespace triton {
     }
 
 
-    triton::uint512 DeclareFunctionNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== Distinct node */
 
@@ -2645,14 +3136,19 @@ namespace triton {
 
     DistinctNode::DistinctNode(const DistinctNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2666,17 +3162,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() != this->childs[1]->evaluate());
+      this->evaluateIn<DistinctOp>(this->childs[0]->getBitvectorSize());
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2685,14 +3181,6 @@ namespace triton {
     }
 
 
-    triton::uint512 DistinctNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== equal */
 
@@ -2707,14 +3195,19 @@ namespace triton {
 
     EqualNode::EqualNode(const EqualNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2728,17 +3221,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() == this->childs[1]->evaluate());
+      this->evaluateIn<EqualOp>(this->childs[0]->getBitvectorSize());
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2747,22 +3240,14 @@ namespace triton {
     }
 
 
-    triton::uint512 EqualNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== extract */
 
 
     ExtractNode::ExtractNode(triton::uint32 high, triton::uint32 low, AbstractNode* expr) {
       this->kind = EXTRACT_NODE;
-      this->addChild(triton::ast::decimal(high));
-      this->addChild(triton::ast::decimal(low));
+      this->high = high;
+      this->low  = low;
       this->addChild(expr);
       this->init();
     }
@@ -2770,14 +3255,21 @@ namespace triton {
 
     ExtractNode::ExtractNode(const ExtractNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
+      this->high        = copy.high;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
+      this->low         = copy.low;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2786,54 +3278,48 @@ namespace triton {
 
 
     void ExtractNode::init(void) {
-      triton::uint32 high = 0;
-      triton::uint32 low  = 0;
-
-      if (this->childs.size() < 3)
-        throw std::runtime_error("ExtractNode::init(): Must take at least three childs.");
-
-      if (this->childs[0]->getKind() != DECIMAL_NODE || this->childs[1]->getKind() != DECIMAL_NODE)
-        throw std::runtime_error("ExtractNode::init(): The highest and lower bit must be a DECIMAL_NODE.");
-
-      high = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
-      low  = reinterpret_cast<DecimalNode*>(this->childs[1])->getValue().convert_to<triton::uint32>();
+      if (this->childs.size() < 1)
+        throw std::runtime_error("ExtractNode::init(): Must take at least one child.");
 
-      if (low > high)
+      if (this->low > this->high)
         throw std::runtime_error("ExtractNode::init(): The high bit must be greater than the low bit.");
 
       /* Init attributes */
-      this->size = ((high - low) + 1);
-      this->eval = ((this->childs[2]->evaluate() >> low) & this->getBitvectorMask());
+      this->size = ((this->high - this->low) + 1);
 
-      if (this->size > this->childs[2]->getBitvectorSize())
+      if (this->size > this->childs[0]->getBitvectorSize())
         throw std::runtime_error("ExtractNode::init(): The size of the extraction is higher than the child expression.");
 
+      this->evaluateIn<ExtractOp>(this->childs[0]->getBitvectorSize(), this->low);
+
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void ExtractNode::accept(AstVisitor& v) {
-      v(*this);
+    triton::uint32 ExtractNode::getHigh(void) {
+      return this->high;
     }
 
 
-    triton::uint512 ExtractNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    triton::uint32 ExtractNode::getLow(void) {
+      return this->low;
+    }
+
+
+    void ExtractNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
+
     /* ====== ite */
 
 
@@ -2848,14 +3334,19 @@ namespace triton {
 
     IteNode::IteNode(const IteNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2872,17 +3363,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      this->eval = this->childs[0]->evaluate() ? this->childs[1]->evaluate() : this->childs[2]->evaluate();
+      this->evaluateIn<IteOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2891,14 +3382,6 @@ namespace triton {
     }
 
 
-    triton::uint512 IteNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== Land */
 
@@ -2913,14 +3396,19 @@ namespace triton {
 
     LandNode::LandNode(const LandNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -2934,17 +3422,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() && this->childs[1]->evaluate());
+      this->setEval(static_cast<triton::uint64>(this->childs[0]->evaluate64() && this->childs[1]->evaluate64()));
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -2953,14 +3441,6 @@ namespace triton {
     }
 
 
-    triton::uint512 LandNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== Let */
 
@@ -2976,14 +3456,19 @@ namespace triton {
 
     LetNode::LetNode(const LetNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -3000,17 +3485,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[2]->getBitvectorSize();
-      this->eval = this->childs[2]->evaluate();
+      this->setEval(this->childs[2]);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -3019,14 +3504,6 @@ namespace triton {
     }
 
 
-    triton::uint512 LetNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== Lnot */
 
@@ -3040,14 +3517,19 @@ namespace triton {
 
     LnotNode::LnotNode(const LnotNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -3061,17 +3543,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = !(this->childs[0]->evaluate());
+      this->setEval(static_cast<triton::uint64>(!this->childs[0]->evaluate64()));
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -3080,14 +3562,6 @@ namespace triton {
     }
 
 
-    triton::uint512 LnotNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== Lor */
 
@@ -3102,14 +3576,19 @@ namespace triton {
 
     LorNode::LorNode(const LorNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -3123,17 +3602,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() || this->childs[1]->evaluate());
+      this->setEval(static_cast<triton::uint64>(this->childs[0]->evaluate64() || this->childs[1]->evaluate64()));
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -3142,57 +3621,57 @@ namespace triton {
     }
 
 
-    triton::uint512 LorNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== Reference node */
 
 
     ReferenceNode::ReferenceNode(triton::__uint value) {
-      this->kind  = REFERENCE_NODE;
-      this->value = value;
+      this->kind    = REFERENCE_NODE;
+      this->target  = nullptr;
+      this->value   = value;
       this->init();
     }
 
 
     ReferenceNode::ReferenceNode(const ReferenceNode& copy) {
       this->kind        = copy.kind;
+      this->target      = nullptr;
       this->value       = copy.value;
       this->size        = copy.size;
       this->eval        = copy.eval;
-      this->parents     = copy.parents;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->symbolized  = copy.symbolized;
     }
 
 
     ReferenceNode::~ReferenceNode() {
+      this->setTarget(nullptr);
     }
 
 
     void ReferenceNode::init(void) {
       /* Init attributes */
       if (!triton::api.isSymbolicExpressionIdExists(this->value)) {
-        this->eval        = 0;
         this->size        = 0;
         this->symbolized  = false;
+        this->setEval(static_cast<triton::uint64>(0));
       }
       else {
-        this->eval        = triton::api.getAstFromId(this->value)->evaluate();
         this->size        = triton::api.getAstFromId(this->value)->getBitvectorSize();
         this->symbolized  = triton::api.getAstFromId(this->value)->isSymbolized();
+        this->setEval(triton::api.getAstFromId(this->value));
 
-        triton::api.getAstFromId(this->value)->setParent(this);
+        if (this->target == nullptr)
+          this->setTarget(triton::api.getAstFromId(this->value));
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -3201,17 +3680,37 @@ namespace triton {
     }
 
 
-    void ReferenceNode::accept(AstVisitor& v) {
-      v(*this);
+    AbstractNode* ReferenceNode::getTarget(void) {
+      return this->target;
+    }
+
+
+    void ReferenceNode::setTarget(AbstractNode* ast) {
+      AbstractNode* old = this->target;
+
+      if (old == ast)
+        return;
+
+      /* Hold the new AST before releasing the old one, they may share nodes */
+      this->target = ast;
+      if (ast != nullptr) {
+        ast->setParent(this);
+        triton::api.retainAstNode(ast);
+      }
+
+      if (old != nullptr) {
+        old->removeParent(this);
+        triton::api.releaseAstNode(old);
+      }
     }
 
 
-    triton::uint512 ReferenceNode::hash(triton::uint32 deep) {
-      triton::uint512 hash = this->kind ^ this->value;
-      return hash;
+    void ReferenceNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
+
     /* ====== String node */
 
 
@@ -3227,7 +3726,9 @@ namespace triton {
       this->value       = copy.value;
       this->size        = copy.size;
       this->eval        = copy.eval;
-      this->parents     = copy.parents;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->symbolized  = copy.symbolized;
     }
 
@@ -3238,13 +3739,15 @@ namespace triton {
 
     void StringNode::init(void) {
       /* Init attributes */
-      this->eval        = 0;
       this->size        = 0;
+      this->setEval(static_cast<triton::uint64>(0));
       this->symbolized  = false;
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -3258,21 +3761,13 @@ namespace triton {
     }
 
 
-    triton::uint512 StringNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind;
-      triton::uint32 index = 1;
-      for (std::string::iterator it=this->value.begin(); it != this->value.end(); it++)
-        h = h * triton::ast::pow(*it, index++);
-      return triton::ast::rotl(h, deep);
-    }
-
 
     /* ====== sx */
 
 
     SxNode::SxNode(triton::uint32 sizeExt, AbstractNode* expr) {
-      this->kind = SX_NODE;
-      this->addChild(triton::ast::decimal(sizeExt));
+      this->kind    = SX_NODE;
+      this->sizeExt = sizeExt;
       this->addChild(expr);
       this->init();
     }
@@ -3280,14 +3775,20 @@ namespace triton {
 
     SxNode::SxNode(const SxNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
+      this->sizeExt     = copy.sizeExt;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -3296,55 +3797,46 @@ namespace triton {
 
 
     void SxNode::init(void) {
-      triton::uint32 sizeExt = 0;
-
-      if (this->childs.size() < 2)
-        throw std::runtime_error("SxNode::init(): Must take at least two childs.");
-
-      if (this->childs[0]->getKind() != DECIMAL_NODE)
-        throw std::runtime_error("SxNode::init(): The sizeExt must be a DECIMAL_NODE.");
-
-      sizeExt = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
+      if (this->childs.size() < 1)
+        throw std::runtime_error("SxNode::init(): Must take at least one child.");
 
       /* Init attributes */
-      this->size = sizeExt + this->childs[1]->getBitvectorSize();
+      this->size = this->sizeExt + this->childs[0]->getBitvectorSize();
       if (size > MAX_BITS_SUPPORTED)
         throw std::runtime_error("SxNode::SxNode(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = ((((this->childs[1]->evaluate() >> (this->childs[1]->getBitvectorSize()-1)) == 0) ? this->childs[1]->evaluate() : (this->childs[1]->evaluate() | ~(this->childs[1]->getBitvectorMask()))) & this->getBitvectorMask());
+      this->evaluateIn<SxOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void SxNode::accept(AstVisitor& v) {
-      v(*this);
+    triton::uint32 SxNode::getSizeExt(void) {
+      return this->sizeExt;
     }
 
 
-    triton::uint512 SxNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void SxNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
+
     /* ====== Variable node */
 
 
     VariableNode::VariableNode(triton::engines::symbolic::SymbolicVariable& symVar) {
-      this->kind  = VARIABLE_NODE;
-      this->value = symVar.getSymVarName();
+      this->kind     = VARIABLE_NODE;
+      this->value    = symVar.getSymVarName();
+      this->symVarId = symVar.getSymVarId();
       this->init();
     }
 
@@ -3352,9 +3844,12 @@ namespace triton {
     VariableNode::VariableNode(const VariableNode& copy) {
       this->kind        = copy.kind;
       this->value       = copy.value;
+      this->symVarId    = copy.symVarId;
       this->size        = copy.size;
       this->eval        = copy.eval;
-      this->parents     = copy.parents;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->symbolized  = copy.symbolized;
     }
 
@@ -3366,18 +3861,20 @@ namespace triton {
     void VariableNode::init(void) {
       triton::engines::symbolic::SymbolicVariable* symVar = nullptr;
 
-      symVar = triton::api.getSymbolicVariableFromName(this->value);
+      symVar = triton::api.getSymbolicVariableFromId(this->symVarId);
       if (symVar) {
         this->size        = symVar->getSymVarSize();
-        this->eval        = (symVar->getConcreteValue() & this->getBitvectorMask());
         this->symbolized  = true;
+        this->setEval(triton::uint512(symVar->getConcreteValue() & this->getBitvectorMask()));
       }
       else
         throw std::runtime_error("VariableNode::init(): Variable not found.");
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
@@ -3386,26 +3883,23 @@ namespace triton {
     }
 
 
-    void VariableNode::accept(AstVisitor& v) {
-      v(*this);
+    triton::__uint VariableNode::getSymVarId(void) {
+      return this->symVarId;
     }
 
 
-    triton::uint512 VariableNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind;
-      triton::uint32 index = 1;
-      for (std::string::iterator it=this->value.begin(); it != this->value.end(); it++)
-        h = h * triton::ast::pow(*it, index++);
-      return triton::ast::rotl(h, deep);
+    void VariableNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
 
+
     /* ====== zx */
 
 
     ZxNode::ZxNode(triton::uint32 sizeExt, AbstractNode* expr) {
-      this->kind = ZX_NODE;
-      this->addChild(triton::ast::decimal(sizeExt));
+      this->kind    = ZX_NODE;
+      this->sizeExt = sizeExt;
       this->addChild(expr);
       this->init();
     }
@@ -3413,14 +3907,20 @@ namespace triton {
 
     ZxNode::ZxNode(const ZxNode& copy) {
       this->eval        = copy.eval;
+      this->evalWide    = copy.evalWide ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->dirty       = copy.dirty;
+      this->hashValue   = copy.hashValue;
       this->kind        = copy.kind;
-      this->parents     = copy.parents;
       this->size        = copy.size;
+      this->sizeExt     = copy.sizeExt;
       this->symbolized  = copy.symbolized;
 
       /* Copy childs */
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+
+      /* Init parents */
+      this->initParents();
     }
 
 
@@ -3429,48 +3929,38 @@ namespace triton {
 
 
     void ZxNode::init(void) {
-      triton::uint32 sizeExt = 0;
-
-      if (this->childs.size() < 2)
-        throw std::runtime_error("ZxNode::init(): Must take at least two childs.");
-
-      if (this->childs[0]->getKind() != DECIMAL_NODE)
-        throw std::runtime_error("ZxNode::init(): The sizeExt must be a DECIMAL_NODE.");
-
-      sizeExt = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
+      if (this->childs.size() < 1)
+        throw std::runtime_error("ZxNode::init(): Must take at least one child.");
 
       /* Init attributes */
-      this->size = sizeExt + this->childs[1]->getBitvectorSize();
+      this->size = this->sizeExt + this->childs[0]->getBitvectorSize();
       if (size > MAX_BITS_SUPPORTED)
         throw std::runtime_error("ZxNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = (this->childs[1]->evaluate() & this->getBitvectorMask());
+      this->evaluateIn<ZxOp>(this->size);
 
       /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
         this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
+
+      /* Init the structural hash */
+      this->initHash();
     }
 
 
-    void ZxNode::accept(AstVisitor& v) {
-      v(*this);
+    triton::uint32 ZxNode::getSizeExt(void) {
+      return this->sizeExt;
     }
 
 
-    triton::uint512 ZxNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
-      return triton::ast::rotl(h, deep);
+    void ZxNode::accept(AstVisitor& v) {
+      v(*this);
     }
 
+
   }; /* ast namespace */
 }; /* triton namespace */
 
@@ -3491,7 +3981,7 @@ namespace triton {
     bool operator==(AbstractNode& node1, AbstractNode& node2) {
       return (node1.evaluate() == node2.evaluate()) &&
              (node1.getBitvectorSize() == node2.getBitvectorSize()) &&
-             (node1.hash(1) == node2.hash(1));
+             (node1.hash() == node2.hash());
     }
 
 
@@ -3505,17 +3995,38 @@ namespace triton {
 namespace triton {
   namespace ast {
 
-    triton::uint512 pow(triton::uint512 hash, triton::uint32 n) {
-      for (triton::uint32 i = 0; i < n; i++)
-        hash = hash * hash;
-      return hash;
+    triton::uint64 hashMix(triton::uint64 value) {
+      value ^= value >> 30;
+      value *= 0xbf58476d1ce4e5b9ULL;
+      value ^= value >> 27;
+      value *= 0x94d049bb133111ebULL;
+      value ^= value >> 31;
+      return value;
+    }
+
+
+    triton::uint64 hashCombine(triton::uint64 seed, triton::uint64 value) {
+      return hashMix(seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)));
     }
 
 
-    triton::uint512 rotl(triton::uint512 value, triton::uint32 shift) {
-      if ((shift &= 511) == 0)
-        return value;
-      return ((value << shift) | (value >> (512 - shift)));
+    triton::uint64 hashString(const std::string& value) {
+      triton::uint64 h = 0xcbf29ce484222325ULL;
+      for (std::string::const_iterator it = value.begin(); it != value.end(); it++) {
+        h ^= static_cast<triton::uint8>(*it);
+        h *= 0x100000001b3ULL;
+      }
+      return h;
+    }
+
+
+    triton::uint64 hashUint512(triton::uint512 value) {
+      triton::uint64 h = 0;
+      do {
+        h = hashCombine(h, static_cast<triton::uint64>(value));
+        value >>= 64;
+      } while (value != 0);
+      return h;
     }
 
 
@@ -3543,8 +4054,342 @@ namespace triton {
 namespace triton {
   namespace ast {
 
+    /*
+     * With the AST_DICTIONARIES optimization enabled, a builder first looks for
+     * the node it is about to build and returns the existing one if any, so the
+     * same node is never allocated twice.
+     */
+
+    //! Returns the existing node of this kind with these childs and inline parameters, nullptr if the node must be built.
+    static inline AbstractNode* findNode(enum kind_e kind, std::initializer_list<AbstractNode*> childs, triton::uint64 params=0) {
+      return triton::api.lookupAstDictionaries(kind, childs.begin(), static_cast<triton::uint32>(childs.size()), params);
+    }
+
+
+    //! Returns the existing node of this kind with these childs, nullptr if the node must be built.
+    static inline AbstractNode* findNode(enum kind_e kind, const std::vector<AbstractNode*>& childs) {
+      return triton::api.lookupAstDictionaries(kind, childs.data(), static_cast<triton::uint32>(childs.size()));
+    }
+
+
+    //! Returns the existing node of this kind with these childs, nullptr if the node must be built.
+    static inline AbstractNode* findNode(enum kind_e kind, const std::list<AbstractNode*>& childs) {
+      if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES))
+        return nullptr;
+      std::vector<AbstractNode*> key(childs.begin(), childs.end());
+      return findNode(kind, key);
+    }
+
+
+    //! Returns the existing bit-vector of this value and size, nullptr if the node must be built.
+    static inline AbstractNode* findBitvector(const triton::uint512& value, triton::uint32 size) {
+      /* An invalid size is reported by the node itself */
+      if (size == 0 || size > MAX_BITS_SUPPORTED)
+        return nullptr;
+      return triton::api.lookupAstDictionaries(BV_NODE, value & (triton::uint512(-1) >> (512 - size)), size);
+    }
+
+
+    //! Returns the existing node whose first childs are decimal nodes of `params` and whose last child is `expr` (if not null), nullptr if the node must be built.
+    static inline AbstractNode* findNodeWithParams(enum kind_e kind, std::initializer_list<triton::uint512> params, AbstractNode* expr) {
+      AbstractNode* childs[3];
+      triton::uint32 size = 0;
+
+      if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES))
+        return nullptr;
+
+      /*
+       * The decimal childs of the key are looked up, not built. If one of
+       * them is not unique yet, the node cannot exist either.
+       */
+      for (std::initializer_list<triton::uint512>::const_iterator it = params.begin(); it != params.end() && size < 2; it++) {
+        if ((childs[size++] = triton::api.lookupAstDictionaries(DECIMAL_NODE, *it)) == nullptr)
+          return nullptr;
+      }
+
+      if (expr != nullptr)
+        childs[size++] = expr;
+
+      return triton::api.lookupAstDictionaries(kind, childs, size);
+    }
+
+
+    //! Returns the existing node whose first child is the string node of `name` followed by `exprs`, nullptr if the node must be built.
+    static inline AbstractNode* findNodeWithName(enum kind_e kind, const std::string& name, std::initializer_list<AbstractNode*> exprs) {
+      AbstractNode* childs[3];
+      triton::uint32 size = 0;
+
+      if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::AST_DICTIONARIES))
+        return nullptr;
+
+      /* The string child of the key is looked up, not built */
+      if ((childs[size++] = triton::api.lookupAstDictionaries(STRING_NODE, name)) == nullptr)
+        return nullptr;
+
+      for (std::initializer_list<AbstractNode*>::const_iterator it = exprs.begin(); it != exprs.end() && size < 3; it++)
+        childs[size++] = *it;
+
+      return triton::api.lookupAstDictionaries(kind, childs, size);
+    }
+
+    /*
+     * With the CONSTANT_FOLDING optimization enabled, a builder whose operands
+     * are all constant bit-vectors returns the bit-vector of the result instead
+     * of an operator node, and a few cheap identities (x + 0, x & 0, x ^ x,
+     * full-width extract, zx by 0...) return an operand as is. The results are
+     * computed by the same Ops as the nodes. Malformed operations are never
+     * folded, their constructors throw as usual. Logical nodes (comparisons,
+     * and, or, not) are never folded either: their sort is Bool and a constant
+     * bit-vector cannot take their place, but an ite on a condition over
+     * constants only returns the selected branch.
+     */
+
+    //! Returns true if the node is a constant bit-vector.
+    static inline bool isBv(AbstractNode* node) {
+      return node->getKind() == BV_NODE;
+    }
+
+
+    //! Returns true if the node is the constant bit-vector `value`.
+    static inline bool isBv(AbstractNode* node, const triton::uint512& value) {
+      return node->getKind() == BV_NODE && node->evaluate() == value;
+    }
+
+
+    //! Returns true if the node is a condition over constant bit-vectors only.
+    static bool isConstantCondition(AbstractNode* node) {
+      switch (node->getKind()) {
+        case BV_NODE:
+          return true;
+
+        case BVSGE_NODE:
+        case BVSGT_NODE:
+        case BVSLE_NODE:
+        case BVSLT_NODE:
+        case BVUGE_NODE:
+        case BVUGT_NODE:
+        case BVULE_NODE:
+        case BVULT_NODE:
+        case DISTINCT_NODE:
+        case EQUAL_NODE:
+        case LAND_NODE:
+        case LNOT_NODE:
+        case LOR_NODE:
+          for (AbstractNode* child : node->getChilds()) {
+            if (!isConstantCondition(child))
+              return false;
+          }
+          return true;
+
+        default:
+          return false;
+      }
+    }
+
+
+    //! Returns the constant bit-vector computed by `Op` from constant childs.
+    template <template <typename> class Op, typename... Args>
+    static inline AbstractNode* foldBv(AstChilds& childs, triton::uint32 size, Args... args) {
+      return triton::ast::bv(Op<triton::uint512>::run(childs, size, args...), size);
+    }
+
+
+    //! Returns the folded node of an operation, nullptr if the node must be built. `param1` and `param2` are the rotation, the extension size or the extracted bits.
+    static AbstractNode* foldNode(enum kind_e kind, AbstractNode* const* exprs, triton::uint32 count, triton::uint32 param1=0, triton::uint32 param2=0) {
+      AstChilds childs;
+      bool constant        = true;
+      triton::uint32 size  = 0;
+      AbstractNode* x      = nullptr;
+      AbstractNode* y      = nullptr;
+
+      if (count == 0 || !triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::CONSTANT_FOLDING))
+        return nullptr;
+
+      for (triton::uint32 index = 0; index < count; index++) {
+        childs.push_back(exprs[index]);
+        constant &= isBv(exprs[index]);
+      }
+
+      x    = childs[0];
+      y    = (count > 1) ? childs[1] : nullptr;
+      size = x->getBitvectorSize();
+
+      switch (kind) {
+        /* Binary operations on two bit-vectors of the same size */
+        case BVADD_NODE: case BVAND_NODE: case BVASHR_NODE: case BVLSHR_NODE: case BVMUL_NODE:
+        case BVNAND_NODE: case BVNOR_NODE: case BVOR_NODE: case BVSHL_NODE: case BVSUB_NODE:
+        case BVUDIV_NODE: case BVUREM_NODE: case BVXNOR_NODE: case BVXOR_NODE:
+          if (count != 2 || y->getBitvectorSize() != size)
+            return nullptr;
+          break;
+
+        default:
+          break;
+      }
+
+      switch (kind) {
+        case BVADD_NODE:
+          if (constant)       return foldBv<BvaddOp>(childs, size);
+          if (isBv(y, 0))     return x;
+          if (isBv(x, 0))     return y;
+          break;
+
+        case BVAND_NODE:
+          if (constant)       return foldBv<BvandOp>(childs, size);
+          if (isBv(x, 0))     return x;
+          if (isBv(y, 0))     return y;
+          if (isBv(y, x->getBitvectorMask()) || x == y) return x;
+          if (isBv(x, x->getBitvectorMask())) return y;
+          break;
+
+        case BVASHR_NODE:
+          if (constant)       return foldBv<BvashrOp>(childs, size);
+          if (isBv(y, 0))     return x;
+          break;
+
+        case BVLSHR_NODE:
+          if (constant)       return foldBv<BvlshrOp>(childs, size);
+          if (isBv(y, 0))     return x;
+          break;
+
+        case BVMUL_NODE:
+          if (constant)       return foldBv<BvmulOp>(childs, size);
+          if (isBv(x, 0))     return x;
+          if (isBv(y, 0))     return y;
+          if (isBv(y, 1))     return x;
+          if (isBv(x, 1))     return y;
+          break;
+
+        case BVOR_NODE:
+          if (constant)       return foldBv<BvorOp>(childs, size);
+          if (isBv(y, 0) || x == y) return x;
+          if (isBv(x, 0))     return y;
+          if (isBv(x, x->getBitvectorMask())) return x;
+          if (isBv(y, x->getBitvectorMask())) return y;
+          break;
+
+        case BVSHL_NODE:
+          if (constant)       return foldBv<BvshlOp>(childs, size);
+          if (isBv(y, 0))     return x;
+          break;
+
+        case BVSUB_NODE:
+          if (constant)       return foldBv<BvsubOp>(childs, size);
+          if (isBv(y, 0))     return x;
+          if (x == y)         return triton::ast::bv(0, size);
+          break;
+
+        case BVUDIV_NODE:
+          if (constant)       return foldBv<BvudivOp>(childs, size);
+          if (isBv(y, 1))     return x;
+          break;
+
+        case BVXOR_NODE:
+          if (constant)       return foldBv<BvxorOp>(childs, size);
+          if (isBv(y, 0))     return x;
+          if (isBv(x, 0))     return y;
+          if (x == y)         return triton::ast::bv(0, size);
+          break;
+
+        case BVNAND_NODE:     if (constant) return foldBv<BvnandOp>(childs, size); break;
+        case BVNEG_NODE:      if (constant) return foldBv<BvnegOp>(childs, size); break;
+        case BVNOR_NODE:      if (constant) return foldBv<BvnorOp>(childs, size); break;
+        case BVNOT_NODE:      if (constant) return foldBv<BvnotOp>(childs, size); break;
+        case BVUREM_NODE:     if (constant) return foldBv<BvuremOp>(childs, size); break;
+        case BVXNOR_NODE:     if (constant) return foldBv<BvxnorOp>(childs, size); break;
+        /* The rotation is param1, the only operand is the rotated expression */
+        case BVROL_NODE:
+        case BVROR_NODE:
+          if (count != 1 || size == 0)
+            return nullptr;
+          if (param1 % size == 0)
+            return x;
+          if (constant) {
+            triton::uint32 rot = param1 % size;
+            triton::uint512 value = x->evaluate();
+            if (kind == BVROL_NODE)
+              return triton::ast::bv(((value << rot) | (value >> (size - rot))) & x->getBitvectorMask(), size);
+            return triton::ast::bv(((value >> rot) | (value << (size - rot))) & x->getBitvectorMask(), size);
+          }
+          break;
+
+        case CONCAT_NODE:
+          if (count < 2 || !constant)
+            return nullptr;
+          size = 0;
+          for (triton::uint32 index = 0; index < count; index++)
+            size += childs[index]->getBitvectorSize();
+          if (size > MAX_BITS_SUPPORTED)
+            return nullptr;
+          return foldBv<ConcatOp>(childs, size);
+
+        /* The extracted bits are param1 (high) and param2 (low) */
+        case EXTRACT_NODE:
+          if (count != 1 || param2 > param1 || param1 >= size)
+            return nullptr;
+          if (param2 == 0 && param1 == size - 1)
+            return x;
+          if (constant)
+            return foldBv<ExtractOp>(childs, (param1 - param2) + 1, param2);
+          break;
+
+        case ITE_NODE:
+          if (count != 3 || childs[1]->getBitvectorSize() != childs[2]->getBitvectorSize())
+            return nullptr;
+          if (isConstantCondition(x))
+            return x->evaluate64() ? childs[1] : childs[2];
+          if (childs[1] == childs[2])
+            return childs[1];
+          break;
+
+        /* The extension size is param1 */
+        case SX_NODE:
+        case ZX_NODE:
+          if (count != 1 || size + param1 > MAX_BITS_SUPPORTED)
+            return nullptr;
+          if (param1 == 0)
+            return x;
+          if (constant && kind == SX_NODE)
+            return foldBv<SxOp>(childs, size + param1);
+          if (constant)
+            return triton::ast::bv(x->evaluate(), size + param1);
+          break;
+
+        default:
+          break;
+      }
+
+      return nullptr;
+    }
+
+
+    //! Returns the folded node of an operation, nullptr if the node must be built.
+    static inline AbstractNode* foldNode(enum kind_e kind, std::initializer_list<AbstractNode*> exprs, triton::uint32 param1=0, triton::uint32 param2=0) {
+      return foldNode(kind, exprs.begin(), static_cast<triton::uint32>(exprs.size()), param1, param2);
+    }
+
+
+    //! Returns the folded node of an operation, nullptr if the node must be built.
+    static inline AbstractNode* foldNode(enum kind_e kind, const std::vector<AbstractNode*>& exprs) {
+      return foldNode(kind, exprs.data(), static_cast<triton::uint32>(exprs.size()));
+    }
+
+
+    //! Returns the folded node of an operation, nullptr if the node must be built.
+    static inline AbstractNode* foldNode(enum kind_e kind, const std::list<AbstractNode*>& exprs) {
+      if (!triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::CONSTANT_FOLDING))
+        return nullptr;
+      std::vector<AbstractNode*> ops(exprs.begin(), exprs.end());
+      return foldNode(kind, ops);
+    }
+
+
     AbstractNode* assert_(AbstractNode* expr) {
-      AbstractNode* node = new AssertNode(expr);
+      AbstractNode* node = findNode(ASSERT_NODE, {expr});
+      if (node != nullptr)
+        return node;
+
+      node = new AssertNode(expr);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3552,7 +4397,11 @@ namespace triton {
 
 
     AbstractNode* bv(triton::uint512 value, triton::uint32 size) {
-      AbstractNode* node = new BvNode(value, size);
+      AbstractNode* node = findBitvector(value, size);
+      if (node != nullptr)
+        return node;
+
+      node = new BvNode(value, size);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3560,7 +4409,15 @@ namespace triton {
 
 
     AbstractNode* bvadd(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvaddNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVADD_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVADD_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvaddNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3568,7 +4425,15 @@ namespace triton {
 
 
     AbstractNode* bvand(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvandNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVAND_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVAND_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvandNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3576,7 +4441,15 @@ namespace triton {
 
 
     AbstractNode* bvashr(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvashrNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVASHR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVASHR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvashrNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3584,7 +4457,11 @@ namespace triton {
 
 
     AbstractNode* bvdecl(triton::uint32 size) {
-      AbstractNode* node = new BvdeclNode(size);
+      AbstractNode* node = findNodeWithParams(BVDECL_NODE, {size}, nullptr);
+      if (node != nullptr)
+        return node;
+
+      node = new BvdeclNode(size);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3592,7 +4469,11 @@ namespace triton {
 
 
     AbstractNode* bvfalse(void) {
-      AbstractNode* node = new BvNode(0, 1);
+      AbstractNode* node = findBitvector(0, 1);
+      if (node != nullptr)
+        return node;
+
+      node = new BvNode(0, 1);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3600,7 +4481,15 @@ namespace triton {
 
 
     AbstractNode* bvlshr(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvlshrNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVLSHR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVLSHR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvlshrNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3608,7 +4497,15 @@ namespace triton {
 
 
     AbstractNode* bvmul(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvmulNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVMUL_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVMUL_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvmulNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3616,7 +4513,15 @@ namespace triton {
 
 
     AbstractNode* bvnand(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvnandNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVNAND_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVNAND_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvnandNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3624,7 +4529,15 @@ namespace triton {
 
 
     AbstractNode* bvneg(AbstractNode* expr) {
-      AbstractNode* node = new BvnegNode(expr);
+      AbstractNode* node = foldNode(BVNEG_NODE, {expr});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVNEG_NODE, {expr});
+      if (node != nullptr)
+        return node;
+
+      node = new BvnegNode(expr);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3632,7 +4545,15 @@ namespace triton {
 
 
     AbstractNode* bvnor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvnorNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVNOR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVNOR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvnorNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3640,7 +4561,15 @@ namespace triton {
 
 
     AbstractNode* bvnot(AbstractNode* expr) {
-      AbstractNode* node = new BvnotNode(expr);
+      AbstractNode* node = foldNode(BVNOT_NODE, {expr});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVNOT_NODE, {expr});
+      if (node != nullptr)
+        return node;
+
+      node = new BvnotNode(expr);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3648,7 +4577,15 @@ namespace triton {
 
 
     AbstractNode* bvor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvorNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVOR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVOR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvorNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3656,7 +4593,15 @@ namespace triton {
 
 
     AbstractNode* bvrol(triton::uint32 rot, AbstractNode* expr) {
-      AbstractNode* node = new BvrolNode(rot, expr);
+      AbstractNode* node = foldNode(BVROL_NODE, {expr}, rot);
+      if (node != nullptr)
+        return node;
+
+      node = findNodeWithParams(BVROL_NODE, {rot}, expr);
+      if (node != nullptr)
+        return node;
+
+      node = new BvrolNode(rot, expr);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3664,7 +4609,19 @@ namespace triton {
 
 
     AbstractNode* bvrol(AbstractNode* rot, AbstractNode* expr) {
-      AbstractNode* node = new BvrolNode(rot, expr);
+      AbstractNode* node = nullptr;
+
+      if (rot->getKind() == DECIMAL_NODE) {
+        node = foldNode(BVROL_NODE, {expr}, reinterpret_cast<DecimalNode*>(rot)->getValue().convert_to<triton::uint32>());
+        if (node != nullptr)
+          return node;
+      }
+
+      node = findNode(BVROL_NODE, {rot, expr});
+      if (node != nullptr)
+        return node;
+
+      node = new BvrolNode(rot, expr);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3672,7 +4629,15 @@ namespace triton {
 
 
     AbstractNode* bvror(triton::uint32 rot, AbstractNode* expr) {
-      AbstractNode* node = new BvrorNode(rot, expr);
+      AbstractNode* node = foldNode(BVROR_NODE, {expr}, rot);
+      if (node != nullptr)
+        return node;
+
+      node = findNodeWithParams(BVROR_NODE, {rot}, expr);
+      if (node != nullptr)
+        return node;
+
+      node = new BvrorNode(rot, expr);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3680,7 +4645,19 @@ namespace triton {
 
 
     AbstractNode* bvror(AbstractNode* rot, AbstractNode* expr) {
-      AbstractNode* node = new BvrorNode(rot, expr);
+      AbstractNode* node = nullptr;
+
+      if (rot->getKind() == DECIMAL_NODE) {
+        node = foldNode(BVROR_NODE, {expr}, reinterpret_cast<DecimalNode*>(rot)->getValue().convert_to<triton::uint32>());
+        if (node != nullptr)
+          return node;
+      }
+
+      node = findNode(BVROR_NODE, {rot, expr});
+      if (node != nullptr)
+        return node;
+
+      node = new BvrorNode(rot, expr);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3688,7 +4665,11 @@ namespace triton {
 
 
     AbstractNode* bvsdiv(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvsdivNode(expr1, expr2);
+      AbstractNode* node = findNode(BVSDIV_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvsdivNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3696,7 +4677,11 @@ namespace triton {
 
 
     AbstractNode* bvsge(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvsgeNode(expr1, expr2);
+      AbstractNode* node = findNode(BVSGE_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvsgeNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3704,7 +4689,11 @@ namespace triton {
 
 
     AbstractNode* bvsgt(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvsgtNode(expr1, expr2);
+      AbstractNode* node = findNode(BVSGT_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvsgtNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3712,7 +4701,15 @@ namespace triton {
 
 
     AbstractNode* bvshl(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvshlNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVSHL_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVSHL_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvshlNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3720,7 +4717,11 @@ namespace triton {
 
 
     AbstractNode* bvsle(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvsleNode(expr1, expr2);
+      AbstractNode* node = findNode(BVSLE_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvsleNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3728,7 +4729,11 @@ namespace triton {
 
 
     AbstractNode* bvslt(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvsltNode(expr1, expr2);
+      AbstractNode* node = findNode(BVSLT_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvsltNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3736,7 +4741,11 @@ namespace triton {
 
 
     AbstractNode* bvsmod(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvsmodNode(expr1, expr2);
+      AbstractNode* node = findNode(BVSMOD_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvsmodNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3744,7 +4753,11 @@ namespace triton {
 
 
     AbstractNode* bvsrem(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvsremNode(expr1, expr2);
+      AbstractNode* node = findNode(BVSREM_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvsremNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3752,7 +4765,15 @@ namespace triton {
 
 
     AbstractNode* bvsub(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvsubNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVSUB_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVSUB_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvsubNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3760,7 +4781,11 @@ namespace triton {
 
 
     AbstractNode* bvtrue(void) {
-      AbstractNode* node = new BvNode(1, 1);
+      AbstractNode* node = findBitvector(1, 1);
+      if (node != nullptr)
+        return node;
+
+      node = new BvNode(1, 1);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3768,7 +4793,15 @@ namespace triton {
 
 
     AbstractNode* bvudiv(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvudivNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVUDIV_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVUDIV_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvudivNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3776,7 +4809,11 @@ namespace triton {
 
 
     AbstractNode* bvuge(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvugeNode(expr1, expr2);
+      AbstractNode* node = findNode(BVUGE_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvugeNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3784,7 +4821,11 @@ namespace triton {
 
 
     AbstractNode* bvugt(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvugtNode(expr1, expr2);
+      AbstractNode* node = findNode(BVUGT_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvugtNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3792,7 +4833,11 @@ namespace triton {
 
 
     AbstractNode* bvule(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvuleNode(expr1, expr2);
+      AbstractNode* node = findNode(BVULE_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvuleNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3800,7 +4845,11 @@ namespace triton {
 
 
     AbstractNode* bvult(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvultNode(expr1, expr2);
+      AbstractNode* node = findNode(BVULT_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvultNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3808,7 +4857,15 @@ namespace triton {
 
 
     AbstractNode* bvurem(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvuremNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVUREM_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVUREM_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvuremNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3816,7 +4873,15 @@ namespace triton {
 
 
      AbstractNode* bvxnor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvxnorNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVXNOR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVXNOR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvxnorNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3824,7 +4889,15 @@ namespace triton {
 
 
     AbstractNode* bvxor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new BvxorNode(expr1, expr2);
+      AbstractNode* node = foldNode(BVXOR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(BVXOR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new BvxorNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3832,7 +4905,11 @@ namespace triton {
 
 
     AbstractNode* compound(std::vector<AbstractNode*> exprs) {
-      AbstractNode* node = new CompoundNode(exprs);
+      AbstractNode* node = findNode(COMPOUND_NODE, exprs);
+      if (node != nullptr)
+        return node;
+
+      node = new CompoundNode(exprs);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3840,7 +4917,15 @@ namespace triton {
 
 
     AbstractNode* concat(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new ConcatNode(expr1, expr2);
+      AbstractNode* node = foldNode(CONCAT_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(CONCAT_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new ConcatNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3848,7 +4933,15 @@ namespace triton {
 
 
     AbstractNode* concat(std::vector<AbstractNode*> exprs) {
-      AbstractNode* node = new ConcatNode(exprs);
+      AbstractNode* node = foldNode(CONCAT_NODE, exprs);
+      if (node != nullptr)
+        return node;
+
+      node = findNode(CONCAT_NODE, exprs);
+      if (node != nullptr)
+        return node;
+
+      node = new ConcatNode(exprs);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3856,7 +4949,15 @@ namespace triton {
 
 
     AbstractNode* concat(std::list<AbstractNode*> exprs) {
-      AbstractNode* node = new ConcatNode(exprs);
+      AbstractNode* node = foldNode(CONCAT_NODE, exprs);
+      if (node != nullptr)
+        return node;
+
+      node = findNode(CONCAT_NODE, exprs);
+      if (node != nullptr)
+        return node;
+
+      node = new ConcatNode(exprs);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3864,7 +4965,11 @@ namespace triton {
 
 
     AbstractNode* decimal(triton::uint512 value) {
-      AbstractNode* node = new DecimalNode(value);
+      AbstractNode* node = triton::api.lookupAstDictionaries(DECIMAL_NODE, value);
+      if (node != nullptr)
+        return node;
+
+      node = new DecimalNode(value);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3872,7 +4977,11 @@ namespace triton {
 
 
     AbstractNode* declareFunction(std::string name, AbstractNode* bvDecl) {
-      AbstractNode* node = new DeclareFunctionNode(name, bvDecl);
+      AbstractNode* node = findNodeWithName(DECLARE_FUNCTION_NODE, name, {bvDecl});
+      if (node != nullptr)
+        return node;
+
+      node = new DeclareFunctionNode(name, bvDecl);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3880,7 +4989,11 @@ namespace triton {
 
 
     AbstractNode* distinct(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new DistinctNode(expr1, expr2);
+      AbstractNode* node = findNode(DISTINCT_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new DistinctNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3888,7 +5001,11 @@ namespace triton {
 
 
     AbstractNode* equal(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new EqualNode(expr1, expr2);
+      AbstractNode* node = findNode(EQUAL_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new EqualNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3896,7 +5013,15 @@ namespace triton {
 
 
     AbstractNode* extract(triton::uint32 high, triton::uint32 low, AbstractNode* expr) {
-      AbstractNode* node = new ExtractNode(high, low, expr);
+      AbstractNode* node = foldNode(EXTRACT_NODE, {expr}, high, low);
+      if (node != nullptr)
+        return node;
+
+      node = findNode(EXTRACT_NODE, {expr}, (static_cast<triton::uint64>(high) << 32) | low);
+      if (node != nullptr)
+        return node;
+
+      node = new ExtractNode(high, low, expr);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3904,7 +5029,15 @@ namespace triton {
 
 
     AbstractNode* ite(AbstractNode* ifExpr, AbstractNode* thenExpr, AbstractNode* elseExpr) {
-      AbstractNode* node = new IteNode(ifExpr, thenExpr, elseExpr);
+      AbstractNode* node = foldNode(ITE_NODE, {ifExpr, thenExpr, elseExpr});
+      if (node != nullptr)
+        return node;
+
+      node = findNode(ITE_NODE, {ifExpr, thenExpr, elseExpr});
+      if (node != nullptr)
+        return node;
+
+      node = new IteNode(ifExpr, thenExpr, elseExpr);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3912,7 +5045,11 @@ namespace triton {
 
 
     AbstractNode* land(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new LandNode(expr1, expr2);
+      AbstractNode* node = findNode(LAND_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new LandNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3920,7 +5057,11 @@ namespace triton {
 
 
     AbstractNode* let(std::string alias, AbstractNode* expr2, AbstractNode* expr3) {
-      AbstractNode* node = new LetNode(alias, expr2, expr3);
+      AbstractNode* node = findNodeWithName(LET_NODE, alias, {expr2, expr3});
+      if (node != nullptr)
+        return node;
+
+      node = new LetNode(alias, expr2, expr3);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3928,7 +5069,11 @@ namespace triton {
 
 
     AbstractNode* lnot(AbstractNode* expr) {
-      AbstractNode* node = new LnotNode(expr);
+      AbstractNode* node = findNode(LNOT_NODE, {expr});
+      if (node != nullptr)
+        return node;
+
+      node = new LnotNode(expr);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3936,7 +5081,11 @@ namespace triton {
 
 
     AbstractNode* lor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new LorNode(expr1, expr2);
+      AbstractNode* node = findNode(LOR_NODE, {expr1, expr2});
+      if (node != nullptr)
+        return node;
+
+      node = new LorNode(expr1, expr2);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3944,7 +5093,11 @@ namespace triton {
 
 
     AbstractNode* reference(triton::__uint value) {
-      AbstractNode* node = new ReferenceNode(value);
+      AbstractNode* node = triton::api.lookupAstDictionaries(REFERENCE_NODE, triton::uint512(value));
+      if (node != nullptr)
+        return node;
+
+      node = new ReferenceNode(value);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3952,7 +5105,11 @@ namespace triton {
 
 
     AbstractNode* string(std::string value) {
-      AbstractNode* node = new StringNode(value);
+      AbstractNode* node = triton::api.lookupAstDictionaries(STRING_NODE, value);
+      if (node != nullptr)
+        return node;
+
+      node = new StringNode(value);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3960,7 +5117,15 @@ namespace triton {
 
 
     AbstractNode* sx(triton::uint32 sizeExt, AbstractNode* expr) {
-      AbstractNode* node = new SxNode(sizeExt, expr);
+      AbstractNode* node = foldNode(SX_NODE, {expr}, sizeExt);
+      if (node != nullptr)
+        return node;
+
+      node = findNode(SX_NODE, {expr}, sizeExt);
+      if (node != nullptr)
+        return node;
+
+      node = new SxNode(sizeExt, expr);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -3968,18 +5133,30 @@ namespace triton {
 
 
     AbstractNode* variable(triton::engines::symbolic::SymbolicVariable& symVar) {
-      AbstractNode* ret  = nullptr;
-      AbstractNode* node = new VariableNode(symVar);
-      if (node == nullptr)
-        throw std::runtime_error("Node builders - Not enough memory");
-      ret = triton::api.recordAstNode(node);
-      triton::api.recordVariableAstNode(symVar.getSymVarName(), ret);
-      return ret;
+      AbstractNode* node = triton::api.lookupAstDictionaries(VARIABLE_NODE, symVar.getSymVarName());
+
+      if (node == nullptr) {
+        node = new VariableNode(symVar);
+        if (node == nullptr)
+          throw std::runtime_error("Node builders - Not enough memory");
+        node = triton::api.recordAstNode(node);
+      }
+
+      triton::api.recordVariableAstNode(symVar.getSymVarName(), node);
+      return node;
     }
 
 
     AbstractNode* zx(triton::uint32 sizeExt, AbstractNode* expr) {
-      AbstractNode* node = new ZxNode(sizeExt, expr);
+      AbstractNode* node = foldNode(ZX_NODE, {expr}, sizeExt);
+      if (node != nullptr)
+        return node;
+
+      node = findNode(ZX_NODE, {expr}, sizeExt);
+      if (node != nullptr)
+        return node;
+
+      node = new ZxNode(sizeExt, expr);
       if (node == nullptr)
         throw std::runtime_error("Node builders - Not enough memory");
       return triton::api.recordAstNode(node);
@@ -4046,6 +5223,71 @@ namespace triton {
       return newNode;
     }
 
+
+    AbstractNode* newInstance(AbstractNode* node, const std::vector<AbstractNode*>& childs) {
+      switch (node->getKind()) {
+        case EXTRACT_NODE:  return newInstance(EXTRACT_NODE, childs, reinterpret_cast<ExtractNode*>(node)->getHigh(), reinterpret_cast<ExtractNode*>(node)->getLow());
+        case SX_NODE:       return newInstance(SX_NODE, childs, reinterpret_cast<SxNode*>(node)->getSizeExt());
+        case ZX_NODE:       return newInstance(ZX_NODE, childs, reinterpret_cast<ZxNode*>(node)->getSizeExt());
+        default:            return newInstance(node->getKind(), childs);
+      }
+    }
+
+
+    AbstractNode* newInstance(enum kind_e kind, const std::vector<AbstractNode*>& childs, triton::uint32 param1, triton::uint32 param2) {
+      /*
+       * Builders are used so that the node is recorded and shared like any
+       * other node. Leaves have no childs to replace and are not handled.
+       */
+      switch (kind) {
+        case ASSERT_NODE:            return assert_(childs.at(0));
+        case BVADD_NODE:             return bvadd(childs.at(0), childs.at(1));
+        case BVAND_NODE:             return bvand(childs.at(0), childs.at(1));
+        case BVASHR_NODE:            return bvashr(childs.at(0), childs.at(1));
+        case BVLSHR_NODE:            return bvlshr(childs.at(0), childs.at(1));
+        case BVMUL_NODE:             return bvmul(childs.at(0), childs.at(1));
+        case BVNAND_NODE:            return bvnand(childs.at(0), childs.at(1));
+        case BVNEG_NODE:             return bvneg(childs.at(0));
+        case BVNOR_NODE:             return bvnor(childs.at(0), childs.at(1));
+        case BVNOT_NODE:             return bvnot(childs.at(0));
+        case BVOR_NODE:              return bvor(childs.at(0), childs.at(1));
+        case BVROL_NODE:             return bvrol(childs.at(0), childs.at(1));
+        case BVROR_NODE:             return bvror(childs.at(0), childs.at(1));
+        case BVSDIV_NODE:            return bvsdiv(childs.at(0), childs.at(1));
+        case BVSGE_NODE:             return bvsge(childs.at(0), childs.at(1));
+        case BVSGT_NODE:             return bvsgt(childs.at(0), childs.at(1));
+        case BVSHL_NODE:             return bvshl(childs.at(0), childs.at(1));
+        case BVSLE_NODE:             return bvsle(childs.at(0), childs.at(1));
+        case BVSLT_NODE:             return bvslt(childs.at(0), childs.at(1));
+        case BVSMOD_NODE:            return bvsmod(childs.at(0), childs.at(1));
+        case BVSREM_NODE:            return bvsrem(childs.at(0), childs.at(1));
+        case BVSUB_NODE:             return bvsub(childs.at(0), childs.at(1));
+        case BVUDIV_NODE:            return bvudiv(childs.at(0), childs.at(1));
+        case BVUGE_NODE:             return bvuge(childs.at(0), childs.at(1));
+        case BVUGT_NODE:             return bvugt(childs.at(0), childs.at(1));
+        case BVULE_NODE:             return bvule(childs.at(0), childs.at(1));
+        case BVULT_NODE:             return bvult(childs.at(0), childs.at(1));
+        case BVUREM_NODE:            return bvurem(childs.at(0), childs.at(1));
+        case BVXNOR_NODE:            return bvxnor(childs.at(0), childs.at(1));
+        case BVXOR_NODE:             return bvxor(childs.at(0), childs.at(1));
+        case COMPOUND_NODE:          return compound(childs);
+        case CONCAT_NODE:            return concat(childs);
+        case DECLARE_FUNCTION_NODE:  return declareFunction(reinterpret_cast<StringNode*>(childs.at(0))->getValue(), childs.at(1));
+        case DISTINCT_NODE:          return distinct(childs.at(0), childs.at(1));
+        case EQUAL_NODE:             return equal(childs.at(0), childs.at(1));
+        case EXTRACT_NODE:           return extract(param1, param2, childs.at(0));
+        case ITE_NODE:               return ite(childs.at(0), childs.at(1), childs.at(2));
+        case LAND_NODE:              return land(childs.at(0), childs.at(1));
+        case LET_NODE:               return let(reinterpret_cast<StringNode*>(childs.at(0))->getValue(), childs.at(1), childs.at(2));
+        case LNOT_NODE:              return lnot(childs.at(0));
+        case LOR_NODE:               return lor(childs.at(0), childs.at(1));
+        case SX_NODE:                return sx(param1, childs.at(0));
+        case ZX_NODE:                return zx(param1, childs.at(0));
+        default:
+          throw std::invalid_argument("triton::ast::newInstance(): Invalid kind node.");
+      }
+    }
+
   }; /* ast namespace */
 }; /* triton namespace */
 
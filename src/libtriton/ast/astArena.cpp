@@ -0,0 +1,128 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#include <new>
+
+#include <astArena.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    AstArena::AstArena() {
+      for (triton::uint32 index = 0; index < ARENA_SIZE_CLASSES; index++)
+        this->freeLists[index] = nullptr;
+      this->cursor      = nullptr;
+      this->limit       = nullptr;
+      this->liveObjects = 0;
+    }
+
+
+    AstArena::~AstArena() {
+      for (std::vector<triton::uint8*>::iterator it = this->chunks.begin(); it != this->chunks.end(); it++)
+        ::operator delete(*it);
+      this->chunks.clear();
+    }
+
+
+    void AstArena::newChunk(void) {
+      triton::uint8* chunk = static_cast<triton::uint8*>(::operator new(ARENA_CHUNK_SIZE));
+      this->chunks.push_back(chunk);
+      this->cursor = chunk;
+      this->limit  = chunk + ARENA_CHUNK_SIZE;
+    }
+
+
+    void AstArena::reset(void) {
+      if (this->chunks.empty())
+        return;
+
+      for (triton::uint32 index = 1; index < this->chunks.size(); index++)
+        ::operator delete(this->chunks[index]);
+      this->chunks.resize(1);
+
+      for (triton::uint32 index = 0; index < ARENA_SIZE_CLASSES; index++)
+        this->freeLists[index] = nullptr;
+
+      this->cursor = this->chunks[0];
+      this->limit  = this->chunks[0] + ARENA_CHUNK_SIZE;
+    }
+
+
+    void* AstArena::allocate(std::size_t size) {
+      triton::uint32 sclass = static_cast<triton::uint32>((size + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT);
+      void* ptr = nullptr;
+
+      /* Big objects are not worth to be pooled */
+      if (sclass >= ARENA_SIZE_CLASSES)
+        return ::operator new(size);
+
+      /* First, try to reuse a released slot of the same size class */
+      if (this->freeLists[sclass] != nullptr) {
+        ptr = this->freeLists[sclass];
+        this->freeLists[sclass] = this->freeLists[sclass]->next;
+      }
+
+      /* Otherwise, bump the current chunk */
+      else {
+        std::size_t bytes = sclass * ARENA_ALIGNMENT;
+        if (this->cursor == nullptr || static_cast<std::size_t>(this->limit - this->cursor) < bytes)
+          this->newChunk();
+        ptr = this->cursor;
+        this->cursor += bytes;
+      }
+
+      this->liveObjects++;
+      return ptr;
+    }
+
+
+    void AstArena::release(void* ptr, std::size_t size) {
+      triton::uint32 sclass = static_cast<triton::uint32>((size + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT);
+
+      if (ptr == nullptr)
+        return;
+
+      if (sclass >= ARENA_SIZE_CLASSES) {
+        ::operator delete(ptr);
+        return;
+      }
+
+      FreeSlot* slot = static_cast<FreeSlot*>(ptr);
+      slot->next = this->freeLists[sclass];
+      this->freeLists[sclass] = slot;
+
+      /* When everything is gone, give the memory back to the system */
+      if (--this->liveObjects == 0)
+        this->reset();
+    }
+
+
+    triton::__uint AstArena::getLiveObjects(void) const {
+      return this->liveObjects;
+    }
+
+
+    triton::__uint AstArena::getReservedBytes(void) const {
+      return this->chunks.size() * ARENA_CHUNK_SIZE;
+    }
+
+
+    AstArena& AstArena::instance(void) {
+      /*
+       * The arena is never destroyed. Nodes may still be released
+       * by the destructor of the global API object at exit, so the
+       * arena must outlive every static object.
+       */
+      static AstArena* arena = new AstArena();
+      return *arena;
+    }
+
+  }; /* ast namespace */
+}; /*triton namespace */
+
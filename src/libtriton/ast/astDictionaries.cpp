@@ -13,287 +13,443 @@ namespace triton {
   namespace ast {
 
     AstDictionaries::AstDictionaries() {
-      this->allocatedNodes        = 0;
-      this->allocatedDictionaries = 0;
-
-      this->dictionaries[triton::ast::ASSERT_NODE]             = &this->assertDictionary;
-      this->dictionaries[triton::ast::BVADD_NODE]              = &this->bvaddDictionary;
-      this->dictionaries[triton::ast::BVAND_NODE]              = &this->bvandDictionary;
-      this->dictionaries[triton::ast::BVASHR_NODE]             = &this->bvashrDictionary;
-      this->dictionaries[triton::ast::BVDECL_NODE]             = &this->bvdeclDictionary;
-      this->dictionaries[triton::ast::BVLSHR_NODE]             = &this->bvlshrDictionary;
-      this->dictionaries[triton::ast::BVMUL_NODE]              = &this->bvmulDictionary;
-      this->dictionaries[triton::ast::BVNAND_NODE]             = &this->bvnandDictionary;
-      this->dictionaries[triton::ast::BVNEG_NODE]              = &this->bvnegDictionary;
-      this->dictionaries[triton::ast::BVNOR_NODE]              = &this->bvnorDictionary;
-      this->dictionaries[triton::ast::BVNOT_NODE]              = &this->bvnotDictionary;
-      this->dictionaries[triton::ast::BVOR_NODE]               = &this->bvorDictionary;
-      this->dictionaries[triton::ast::BVROL_NODE]              = &this->bvrolDictionary;
-      this->dictionaries[triton::ast::BVROR_NODE]              = &this->bvrorDictionary;
-      this->dictionaries[triton::ast::BVSDIV_NODE]             = &this->bvsdivDictionary;
-      this->dictionaries[triton::ast::BVSGE_NODE]              = &this->bvsgeDictionary;
-      this->dictionaries[triton::ast::BVSGT_NODE]              = &this->bvsgtDictionary;
-      this->dictionaries[triton::ast::BVSHL_NODE]              = &this->bvshlDictionary;
-      this->dictionaries[triton::ast::BVSLE_NODE]              = &this->bvsleDictionary;
-      this->dictionaries[triton::ast::BVSLT_NODE]              = &this->bvsltDictionary;
-      this->dictionaries[triton::ast::BVSMOD_NODE]             = &this->bvsmodDictionary;
-      this->dictionaries[triton::ast::BVSREM_NODE]             = &this->bvsremDictionary;
-      this->dictionaries[triton::ast::BVSUB_NODE]              = &this->bvsubDictionary;
-      this->dictionaries[triton::ast::BVUDIV_NODE]             = &this->bvudivDictionary;
-      this->dictionaries[triton::ast::BVUGE_NODE]              = &this->bvugeDictionary;
-      this->dictionaries[triton::ast::BVUGT_NODE]              = &this->bvugtDictionary;
-      this->dictionaries[triton::ast::BVULE_NODE]              = &this->bvuleDictionary;
-      this->dictionaries[triton::ast::BVULT_NODE]              = &this->bvultDictionary;
-      this->dictionaries[triton::ast::BVUREM_NODE]             = &this->bvuremDictionary;
-      this->dictionaries[triton::ast::BVXNOR_NODE]             = &this->bvxnorDictionary;
-      this->dictionaries[triton::ast::BVXOR_NODE]              = &this->bvxorDictionary;
-      this->dictionaries[triton::ast::BV_NODE]                 = &this->bvDictionary;
-      this->dictionaries[triton::ast::COMPOUND_NODE]           = &this->compoundDictionary;
-      this->dictionaries[triton::ast::CONCAT_NODE]             = &this->concatDictionary;
-      this->dictionaries[triton::ast::DECIMAL_NODE]            = &this->decimalDictionary;
-      this->dictionaries[triton::ast::DECLARE_FUNCTION_NODE]   = &this->declareFunctionDictionary;
-      this->dictionaries[triton::ast::DISTINCT_NODE]           = &this->distinctDictionary;
-      this->dictionaries[triton::ast::EQUAL_NODE]              = &this->equalDictionary;
-      this->dictionaries[triton::ast::EXTRACT_NODE]            = &this->extractDictionary;
-      this->dictionaries[triton::ast::ITE_NODE]                = &this->iteDictionary;
-      this->dictionaries[triton::ast::LAND_NODE]               = &this->landDictionary;
-      this->dictionaries[triton::ast::LET_NODE]                = &this->letDictionary;
-      this->dictionaries[triton::ast::LNOT_NODE]               = &this->lnotDictionary;
-      this->dictionaries[triton::ast::LOR_NODE]                = &this->lorDictionary;
-      this->dictionaries[triton::ast::REFERENCE_NODE]          = &this->referenceDictionary;
-      this->dictionaries[triton::ast::STRING_NODE]             = &this->stringDictionary;
-      this->dictionaries[triton::ast::SX_NODE]                 = &this->sxDictionary;
-      this->dictionaries[triton::ast::VARIABLE_NODE]           = &this->variableDictionary;
-      this->dictionaries[triton::ast::ZX_NODE]                 = &this->zxDictionary;
+      this->entries = 0;
+      this->hits    = 0;
+      this->misses  = 0;
     }
 
 
     AstDictionaries::~AstDictionaries() {
-      for (auto it = this->assertDictionary.begin(); it != this->assertDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvaddDictionary.begin(); it != this->bvaddDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvandDictionary.begin(); it != this->bvandDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvashrDictionary.begin(); it != this->bvashrDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvdeclDictionary.begin(); it != this->bvdeclDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvlshrDictionary.begin(); it != this->bvlshrDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvmulDictionary.begin(); it != this->bvmulDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvnandDictionary.begin(); it != this->bvnandDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvnegDictionary.begin(); it != this->bvnegDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvnorDictionary.begin(); it != this->bvnorDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvnotDictionary.begin(); it != this->bvnotDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvorDictionary.begin(); it != this->bvorDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvrolDictionary.begin(); it != this->bvrolDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvrorDictionary.begin(); it != this->bvrorDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvsdivDictionary.begin(); it != this->bvsdivDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvsgeDictionary.begin(); it != this->bvsgeDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvsgtDictionary.begin(); it != this->bvsgtDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvshlDictionary.begin(); it != this->bvshlDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvsleDictionary.begin(); it != this->bvsleDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvsltDictionary.begin(); it != this->bvsltDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvsmodDictionary.begin(); it != this->bvsmodDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvsremDictionary.begin(); it != this->bvsremDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvsubDictionary.begin(); it != this->bvsubDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvudivDictionary.begin(); it != this->bvudivDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvugeDictionary.begin(); it != this->bvugeDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvugtDictionary.begin(); it != this->bvugtDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvuleDictionary.begin(); it != this->bvuleDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvultDictionary.begin(); it != this->bvultDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvuremDictionary.begin(); it != this->bvuremDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvxnorDictionary.begin(); it != this->bvxnorDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvxorDictionary.begin(); it != this->bvxorDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->bvDictionary.begin(); it != this->bvDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->compoundDictionary.begin(); it != this->compoundDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->concatDictionary.begin(); it != this->concatDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->decimalDictionary.begin(); it != this->decimalDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->declareFunctionDictionary.begin(); it != this->declareFunctionDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->distinctDictionary.begin(); it != this->distinctDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->equalDictionary.begin(); it != this->equalDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->extractDictionary.begin(); it != this->extractDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->iteDictionary.begin(); it != this->iteDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->landDictionary.begin(); it != this->landDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->letDictionary.begin(); it != this->letDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->lnotDictionary.begin(); it != this->lnotDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->lorDictionary.begin(); it != this->lorDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->referenceDictionary.begin(); it != this->referenceDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->stringDictionary.begin(); it != this->stringDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->sxDictionary.begin(); it != this->sxDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->variableDictionary.begin(); it != this->variableDictionary.end(); it++)
-        delete it->second;
-      for (auto it = this->zxDictionary.begin(); it != this->zxDictionary.end(); it++)
-        delete it->second;
+      /* Unique nodes are owned by the garbage collector like any other node */
     }
 
 
-    triton::ast::AbstractNode* AstDictionaries::browseAstDictionaries(triton::ast::AbstractNode* node) {
-      this->allocatedNodes++;
+    triton::uint64 AstDictionaries::parametersOf(triton::ast::AbstractNode* node) {
+      switch (node->getKind()) {
+        case triton::ast::EXTRACT_NODE:
+          return (static_cast<triton::uint64>(reinterpret_cast<triton::ast::ExtractNode*>(node)->getHigh()) << 32) | reinterpret_cast<triton::ast::ExtractNode*>(node)->getLow();
+
+        case triton::ast::SX_NODE:
+          return reinterpret_cast<triton::ast::SxNode*>(node)->getSizeExt();
+
+        case triton::ast::ZX_NODE:
+          return reinterpret_cast<triton::ast::ZxNode*>(node)->getSizeExt();
+
+        default:
+          return 0;
+      }
+    }
+
+
+    triton::uint64 AstDictionaries::hashKey(triton::uint32 kind, triton::ast::AbstractNode* const* childs, triton::uint32 size, triton::uint64 params) {
+      triton::uint64 h = triton::ast::hashMix(kind);
+      for (triton::uint32 index = 0; index < size; index++)
+        h = triton::ast::hashCombine(h, reinterpret_cast<triton::__uint>(childs[index]));
+      h = triton::ast::hashCombine(h, params);
+      return triton::ast::hashCombine(h, size);
+    }
+
+
+    triton::uint64 AstDictionaries::hashKey(triton::uint32 kind, const triton::uint512& value, triton::uint32 size) {
+      return triton::ast::hashCombine(triton::ast::hashCombine(triton::ast::hashMix(kind), triton::ast::hashUint512(value)), size);
+    }
+
+
+    triton::uint64 AstDictionaries::hashKey(triton::uint32 kind, const std::string& value) {
+      return triton::ast::hashCombine(triton::ast::hashMix(kind), triton::ast::hashString(value));
+    }
+
+
+    triton::uint64 AstDictionaries::hashKey(triton::ast::AbstractNode* node) {
       triton::uint32 kind = node->getKind();
 
       switch (kind) {
+        case triton::ast::BV_NODE:
+          return AstDictionaries::hashKey(kind, reinterpret_cast<triton::ast::BvNode*>(node)->getValue(), node->getBitvectorSize());
 
-        case triton::ast::DECIMAL_NODE: {
-          auto value       = static_cast<triton::ast::DecimalNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<triton::uint512, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
+        case triton::ast::DECIMAL_NODE:
+          return AstDictionaries::hashKey(kind, reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue(), 0);
+
+        case triton::ast::REFERENCE_NODE:
+          return AstDictionaries::hashKey(kind, triton::uint512(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue()), 0);
+
+        case triton::ast::STRING_NODE:
+          return AstDictionaries::hashKey(kind, reinterpret_cast<triton::ast::StringNode*>(node)->getValue());
+
+        case triton::ast::VARIABLE_NODE:
+          return AstDictionaries::hashKey(kind, reinterpret_cast<triton::ast::VariableNode*>(node)->getValue());
+
+        default: {
+          triton::ast::AstChilds& childs = node->getChilds();
+          return AstDictionaries::hashKey(kind, childs.data(), childs.size(), AstDictionaries::parametersOf(node));
         }
+      }
+    }
 
-        case triton::ast::REFERENCE_NODE: {
-          auto value       = static_cast<triton::ast::ReferenceNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<triton::uint512, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
+
+    bool AstDictionaries::match(triton::ast::AbstractNode* node, triton::uint32 kind, triton::ast::AbstractNode* const* childs, triton::uint32 size, triton::uint64 params) {
+      triton::ast::AstChilds& nodeChilds = node->getChilds();
+
+      if (node->getKind() != kind || nodeChilds.size() != size || AstDictionaries::parametersOf(node) != params)
+        return false;
+
+      for (triton::uint32 index = 0; index < size; index++) {
+        if (nodeChilds[index] != childs[index])
+          return false;
+      }
+
+      return true;
+    }
+
+
+    bool AstDictionaries::match(triton::ast::AbstractNode* node, triton::uint32 kind, const triton::uint512& value, triton::uint32 size) {
+      if (node->getKind() != kind)
+        return false;
+
+      switch (kind) {
+        case triton::ast::BV_NODE:
+          return node->getBitvectorSize() == size && reinterpret_cast<triton::ast::BvNode*>(node)->getValue() == value;
+
+        case triton::ast::DECIMAL_NODE:
+          return reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue() == value;
+
+        case triton::ast::REFERENCE_NODE:
+          return reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue() == value;
+
+        default:
+          return false;
+      }
+    }
+
+
+    bool AstDictionaries::match(triton::ast::AbstractNode* node, triton::uint32 kind, const std::string& value) {
+      if (node->getKind() != kind)
+        return false;
+
+      switch (kind) {
+        case triton::ast::STRING_NODE:
+          return reinterpret_cast<triton::ast::StringNode*>(node)->getValue() == value;
+
+        case triton::ast::VARIABLE_NODE:
+          return reinterpret_cast<triton::ast::VariableNode*>(node)->getValue() == value;
+
+        default:
+          return false;
+      }
+    }
+
+
+    bool AstDictionaries::match(triton::ast::AbstractNode* node, triton::ast::AbstractNode* other) {
+      triton::uint32 kind = other->getKind();
+
+      switch (kind) {
+        case triton::ast::BV_NODE:
+          return AstDictionaries::match(node, kind, reinterpret_cast<triton::ast::BvNode*>(other)->getValue(), other->getBitvectorSize());
+
+        case triton::ast::DECIMAL_NODE:
+          return AstDictionaries::match(node, kind, reinterpret_cast<triton::ast::DecimalNode*>(other)->getValue(), 0);
+
+        case triton::ast::REFERENCE_NODE:
+          return AstDictionaries::match(node, kind, triton::uint512(reinterpret_cast<triton::ast::ReferenceNode*>(other)->getValue()), 0);
+
+        case triton::ast::STRING_NODE:
+          return AstDictionaries::match(node, kind, reinterpret_cast<triton::ast::StringNode*>(other)->getValue());
+
+        case triton::ast::VARIABLE_NODE:
+          return AstDictionaries::match(node, kind, reinterpret_cast<triton::ast::VariableNode*>(other)->getValue());
+
+        default: {
+          triton::ast::AstChilds& childs = other->getChilds();
+          return AstDictionaries::match(node, kind, childs.data(), childs.size(), AstDictionaries::parametersOf(other));
         }
+      }
+    }
 
-        case triton::ast::STRING_NODE: {
-          auto value       = static_cast<triton::ast::StringNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<std::string, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
+
+    void AstDictionaries::insert(triton::uint64 hash, triton::ast::AbstractNode* node) {
+      /* Keep the load factor under 70% */
+      if ((this->entries + 1) * 10 > this->table.size() * 7)
+        this->grow();
+
+      triton::__uint mask  = this->table.size() - 1;
+      triton::__uint index = static_cast<triton::__uint>(hash) & mask;
+
+      while (this->table[index].node != nullptr)
+        index = (index + 1) & mask;
+
+      this->table[index].hash = hash;
+      this->table[index].node = node;
+      this->entries++;
+    }
+
+
+    void AstDictionaries::grow(void) {
+      std::vector<Slot> old;
+      Slot empty = {0, nullptr};
+
+      old.swap(this->table);
+      this->table.resize(old.empty() ? AST_DICTIONARIES_INITIAL_CAPACITY : old.size() * 2, empty);
+      this->entries = 0;
+
+      for (std::vector<Slot>::iterator it = old.begin(); it != old.end(); it++) {
+        if (it->node != nullptr)
+          this->insert(it->hash, it->node);
+      }
+    }
+
+
+    triton::ast::AbstractNode* AstDictionaries::lookupAstDictionaries(triton::uint32 kind, triton::ast::AbstractNode* const* childs, triton::uint32 size, triton::uint64 params) {
+      if (this->table.empty()) {
+        this->misses++;
+        return nullptr;
+      }
+
+      triton::uint64 hash  = AstDictionaries::hashKey(kind, childs, size, params);
+      triton::__uint mask  = this->table.size() - 1;
+      triton::__uint index = static_cast<triton::__uint>(hash) & mask;
+
+      for (; this->table[index].node != nullptr; index = (index + 1) & mask) {
+        if (this->table[index].hash == hash && AstDictionaries::match(this->table[index].node, kind, childs, size, params)) {
+          this->hits++;
+          return this->table[index].node;
         }
+      }
 
-        case triton::ast::VARIABLE_NODE: {
-          auto value       = static_cast<triton::ast::VariableNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<std::string, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
+      this->misses++;
+      return nullptr;
+    }
+
+
+    triton::ast::AbstractNode* AstDictionaries::lookupAstDictionaries(triton::uint32 kind, const triton::uint512& value, triton::uint32 size) {
+      if (this->table.empty()) {
+        this->misses++;
+        return nullptr;
+      }
+
+      triton::uint64 hash  = AstDictionaries::hashKey(kind, value, size);
+      triton::__uint mask  = this->table.size() - 1;
+      triton::__uint index = static_cast<triton::__uint>(hash) & mask;
+
+      for (; this->table[index].node != nullptr; index = (index + 1) & mask) {
+        if (this->table[index].hash == hash && AstDictionaries::match(this->table[index].node, kind, value, size)) {
+          this->hits++;
+          return this->table[index].node;
         }
+      }
 
-        default: {
-          auto value       = node->getChilds();
-          auto dictionary  = static_cast<std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
+      this->misses++;
+      return nullptr;
+    }
+
+
+    triton::ast::AbstractNode* AstDictionaries::lookupAstDictionaries(triton::uint32 kind, const std::string& value) {
+      if (this->table.empty()) {
+        this->misses++;
+        return nullptr;
+      }
+
+      triton::uint64 hash  = AstDictionaries::hashKey(kind, value);
+      triton::__uint mask  = this->table.size() - 1;
+      triton::__uint index = static_cast<triton::__uint>(hash) & mask;
+
+      for (; this->table[index].node != nullptr; index = (index + 1) & mask) {
+        if (this->table[index].hash == hash && AstDictionaries::match(this->table[index].node, kind, value)) {
+          this->hits++;
+          return this->table[index].node;
+        }
+      }
+
+      this->misses++;
+      return nullptr;
+    }
+
+
+    triton::ast::AbstractNode* AstDictionaries::browseAstDictionaries(triton::ast::AbstractNode* node) {
+      triton::uint64 hash = AstDictionaries::hashKey(node);
+
+      /*
+       * Node builders look for the node before allocating it, so the node
+       * is usually new. Nodes built without their builder (e.g. a node
+       * built by hand from the C++ API) are still checked here.
+       */
+      if (!this->table.empty()) {
+        triton::__uint mask  = this->table.size() - 1;
+        triton::__uint index = static_cast<triton::__uint>(hash) & mask;
+
+        for (; this->table[index].node != nullptr; index = (index + 1) & mask) {
+          if (this->table[index].hash == hash && AstDictionaries::match(this->table[index].node, node)) {
             delete node;
-            return (*dictionary)[value];
+            return this->table[index].node;
           }
-          (*dictionary)[value] = node;
-          break;
         }
-
       }
 
-      this->allocatedDictionaries++;
+      this->insert(hash, node);
       return nullptr;
     }
 
 
+    void AstDictionaries::removeAstDictionaries(triton::ast::AbstractNode* node) {
+      if (this->table.empty() || node == nullptr)
+        return;
+
+      triton::__uint mask  = this->table.size() - 1;
+      triton::__uint index = static_cast<triton::__uint>(AstDictionaries::hashKey(node)) & mask;
+
+      /* Look for the node itself, an equal node is not the one to remove */
+      for (; this->table[index].node != node; index = (index + 1) & mask) {
+        if (this->table[index].node == nullptr)
+          return;
+      }
+
+      /*
+       * Backward shift deletion. The following entries of the cluster are
+       * moved into the hole unless their home slot is cyclically between
+       * the hole and their current slot, so no tombstone is needed.
+       */
+      triton::__uint next = index;
+      while (true) {
+        next = (next + 1) & mask;
+        if (this->table[next].node == nullptr)
+          break;
+
+        triton::__uint home = static_cast<triton::__uint>(this->table[next].hash) & mask;
+        bool stays = (index <= next) ? (index < home && home <= next) : (index < home || home <= next);
+        if (stays)
+          continue;
+
+        this->table[index] = this->table[next];
+        index = next;
+      }
+
+      this->table[index].hash = 0;
+      this->table[index].node = nullptr;
+      this->entries--;
+    }
+
+
     std::map<std::string, triton::uint32> AstDictionaries::getAstDictionariesStats(void) {
       std::map<std::string, triton::uint32> stats;
-      stats["assert"]                 = this->assertDictionary.size();
-      stats["bvadd"]                  = this->bvaddDictionary.size();
-      stats["bvand"]                  = this->bvandDictionary.size();
-      stats["bvashr"]                 = this->bvashrDictionary.size();
-      stats["bvdecl"]                 = this->bvdeclDictionary.size();
-      stats["bvlshr"]                 = this->bvlshrDictionary.size();
-      stats["bvmul"]                  = this->bvmulDictionary.size();
-      stats["bvnand"]                 = this->bvnandDictionary.size();
-      stats["bvneg"]                  = this->bvnegDictionary.size();
-      stats["bvnor"]                  = this->bvnorDictionary.size();
-      stats["bvnot"]                  = this->bvnotDictionary.size();
-      stats["bvor"]                   = this->bvorDictionary.size();
-      stats["bvrol"]                  = this->bvrolDictionary.size();
-      stats["bvror"]                  = this->bvrorDictionary.size();
-      stats["bvsdiv"]                 = this->bvsdivDictionary.size();
-      stats["bvsge"]                  = this->bvsgeDictionary.size();
-      stats["bvsgt"]                  = this->bvsgtDictionary.size();
-      stats["bvshl"]                  = this->bvshlDictionary.size();
-      stats["bvsle"]                  = this->bvsleDictionary.size();
-      stats["bvslt"]                  = this->bvsltDictionary.size();
-      stats["bvsmod"]                 = this->bvsmodDictionary.size();
-      stats["bvsrem"]                 = this->bvsremDictionary.size();
-      stats["bvsub"]                  = this->bvsubDictionary.size();
-      stats["bvudiv"]                 = this->bvudivDictionary.size();
-      stats["bvuge"]                  = this->bvugeDictionary.size();
-      stats["bvugt"]                  = this->bvugtDictionary.size();
-      stats["bvule"]                  = this->bvuleDictionary.size();
-      stats["bvult"]                  = this->bvultDictionary.size();
-      stats["bvurem"]                 = this->bvuremDictionary.size();
-      stats["bvxnor"]                 = this->bvxnorDictionary.size();
-      stats["bvxor"]                  = this->bvxorDictionary.size();
-      stats["bv"]                     = this->bvDictionary.size();
-      stats["compound"]               = this->compoundDictionary.size();
-      stats["concat"]                 = this->concatDictionary.size();
-      stats["decimal"]                = this->decimalDictionary.size();
-      stats["declareFunction"]        = this->declareFunctionDictionary.size();
-      stats["distinct"]               = this->distinctDictionary.size();
-      stats["equal"]                  = this->equalDictionary.size();
-      stats["extract"]                = this->extractDictionary.size();
-      stats["ite"]                    = this->iteDictionary.size();
-      stats["land"]                   = this->landDictionary.size();
-      stats["let"]                    = this->letDictionary.size();
-      stats["lnot"]                   = this->lnotDictionary.size();
-      stats["lor"]                    = this->lorDictionary.size();
-      stats["reference"]              = this->referenceDictionary.size();
-      stats["string"]                 = this->stringDictionary.size();
-      stats["sx"]                     = this->sxDictionary.size();
-      stats["variable"]               = this->variableDictionary.size();
-      stats["zx"]                     = this->zxDictionary.size();
-      stats["allocatedDictionaries"]  = this->allocatedDictionaries;
-      stats["allocatedNodes"]         = this->allocatedNodes;
+      triton::__uint lookups = this->hits + this->misses;
+
+      stats["assert"]                 = 0;
+      stats["bvadd"]                  = 0;
+      stats["bvand"]                  = 0;
+      stats["bvashr"]                 = 0;
+      stats["bvdecl"]                 = 0;
+      stats["bvlshr"]                 = 0;
+      stats["bvmul"]                  = 0;
+      stats["bvnand"]                 = 0;
+      stats["bvneg"]                  = 0;
+      stats["bvnor"]                  = 0;
+      stats["bvnot"]                  = 0;
+      stats["bvor"]                   = 0;
+      stats["bvrol"]                  = 0;
+      stats["bvror"]                  = 0;
+      stats["bvsdiv"]                 = 0;
+      stats["bvsge"]                  = 0;
+      stats["bvsgt"]                  = 0;
+      stats["bvshl"]                  = 0;
+      stats["bvsle"]                  = 0;
+      stats["bvslt"]                  = 0;
+      stats["bvsmod"]                 = 0;
+      stats["bvsrem"]                 = 0;
+      stats["bvsub"]                  = 0;
+      stats["bvudiv"]                 = 0;
+      stats["bvuge"]                  = 0;
+      stats["bvugt"]                  = 0;
+      stats["bvule"]                  = 0;
+      stats["bvult"]                  = 0;
+      stats["bvurem"]                 = 0;
+      stats["bvxnor"]                 = 0;
+      stats["bvxor"]                  = 0;
+      stats["bv"]                     = 0;
+      stats["compound"]               = 0;
+      stats["concat"]                 = 0;
+      stats["decimal"]                = 0;
+      stats["declareFunction"]        = 0;
+      stats["distinct"]               = 0;
+      stats["equal"]                  = 0;
+      stats["extract"]                = 0;
+      stats["ite"]                    = 0;
+      stats["land"]                   = 0;
+      stats["let"]                    = 0;
+      stats["lnot"]                   = 0;
+      stats["lor"]                    = 0;
+      stats["reference"]              = 0;
+      stats["string"]                 = 0;
+      stats["sx"]                     = 0;
+      stats["variable"]               = 0;
+      stats["zx"]                     = 0;
+
+      /* Count the unique nodes of each kind */
+      for (std::vector<Slot>::iterator it = this->table.begin(); it != this->table.end(); it++) {
+        if (it->node == nullptr)
+          continue;
+        switch (it->node->getKind()) {
+          case triton::ast::ASSERT_NODE:            stats["assert"]++; break;
+          case triton::ast::BVADD_NODE:             stats["bvadd"]++; break;
+          case triton::ast::BVAND_NODE:             stats["bvand"]++; break;
+          case triton::ast::BVASHR_NODE:            stats["bvashr"]++; break;
+          case triton::ast::BVDECL_NODE:            stats["bvdecl"]++; break;
+          case triton::ast::BVLSHR_NODE:            stats["bvlshr"]++; break;
+          case triton::ast::BVMUL_NODE:             stats["bvmul"]++; break;
+          case triton::ast::BVNAND_NODE:            stats["bvnand"]++; break;
+          case triton::ast::BVNEG_NODE:             stats["bvneg"]++; break;
+          case triton::ast::BVNOR_NODE:             stats["bvnor"]++; break;
+          case triton::ast::BVNOT_NODE:             stats["bvnot"]++; break;
+          case triton::ast::BVOR_NODE:              stats["bvor"]++; break;
+          case triton::ast::BVROL_NODE:             stats["bvrol"]++; break;
+          case triton::ast::BVROR_NODE:             stats["bvror"]++; break;
+          case triton::ast::BVSDIV_NODE:            stats["bvsdiv"]++; break;
+          case triton::ast::BVSGE_NODE:             stats["bvsge"]++; break;
+          case triton::ast::BVSGT_NODE:             stats["bvsgt"]++; break;
+          case triton::ast::BVSHL_NODE:             stats["bvshl"]++; break;
+          case triton::ast::BVSLE_NODE:             stats["bvsle"]++; break;
+          case triton::ast::BVSLT_NODE:             stats["bvslt"]++; break;
+          case triton::ast::BVSMOD_NODE:            stats["bvsmod"]++; break;
+          case triton::ast::BVSREM_NODE:            stats["bvsrem"]++; break;
+          case triton::ast::BVSUB_NODE:             stats["bvsub"]++; break;
+          case triton::ast::BVUDIV_NODE:            stats["bvudiv"]++; break;
+          case triton::ast::BVUGE_NODE:             stats["bvuge"]++; break;
+          case triton::ast::BVUGT_NODE:             stats["bvugt"]++; break;
+          case triton::ast::BVULE_NODE:             stats["bvule"]++; break;
+          case triton::ast::BVULT_NODE:             stats["bvult"]++; break;
+          case triton::ast::BVUREM_NODE:            stats["bvurem"]++; break;
+          case triton::ast::BVXNOR_NODE:            stats["bvxnor"]++; break;
+          case triton::ast::BVXOR_NODE:             stats["bvxor"]++; break;
+          case triton::ast::BV_NODE:                stats["bv"]++; break;
+          case triton::ast::COMPOUND_NODE:          stats["compound"]++; break;
+          case triton::ast::CONCAT_NODE:            stats["concat"]++; break;
+          case triton::ast::DECIMAL_NODE:           stats["decimal"]++; break;
+          case triton::ast::DECLARE_FUNCTION_NODE:  stats["declareFunction"]++; break;
+          case triton::ast::DISTINCT_NODE:          stats["distinct"]++; break;
+          case triton::ast::EQUAL_NODE:             stats["equal"]++; break;
+          case triton::ast::EXTRACT_NODE:           stats["extract"]++; break;
+          case triton::ast::ITE_NODE:               stats["ite"]++; break;
+          case triton::ast::LAND_NODE:              stats["land"]++; break;
+          case triton::ast::LET_NODE:               stats["let"]++; break;
+          case triton::ast::LNOT_NODE:              stats["lnot"]++; break;
+          case triton::ast::LOR_NODE:               stats["lor"]++; break;
+          case triton::ast::REFERENCE_NODE:         stats["reference"]++; break;
+          case triton::ast::STRING_NODE:            stats["string"]++; break;
+          case triton::ast::SX_NODE:                stats["sx"]++; break;
+          case triton::ast::VARIABLE_NODE:          stats["variable"]++; break;
+          case triton::ast::ZX_NODE:                stats["zx"]++; break;
+          default:
+            break;
+        }
+      }
+
+      stats["allocatedDictionaries"]  = this->entries;
+      stats["allocatedNodes"]         = this->entries;
+      stats["capacity"]               = this->table.size();
+      stats["hits"]                   = this->hits;
+      stats["misses"]                 = this->misses;
+      stats["hitRate"]                = lookups ? static_cast<triton::uint32>((static_cast<triton::uint64>(this->hits) * 100) / lookups) : 0;
+      stats["loadFactor"]             = this->table.size() ? static_cast<triton::uint32>((static_cast<triton::uint64>(this->entries) * 100) / this->table.size()) : 0;
       return stats;
     }
 
   }; /* ast namespace */
 }; /*triton namespace */
-
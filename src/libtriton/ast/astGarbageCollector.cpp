@@ -7,6 +7,7 @@
 
 #include <api.hpp>
 #include <astGarbageCollector.hpp>
+#include <astTraversal.hpp>
 
 
 
@@ -14,47 +15,176 @@ namespace triton {
   namespace ast {
 
     AstGarbageCollector::AstGarbageCollector() {
+      this->firstAllocated          = nullptr;
+      this->lastAllocated           = nullptr;
+      this->nextSerial              = 1;
+      this->numberOfAllocatedNodes  = 0;
     }
 
 
     AstGarbageCollector::~AstGarbageCollector() {
       this->freeAllAstNodes();
+
+      /* Nodes still referenced are not owned by the collector anymore */
+      while (this->firstAllocated)
+        this->unlinkAstNode(this->firstAllocated);
+      this->variableNodes.clear();
+    }
+
+
+    void AstGarbageCollector::linkAstNode(triton::ast::AbstractNode* node) {
+      node->allocSerial   = this->nextSerial++;
+      node->prevAllocated = this->lastAllocated;
+      node->nextAllocated = nullptr;
+
+      if (this->lastAllocated)
+        this->lastAllocated->nextAllocated = node;
+      else
+        this->firstAllocated = node;
+
+      this->lastAllocated = node;
+      this->numberOfAllocatedNodes++;
+    }
+
+
+    void AstGarbageCollector::unlinkAstNode(triton::ast::AbstractNode* node) {
+      /* The node is not recorded */
+      if (node->allocSerial == 0)
+        return;
+
+      if (node->prevAllocated)
+        node->prevAllocated->nextAllocated = node->nextAllocated;
+      else
+        this->firstAllocated = node->nextAllocated;
+
+      if (node->nextAllocated)
+        node->nextAllocated->prevAllocated = node->prevAllocated;
+      else
+        this->lastAllocated = node->prevAllocated;
+
+      node->allocSerial   = 0;
+      node->prevAllocated = nullptr;
+      node->nextAllocated = nullptr;
+      this->numberOfAllocatedNodes--;
+    }
+
+
+    void AstGarbageCollector::forgetAstNode(triton::ast::AbstractNode* node) {
+      /* Remove the node from the allocation list */
+      this->unlinkAstNode(node);
+
+      /* Remove the node from the global variables map */
+      if (node->getKind() == triton::ast::VARIABLE_NODE) {
+        std::map<std::string, triton::ast::AbstractNode*>::iterator it = this->variableNodes.find(reinterpret_cast<triton::ast::VariableNode*>(node)->getValue());
+        if (it != this->variableNodes.end() && it->second == node)
+          this->variableNodes.erase(it);
+      }
+
+      /* Remove the node from the dictionaries, its key is computed from its childs */
+      triton::api.removeAstDictionaries(node);
+    }
+
+
+    void AstGarbageCollector::deleteAstNodes(std::vector<triton::ast::AbstractNode*>& worklist) {
+      /* The cascade is iterative, a long chain of nodes does not blow the stack */
+      while (!worklist.empty()) {
+        triton::ast::AbstractNode* node = worklist.back();
+        worklist.pop_back();
+
+        this->forgetAstNode(node);
+
+        /* Drop the references held by the edges */
+        for (triton::uint32 index = 0; index < node->childs.size(); index++) {
+          triton::ast::AbstractNode* child = node->childs[index];
+          child->removeParent(node);
+          if (--child->references == 0)
+            worklist.push_back(child);
+        }
+        node->childs.clear();
+
+        /* Drop the reference held on the referenced expression */
+        if (node->getKind() == triton::ast::REFERENCE_NODE) {
+          triton::ast::ReferenceNode* ref = reinterpret_cast<triton::ast::ReferenceNode*>(node);
+          if (ref->target != nullptr) {
+            ref->target->removeParent(node);
+            if (--ref->target->references == 0)
+              worklist.push_back(ref->target);
+            ref->target = nullptr;
+          }
+        }
+
+        delete node;
+      }
+    }
+
+
+    void AstGarbageCollector::retainAstNode(triton::ast::AbstractNode* node) {
+      if (node != nullptr)
+        node->references++;
+    }
+
+
+    void AstGarbageCollector::releaseAstNode(triton::ast::AbstractNode* node) {
+      if (node == nullptr || node->references == 0)
+        return;
+
+      if (--node->references == 0) {
+        std::vector<triton::ast::AbstractNode*> worklist;
+        worklist.push_back(node);
+        this->deleteAstNodes(worklist);
+      }
     }
 
 
     void AstGarbageCollector::freeAllAstNodes(void) {
-      std::set<triton::ast::AbstractNode*>::iterator it;
+      std::vector<triton::ast::AbstractNode*> worklist;
 
-      for (it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++)
-        delete *it;
+      /* Only the roots are collected, their childs are freed by the cascade */
+      for (triton::ast::AbstractNode* node = this->firstAllocated; node; node = node->nextAllocated) {
+        if (node->references == 0)
+          worklist.push_back(node);
+      }
 
-      this->variableNodes.clear();
-      this->allocatedNodes.clear();
+      this->deleteAstNodes(worklist);
     }
 
 
     void AstGarbageCollector::freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes) {
+      std::vector<triton::ast::AbstractNode*> worklist;
       std::set<triton::ast::AbstractNode*>::iterator it;
+
+      /* Nodes still referenced survive, the others are freed with what they own */
       for (it = nodes.begin(); it != nodes.end(); it++) {
-        /* Remove the node from the global set */
-        this->allocatedNodes.erase(*it);
+        if ((*it)->references == 0)
+          worklist.push_back(*it);
+      }
+
+      nodes.clear();
+      this->deleteAstNodes(worklist);
+    }
+
+
+    triton::__uint AstGarbageCollector::markAstRegion(void) const {
+      return this->nextSerial;
+    }
 
-        /* Remove the node from the global variables map */
-        if ((*it)->getKind() == triton::ast::VARIABLE_NODE)
-          this->variableNodes.erase(reinterpret_cast<triton::ast::VariableNode*>(*it)->getValue());
 
-        /* Delete the node */
-        delete *it;
+    void AstGarbageCollector::freeAstRegion(triton::__uint mark) {
+      std::vector<triton::ast::AbstractNode*> worklist;
+
+      /* Nodes are linked in allocation order, so the region is the tail of the list */
+      for (triton::ast::AbstractNode* node = this->lastAllocated; node && node->allocSerial >= mark; node = node->prevAllocated) {
+        if (node->references == 0)
+          worklist.push_back(node);
       }
-      nodes.clear();
+
+      this->deleteAstNodes(worklist);
     }
 
 
     void AstGarbageCollector::extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const {
-      std::vector<triton::ast::AbstractNode*>::const_iterator it;
-      uniqueNodes.insert(root);
-      for (it = root->getChilds().begin(); it != root->getChilds().end(); it++)
-        this->extractUniqueAstNodes(uniqueNodes, *it);
+      std::vector<triton::ast::AbstractNode*> nodes = triton::ast::postOrderTraversal(root);
+      uniqueNodes.insert(nodes.begin(), nodes.end());
     }
 
 
@@ -65,10 +195,9 @@ namespace triton {
         if (ret != nullptr)
           return ret;
       }
-      else {
-        /* Record the node */
-        this->allocatedNodes.insert(node);
-      }
+
+      /* Record the node, shared or not, it is freed by the collector */
+      this->linkAstNode(node);
       return node;
     }
 
@@ -78,8 +207,16 @@ namespace triton {
     }
 
 
-    const std::set<triton::ast::AbstractNode*>& AstGarbageCollector::getAllocatedAstNodes(void) const {
-      return this->allocatedNodes;
+    std::set<triton::ast::AbstractNode*> AstGarbageCollector::getAllocatedAstNodes(void) const {
+      std::set<triton::ast::AbstractNode*> nodes;
+      for (triton::ast::AbstractNode* node = this->firstAllocated; node; node = node->nextAllocated)
+        nodes.insert(nodes.end(), node);
+      return nodes;
+    }
+
+
+    triton::__uint AstGarbageCollector::getNumberOfAllocatedAstNodes(void) const {
+      return this->numberOfAllocatedNodes;
     }
 
 
@@ -96,12 +233,20 @@ namespace triton {
 
 
     void AstGarbageCollector::setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
-        /* Remove unused nodes before the assignation */
-      for (std::set<triton::ast::AbstractNode*>::iterator it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++) {
-        if (nodes.find(*it) == nodes.end())
-          delete *it;
+      std::vector<triton::ast::AbstractNode*> worklist;
+
+      /* Remove unused nodes before the assignation */
+      for (triton::ast::AbstractNode* node = this->firstAllocated; node; node = node->nextAllocated) {
+        if (node->references == 0 && nodes.find(node) == nodes.end())
+          worklist.push_back(node);
+      }
+      this->deleteAstNodes(worklist);
+
+      /* Record nodes which are not yet recorded */
+      for (std::set<triton::ast::AbstractNode*>::const_iterator it = nodes.begin(); it != nodes.end(); it++) {
+        if ((*it)->allocSerial == 0)
+          this->linkAstNode(*it);
       }
-      this->allocatedNodes = nodes;
     }
 
 
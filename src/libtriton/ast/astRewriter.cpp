@@ -0,0 +1,985 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#include <cctype>
+#include <stdexcept>
+
+#include <astRewriter.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    //! The name of a kind in the patterns.
+    struct AstRewriteKind {
+      const char* name;
+      enum kind_e kind;
+    };
+
+
+    //! The kinds which may appear in a pattern, by their SMT name.
+    static const AstRewriteKind rewriteKinds[] = {
+      {"=",         EQUAL_NODE},
+      {"and",       LAND_NODE},
+      {"bvadd",     BVADD_NODE},
+      {"bvand",     BVAND_NODE},
+      {"bvashr",    BVASHR_NODE},
+      {"bvlshr",    BVLSHR_NODE},
+      {"bvmul",     BVMUL_NODE},
+      {"bvnand",    BVNAND_NODE},
+      {"bvneg",     BVNEG_NODE},
+      {"bvnor",     BVNOR_NODE},
+      {"bvnot",     BVNOT_NODE},
+      {"bvor",      BVOR_NODE},
+      {"bvrol",     BVROL_NODE},
+      {"bvror",     BVROR_NODE},
+      {"bvsdiv",    BVSDIV_NODE},
+      {"bvsge",     BVSGE_NODE},
+      {"bvsgt",     BVSGT_NODE},
+      {"bvshl",     BVSHL_NODE},
+      {"bvsle",     BVSLE_NODE},
+      {"bvslt",     BVSLT_NODE},
+      {"bvsmod",    BVSMOD_NODE},
+      {"bvsrem",    BVSREM_NODE},
+      {"bvsub",     BVSUB_NODE},
+      {"bvudiv",    BVUDIV_NODE},
+      {"bvuge",     BVUGE_NODE},
+      {"bvugt",     BVUGT_NODE},
+      {"bvule",     BVULE_NODE},
+      {"bvult",     BVULT_NODE},
+      {"bvurem",    BVUREM_NODE},
+      {"bvxnor",    BVXNOR_NODE},
+      {"bvxor",     BVXOR_NODE},
+      {"concat",    CONCAT_NODE},
+      {"distinct",  DISTINCT_NODE},
+      {"extract",   EXTRACT_NODE},
+      {"ite",       ITE_NODE},
+      {"not",       LNOT_NODE},
+      {"or",        LOR_NODE},
+      {"sx",        SX_NODE},
+      {"zx",        ZX_NODE},
+    };
+
+
+    //! Returns the number of parameters written before the operands of a kind.
+    static triton::uint32 getParameterCount(enum kind_e kind) {
+      switch (kind) {
+        case EXTRACT_NODE:
+          return 2;
+        case BVROL_NODE:
+        case BVROR_NODE:
+        case SX_NODE:
+        case ZX_NODE:
+          return 1;
+        default:
+          return 0;
+      }
+    }
+
+
+    //! Returns the number of operands of a kind, 0 if it is variadic.
+    static triton::uint32 getOperandCount(enum kind_e kind) {
+      switch (kind) {
+        case CONCAT_NODE:
+          return 0;
+        case BVNEG_NODE:
+        case BVNOT_NODE:
+        case BVROL_NODE:
+        case BVROR_NODE:
+        case EXTRACT_NODE:
+        case LNOT_NODE:
+        case SX_NODE:
+        case ZX_NODE:
+          return 1;
+        case ITE_NODE:
+          return 3;
+        default:
+          return 2;
+      }
+    }
+
+
+    //! Returns true if the operands of a kind may be swapped.
+    static bool isCommutative(enum kind_e kind) {
+      switch (kind) {
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVMUL_NODE:
+        case BVNAND_NODE:
+        case BVNOR_NODE:
+        case BVOR_NODE:
+        case BVXNOR_NODE:
+        case BVXOR_NODE:
+        case DISTINCT_NODE:
+        case EQUAL_NODE:
+        case LAND_NODE:
+        case LOR_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    //! Returns true if the node is a Bool term.
+    static bool isLogical(AbstractNode* node) {
+      switch (node->getKind()) {
+        case BVSGE_NODE:
+        case BVSGT_NODE:
+        case BVSLE_NODE:
+        case BVSLT_NODE:
+        case BVUGE_NODE:
+        case BVUGT_NODE:
+        case BVULE_NODE:
+        case BVULT_NODE:
+        case DISTINCT_NODE:
+        case EQUAL_NODE:
+        case LAND_NODE:
+        case LNOT_NODE:
+        case LOR_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    //! Returns true if the node is a bit-vector operation whose operands are all constants.
+    static bool isConstantOperation(AbstractNode* node) {
+      switch (node->getKind()) {
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVASHR_NODE:
+        case BVLSHR_NODE:
+        case BVMUL_NODE:
+        case BVNAND_NODE:
+        case BVNEG_NODE:
+        case BVNOR_NODE:
+        case BVNOT_NODE:
+        case BVOR_NODE:
+        case BVROL_NODE:
+        case BVROR_NODE:
+        case BVSDIV_NODE:
+        case BVSHL_NODE:
+        case BVSMOD_NODE:
+        case BVSREM_NODE:
+        case BVSUB_NODE:
+        case BVUDIV_NODE:
+        case BVUREM_NODE:
+        case BVXNOR_NODE:
+        case BVXOR_NODE:
+        case CONCAT_NODE:
+        case EXTRACT_NODE:
+        case SX_NODE:
+        case ZX_NODE:
+          break;
+        default:
+          return false;
+      }
+
+      for (AbstractNode* child : node->getChilds()) {
+        if (child->getKind() != BV_NODE && child->getKind() != DECIMAL_NODE)
+          return false;
+      }
+
+      return true;
+    }
+
+
+    //! Returns true if both nodes are the same tree. Only pointers are compared, operator== would accept two different trees with the same value and hash.
+    static inline bool isSame(AbstractNode* node1, AbstractNode* node2) {
+      return node1 == node2;
+    }
+
+
+    //! Returns the node bound to a variable.
+    static inline AbstractNode* getBoundNode(const AstRewriteBindings& bindings, char name) {
+      return bindings.nodes[name - 'a'];
+    }
+
+
+    //! Returns the value bound to a parameter.
+    static inline triton::uint32 getBoundParam(const AstRewriteBindings& bindings, char name) {
+      return bindings.params[name - 'A'];
+    }
+
+
+    //! Returns the rewritten tree of a node, nullptr if it is not in the cache.
+    static AbstractNode* lookupCache(const AstRewriteCache& cache, AbstractNode* node) {
+      auto it = cache.find(node->hash());
+      if (it != cache.end() && isSame(it->second.first, node))
+        return it->second.second;
+      return nullptr;
+    }
+
+
+
+    /* ====== Patterns */
+
+    //! Splits a pattern into parentheses and atoms.
+    static std::vector<std::string> tokenize(const std::string& text) {
+      std::vector<std::string> tokens;
+      std::string atom;
+
+      for (char c : text) {
+        if (c == '(' || c == ')' || std::isspace(static_cast<unsigned char>(c))) {
+          if (!atom.empty())
+            tokens.push_back(atom);
+          atom.clear();
+          if (!std::isspace(static_cast<unsigned char>(c)))
+            tokens.push_back(std::string(1, c));
+          continue;
+        }
+        atom += c;
+      }
+
+      if (!atom.empty())
+        tokens.push_back(atom);
+
+      return tokens;
+    }
+
+
+    //! Parses a decimal or an hexadecimal (0x) number. Returns false if the atom is not a number.
+    static bool parseNumber(const std::string& atom, triton::uint512& value) {
+      triton::uint32 base  = 10;
+      triton::uint32 index = 0;
+
+      if (atom.size() > 2 && atom[0] == '0' && (atom[1] == 'x' || atom[1] == 'X')) {
+        base  = 16;
+        index = 2;
+      }
+
+      if (index >= atom.size())
+        return false;
+
+      value = 0;
+      for (; index < atom.size(); index++) {
+        char c = static_cast<char>(std::tolower(static_cast<unsigned char>(atom[index])));
+        triton::uint32 digit = 0;
+        if (c >= '0' && c <= '9')
+          digit = c - '0';
+        else if (base == 16 && c >= 'a' && c <= 'f')
+          digit = c - 'a' + 10;
+        else
+          return false;
+        value = value * base + digit;
+      }
+
+      return true;
+    }
+
+
+    //! Parses the term starting at `tokens[pos]`. `parameter` is true if the term is a rotation, an extracted bit or an extension size.
+    static AstPatternTerm parseTerm(const std::vector<std::string>& tokens, triton::uint32& pos, bool parameter) {
+      AstPatternTerm term;
+
+      term.kind     = UNDEFINED_NODE;
+      term.value    = 0;
+      term.index    = 0;
+      term.variadic = false;
+
+      if (pos >= tokens.size())
+        throw std::runtime_error("AstRewriter::addRule(): Unexpected end of pattern.");
+
+      const std::string& token = tokens[pos++];
+
+      /* Parameters */
+      if (parameter) {
+        if (token.size() == 1 && token[0] >= 'A' && token[0] <= 'Z') {
+          term.type  = AstPatternTerm::TERM_PARAMETER;
+          term.index = token[0] - 'A';
+        }
+        else if (parseNumber(token, term.value))
+          term.type = AstPatternTerm::TERM_NUMBER;
+        else
+          throw std::runtime_error("AstRewriter::addRule(): Invalid parameter '" + token + "'.");
+        return term;
+      }
+
+      /* Operands */
+      if (token == "(") {
+        if (pos >= tokens.size())
+          throw std::runtime_error("AstRewriter::addRule(): Unexpected end of pattern.");
+
+        const std::string& name = tokens[pos++];
+        for (const AstRewriteKind& entry : rewriteKinds) {
+          if (name == entry.name)
+            term.kind = entry.kind;
+        }
+
+        if (term.kind == UNDEFINED_NODE)
+          throw std::runtime_error("AstRewriter::addRule(): Unknown operation '" + name + "'.");
+
+        term.type = AstPatternTerm::TERM_NODE;
+        for (triton::uint32 index = 0; index < getParameterCount(term.kind); index++)
+          term.childs.push_back(parseTerm(tokens, pos, true));
+
+        while (pos < tokens.size() && tokens[pos] != ")") {
+          if (tokens[pos] == "...") {
+            term.variadic = true;
+            pos++;
+            break;
+          }
+          term.childs.push_back(parseTerm(tokens, pos, false));
+        }
+
+        if (pos >= tokens.size() || tokens[pos] != ")")
+          throw std::runtime_error("AstRewriter::addRule(): Missing ')' after '" + name + "'.");
+        pos++;
+
+        triton::uint32 operands = static_cast<triton::uint32>(term.childs.size()) - getParameterCount(term.kind);
+        triton::uint32 expected = getOperandCount(term.kind);
+        if (!term.variadic && (expected ? operands != expected : operands < 2))
+          throw std::runtime_error("AstRewriter::addRule(): Wrong number of operands for '" + name + "'.");
+      }
+
+      else if (token.size() == 1 && token[0] >= 'a' && token[0] <= 'z') {
+        term.type  = AstPatternTerm::TERM_VARIABLE;
+        term.index = token[0] - 'a';
+      }
+
+      else if (token == "-1")
+        term.type = AstPatternTerm::TERM_MASK;
+
+      else if (parseNumber(token, term.value))
+        term.type = AstPatternTerm::TERM_CONSTANT;
+
+      else
+        throw std::runtime_error("AstRewriter::addRule(): Invalid term '" + token + "'.");
+
+      return term;
+    }
+
+
+    //! Parses a whole pattern.
+    static AstPatternTerm parsePattern(const std::string& text) {
+      std::vector<std::string> tokens = tokenize(text);
+      triton::uint32 pos = 0;
+
+      AstPatternTerm term = parseTerm(tokens, pos, false);
+      if (pos != tokens.size())
+        throw std::runtime_error("AstRewriter::addRule(): Unexpected '" + tokens[pos] + "' at the end of '" + text + "'.");
+
+      return term;
+    }
+
+
+    //! Collects the variables and the parameters used by a term, one bit each.
+    static void collectBindings(const AstPatternTerm& term, triton::uint32& variables, triton::uint32& params) {
+      if (term.type == AstPatternTerm::TERM_VARIABLE)
+        variables |= (1 << term.index);
+
+      if (term.type == AstPatternTerm::TERM_PARAMETER)
+        params |= (1 << term.index);
+
+      for (const AstPatternTerm& child : term.childs)
+        collectBindings(child, variables, params);
+    }
+
+
+    //! Returns true if a term is variadic somewhere.
+    static bool isVariadic(const AstPatternTerm& term) {
+      if (term.variadic)
+        return true;
+      for (const AstPatternTerm& child : term.childs) {
+        if (isVariadic(child))
+          return true;
+      }
+      return false;
+    }
+
+
+
+    /* ====== Matching */
+
+    //! The pairs of terms and nodes which remain to be matched.
+    typedef std::vector<std::pair<const AstPatternTerm*, AbstractNode*> > AstRewriteGoals;
+
+
+    //! Matches a parameter against a value.
+    static bool matchParameter(const AstPatternTerm& term, triton::uint32 value, AstRewriteBindings& bindings) {
+      if (term.type == AstPatternTerm::TERM_NUMBER)
+        return term.value == value;
+
+      triton::uint32 bit = (1 << term.index);
+      if (bindings.boundParams & bit)
+        return bindings.params[term.index] == value;
+
+      bindings.params[term.index] = value;
+      bindings.boundParams |= bit;
+      return true;
+    }
+
+
+    /*
+     * The goals are matched one at a time from a work list. For a commutative
+     * node, the rest of the list is matched with both orders of its operands,
+     * so that a variable bound in the first order does not hide a match in
+     * the second one. The recursion is bounded by the size of the pattern.
+     */
+    static bool matchGoals(AstRewriteGoals& goals, AstRewriteBindings& bindings) {
+      while (!goals.empty()) {
+        const AstPatternTerm& term = *goals.back().first;
+        AbstractNode* node         = goals.back().second;
+        goals.pop_back();
+
+        switch (term.type) {
+          case AstPatternTerm::TERM_VARIABLE:
+            if (bindings.nodes[term.index] == nullptr)
+              bindings.nodes[term.index] = node;
+            else if (!isSame(bindings.nodes[term.index], node))
+              return false;
+            break;
+
+          case AstPatternTerm::TERM_CONSTANT:
+            if (node->getKind() != BV_NODE || node->evaluate() != term.value)
+              return false;
+            break;
+
+          case AstPatternTerm::TERM_MASK:
+            if (node->getKind() != BV_NODE || node->evaluate() != node->getBitvectorMask())
+              return false;
+            break;
+
+          case AstPatternTerm::TERM_NODE: {
+            AstChilds& childs     = node->getChilds();
+            triton::uint32 params = getParameterCount(term.kind);
+            triton::uint32 first  = 0;
+
+            if (node->getKind() != term.kind)
+              return false;
+
+            switch (term.kind) {
+              case EXTRACT_NODE:
+                if (!matchParameter(term.childs[0], reinterpret_cast<ExtractNode*>(node)->getHigh(), bindings) ||
+                    !matchParameter(term.childs[1], reinterpret_cast<ExtractNode*>(node)->getLow(), bindings))
+                  return false;
+                break;
+
+              case SX_NODE:
+                if (!matchParameter(term.childs[0], reinterpret_cast<SxNode*>(node)->getSizeExt(), bindings))
+                  return false;
+                break;
+
+              case ZX_NODE:
+                if (!matchParameter(term.childs[0], reinterpret_cast<ZxNode*>(node)->getSizeExt(), bindings))
+                  return false;
+                break;
+
+              case BVROL_NODE:
+              case BVROR_NODE:
+                if (!matchParameter(term.childs[0], reinterpret_cast<DecimalNode*>(childs[0])->getValue().convert_to<triton::uint32>(), bindings))
+                  return false;
+                first = 1;
+                break;
+
+              default:
+                break;
+            }
+
+            triton::uint32 operands = static_cast<triton::uint32>(term.childs.size()) - params;
+            triton::uint32 present  = childs.size() - first;
+            if (term.variadic ? present < operands : present != operands)
+              return false;
+
+            if (operands == 2 && isCommutative(term.kind)) {
+              AstRewriteGoals swapped   = goals;
+              AstRewriteBindings saved  = bindings;
+
+              swapped.push_back(std::make_pair(&term.childs[params + 0], childs[first + 1]));
+              swapped.push_back(std::make_pair(&term.childs[params + 1], childs[first + 0]));
+              goals.push_back(std::make_pair(&term.childs[params + 0], childs[first + 0]));
+              goals.push_back(std::make_pair(&term.childs[params + 1], childs[first + 1]));
+
+              if (matchGoals(goals, bindings))
+                return true;
+
+              bindings = saved;
+              return matchGoals(swapped, bindings);
+            }
+
+            for (triton::uint32 index = 0; index < operands; index++)
+              goals.push_back(std::make_pair(&term.childs[params + index], childs[first + index]));
+            break;
+          }
+
+          default:
+            return false;
+        }
+      }
+
+      return true;
+    }
+
+
+
+    /* ====== Default rules computed by functions */
+
+    //! (extract H L x) -> x when all bits are extracted.
+    static AbstractNode* rewriteExtractFull(AbstractNode* node, const AstRewriteBindings& bindings) {
+      AbstractNode* x = getBoundNode(bindings, 'x');
+
+      if (getBoundParam(bindings, 'L') == 0 && getBoundParam(bindings, 'H') + 1 == x->getBitvectorSize())
+        return x;
+
+      return nullptr;
+    }
+
+
+    //! (extract H L (extract I J x)) -> (extract J+H J+L x)
+    static AbstractNode* rewriteExtractExtract(AbstractNode* node, const AstRewriteBindings& bindings) {
+      triton::uint32 low = getBoundParam(bindings, 'J');
+      return triton::ast::extract(low + getBoundParam(bindings, 'H'), low + getBoundParam(bindings, 'L'), getBoundNode(bindings, 'x'));
+    }
+
+
+    //! (extract H L (concat ...)) -> the part of the concatenation which holds all the extracted bits.
+    static AbstractNode* rewriteExtractConcat(AbstractNode* node, const AstRewriteBindings& bindings) {
+      AstChilds& parts      = node->getChilds()[0]->getChilds();
+      triton::uint32 high   = getBoundParam(bindings, 'H');
+      triton::uint32 low    = getBoundParam(bindings, 'L');
+      triton::uint32 offset = 0;
+
+      /* The last part holds the low bits */
+      for (triton::uint32 index = parts.size(); index > 0 && offset <= low; index--) {
+        AbstractNode* part  = parts[index - 1];
+        triton::uint32 size = part->getBitvectorSize();
+
+        if (low >= offset && high < offset + size) {
+          if (low == offset && high + 1 == offset + size)
+            return part;
+          return triton::ast::extract(high - offset, low - offset, part);
+        }
+
+        offset += size;
+      }
+
+      return nullptr;
+    }
+
+
+    //! (extract H L (zx N x)) and (extract H L (sx N x)) -> an extraction of x when the extension is not extracted.
+    static AbstractNode* rewriteExtractExtend(AbstractNode* node, const AstRewriteBindings& bindings) {
+      AbstractNode* x     = getBoundNode(bindings, 'x');
+      triton::uint32 high = getBoundParam(bindings, 'H');
+      triton::uint32 low  = getBoundParam(bindings, 'L');
+      triton::uint32 size = x->getBitvectorSize();
+
+      if (high < size) {
+        if (low == 0 && high + 1 == size)
+          return x;
+        return triton::ast::extract(high, low, x);
+      }
+
+      if (low >= size && node->getChilds()[0]->getKind() == ZX_NODE)
+        return triton::ast::bv(0, high - low + 1);
+
+      return nullptr;
+    }
+
+
+    //! (zx N (zx M x)) -> (zx N+M x), (sx N (sx M x)) -> (sx N+M x) and (sx N (zx M x)) -> (zx N+M x) with M > 0.
+    static AbstractNode* rewriteExtendExtend(AbstractNode* node, const AstRewriteBindings& bindings) {
+      AbstractNode* inner  = node->getChilds()[0];
+      triton::uint32 size  = getBoundParam(bindings, 'N') + getBoundParam(bindings, 'M');
+      AbstractNode* x      = getBoundNode(bindings, 'x');
+
+      if (inner->getKind() == ZX_NODE && (node->getKind() == ZX_NODE || getBoundParam(bindings, 'M') > 0))
+        return triton::ast::zx(size, x);
+
+      if (inner->getKind() == SX_NODE && node->getKind() == SX_NODE)
+        return triton::ast::sx(size, x);
+
+      return nullptr;
+    }
+
+
+    /*
+     * (concat ...) -> the same concatenation where the adjacent extractions of
+     * the same expression and the adjacent constants are merged. A leading
+     * zero is turned into a zero extension, as the sub-registers writes do.
+     */
+    static AbstractNode* rewriteConcat(AbstractNode* node, const AstRewriteBindings& bindings) {
+      std::vector<AbstractNode*> parts;
+      AstChilds& childs = node->getChilds();
+
+      for (AbstractNode* part : childs) {
+        if (!parts.empty()) {
+          AbstractNode* last = parts.back();
+
+          if (last->getKind() == EXTRACT_NODE && part->getKind() == EXTRACT_NODE &&
+              isSame(last->getChilds()[0], part->getChilds()[0]) &&
+              reinterpret_cast<ExtractNode*>(last)->getLow() == reinterpret_cast<ExtractNode*>(part)->getHigh() + 1) {
+            parts.back() = triton::ast::extract(reinterpret_cast<ExtractNode*>(last)->getHigh(), reinterpret_cast<ExtractNode*>(part)->getLow(), part->getChilds()[0]);
+            continue;
+          }
+
+          if (last->getKind() == BV_NODE && part->getKind() == BV_NODE) {
+            parts.back() = triton::ast::bv((last->evaluate() << part->getBitvectorSize()) | part->evaluate(), last->getBitvectorSize() + part->getBitvectorSize());
+            continue;
+          }
+        }
+        parts.push_back(part);
+      }
+
+      if (parts.size() >= 2 && parts[0]->getKind() == BV_NODE && parts[0]->evaluate() == 0) {
+        triton::uint32 size = parts[0]->getBitvectorSize();
+        parts.erase(parts.begin());
+        return triton::ast::zx(size, (parts.size() == 1) ? parts[0] : triton::ast::concat(parts));
+      }
+
+      if (parts.size() == childs.size())
+        return nullptr;
+
+      if (parts.size() == 1)
+        return parts[0];
+
+      return triton::ast::concat(parts);
+    }
+
+
+    //! (bvnot (ite c x y)) -> (ite c (bvnot x) (bvnot y)) when both branches are constants, as for the inverted flags.
+    static AbstractNode* rewriteNotIte(AbstractNode* node, const AstRewriteBindings& bindings) {
+      AbstractNode* x = getBoundNode(bindings, 'x');
+      AbstractNode* y = getBoundNode(bindings, 'y');
+
+      if (x->getKind() != BV_NODE || y->getKind() != BV_NODE)
+        return nullptr;
+
+      return triton::ast::ite(getBoundNode(bindings, 'c'), triton::ast::bvnot(x), triton::ast::bvnot(y));
+    }
+
+
+    //! A default rule whose replacement is a pattern.
+    struct AstDefaultRule {
+      const char* name;
+      const char* pattern;
+      const char* replacement;
+    };
+
+
+    //! A default rule whose replacement is computed by a function.
+    struct AstDefaultFunction {
+      const char* name;
+      const char* pattern;
+      AstRewriteFunction function;
+    };
+
+
+    //! The default rules.
+    static const AstDefaultRule defaultRules[] = {
+      /* Bitwise identities */
+      {"xor-self",        "(bvxor x x)",                    "0"},
+      {"xor-zero",        "(bvxor x 0)",                    "x"},
+      {"xor-mask",        "(bvxor x -1)",                   "(bvnot x)"},
+      {"xor-not",         "(bvxor x (bvnot x))",            "-1"},
+      {"xor-cancel",      "(bvxor (bvxor x y) y)",          "x"},
+      {"and-self",        "(bvand x x)",                    "x"},
+      {"and-zero",        "(bvand x 0)",                    "0"},
+      {"and-mask",        "(bvand x -1)",                   "x"},
+      {"and-not",         "(bvand x (bvnot x))",            "0"},
+      {"or-self",         "(bvor x x)",                     "x"},
+      {"or-zero",         "(bvor x 0)",                     "x"},
+      {"or-mask",         "(bvor x -1)",                    "-1"},
+      {"or-not",          "(bvor x (bvnot x))",             "-1"},
+      {"not-not",         "(bvnot (bvnot x))",              "x"},
+      {"shl-zero",        "(bvshl x 0)",                    "x"},
+      {"lshr-zero",       "(bvlshr x 0)",                   "x"},
+      {"ashr-zero",       "(bvashr x 0)",                   "x"},
+      {"rol-zero",        "(bvrol 0 x)",                    "x"},
+      {"ror-zero",        "(bvror 0 x)",                    "x"},
+
+      /* Arithmetic identities */
+      {"add-zero",        "(bvadd x 0)",                    "x"},
+      {"add-neg",         "(bvadd x (bvneg y))",            "(bvsub x y)"},
+      {"add-sub",         "(bvadd (bvsub x y) y)",          "x"},
+      {"sub-self",        "(bvsub x x)",                    "0"},
+      {"sub-zero",        "(bvsub x 0)",                    "x"},
+      {"sub-from-zero",   "(bvsub 0 x)",                    "(bvneg x)"},
+      {"sub-neg",         "(bvsub x (bvneg y))",            "(bvadd x y)"},
+      {"sub-add",         "(bvsub (bvadd x y) y)",          "x"},
+      {"neg-neg",         "(bvneg (bvneg x))",              "x"},
+      {"mul-zero",        "(bvmul x 0)",                    "0"},
+      {"mul-one",         "(bvmul x 1)",                    "x"},
+      {"udiv-one",        "(bvudiv x 1)",                   "x"},
+
+      /* Extensions */
+      {"zx-zero",         "(zx 0 x)",                       "x"},
+      {"sx-zero",         "(sx 0 x)",                       "x"},
+
+      /* If-then-else and conditions */
+      {"ite-same",        "(ite c x x)",                    "x"},
+      {"ite-not",         "(ite (not c) x y)",              "(ite c y x)"},
+      {"not-not-bool",    "(not (not c))",                  "c"},
+
+      /* Flags, 1 when the condition holds */
+      {"flag-true",       "(= (ite c 1 0) 1)",              "c"},
+      {"flag-false",      "(= (ite c 1 0) 0)",              "(not c)"},
+      {"flag-inv-true",   "(= (ite c 0 1) 1)",              "(not c)"},
+      {"flag-inv-false",  "(= (ite c 0 1) 0)",              "c"},
+      {"flag-xor-one",    "(bvxor (ite c 1 0) 1)",          "(ite c 0 1)"},
+      {"flag-and",        "(bvand (ite a 1 0) (ite b 1 0))", "(ite (and a b) 1 0)"},
+      {"flag-or",         "(bvor (ite a 1 0) (ite b 1 0))",  "(ite (or a b) 1 0)"},
+      {"flag-xor",        "(bvxor (ite a 1 0) (ite b 1 0))", "(ite (distinct a b) 1 0)"},
+    };
+
+
+    //! The default rules computed by functions.
+    static const AstDefaultFunction defaultFunctions[] = {
+      /* Sub-registers */
+      {"extract-full",    "(extract H L x)",                rewriteExtractFull},
+      {"extract-extract", "(extract H L (extract I J x))",  rewriteExtractExtract},
+      {"extract-concat",  "(extract H L (concat ...))",     rewriteExtractConcat},
+      {"extract-zx",      "(extract H L (zx N x))",         rewriteExtractExtend},
+      {"extract-sx",      "(extract H L (sx N x))",         rewriteExtractExtend},
+      {"zx-zx",           "(zx N (zx M x))",                rewriteExtendExtend},
+      {"sx-sx",           "(sx N (sx M x))",                rewriteExtendExtend},
+      {"sx-zx",           "(sx N (zx M x))",                rewriteExtendExtend},
+      {"concat-merge",    "(concat ...)",                   rewriteConcat},
+
+      /* Flags */
+      {"flag-not",        "(bvnot (ite c x y))",            rewriteNotIte},
+    };
+
+
+
+    /* ====== AstRewriter */
+
+    AstRewriter::AstRewriter() {
+      this->rulesByKind.resize(256);
+
+      for (const AstDefaultRule& rule : defaultRules)
+        this->addRule(rule.name, rule.pattern, rule.replacement);
+
+      for (const AstDefaultFunction& rule : defaultFunctions)
+        this->addRule(rule.name, rule.pattern, rule.function);
+    }
+
+
+    AstRewriter::~AstRewriter() {
+    }
+
+
+    void AstRewriter::addRule(const AstRewriteRule& rule) {
+      if (rule.pattern.type != AstPatternTerm::TERM_NODE)
+        throw std::runtime_error("AstRewriter::addRule(): The pattern must be an operation.");
+
+      if (static_cast<triton::uint32>(rule.pattern.kind) >= this->rulesByKind.size())
+        this->rulesByKind.resize(rule.pattern.kind + 1);
+
+      this->rulesByKind[rule.pattern.kind].push_back(static_cast<triton::uint32>(this->rules.size()));
+      this->rules.push_back(rule);
+    }
+
+
+    void AstRewriter::addRule(const std::string& name, const std::string& pattern, const std::string& replacement) {
+      AstRewriteRule rule;
+      triton::uint32 patternVariables    = 0;
+      triton::uint32 patternParams       = 0;
+      triton::uint32 replacementVariables = 0;
+      triton::uint32 replacementParams    = 0;
+
+      rule.name        = name;
+      rule.pattern     = parsePattern(pattern);
+      rule.replacement = parsePattern(replacement);
+      rule.function    = nullptr;
+
+      if (isVariadic(rule.replacement))
+        throw std::runtime_error("AstRewriter::addRule(): A replacement cannot be variadic.");
+
+      collectBindings(rule.pattern, patternVariables, patternParams);
+      collectBindings(rule.replacement, replacementVariables, replacementParams);
+
+      if ((replacementVariables & ~patternVariables) || (replacementParams & ~patternParams))
+        throw std::runtime_error("AstRewriter::addRule(): The replacement uses a variable which is not in the pattern.");
+
+      this->addRule(rule);
+    }
+
+
+    void AstRewriter::addRule(const std::string& name, const std::string& pattern, AstRewriteFunction function) {
+      AstRewriteRule rule;
+
+      if (function == nullptr)
+        throw std::runtime_error("AstRewriter::addRule(): The function cannot be null.");
+
+      rule.name     = name;
+      rule.pattern  = parsePattern(pattern);
+      rule.function = function;
+
+      this->addRule(rule);
+    }
+
+
+    void AstRewriter::clearRules(void) {
+      this->rules.clear();
+      for (std::vector<triton::uint32>& indexes : this->rulesByKind)
+        indexes.clear();
+    }
+
+
+    std::vector<std::string> AstRewriter::getRules(void) const {
+      std::vector<std::string> names;
+      for (const AstRewriteRule& rule : this->rules)
+        names.push_back(rule.name);
+      return names;
+    }
+
+
+    AbstractNode* AstRewriter::build(const AstPatternTerm& term, const AstRewriteBindings& bindings, triton::uint32 size) const {
+      switch (term.type) {
+        case AstPatternTerm::TERM_VARIABLE:
+          return bindings.nodes[term.index];
+
+        case AstPatternTerm::TERM_CONSTANT:
+          return triton::ast::bv(term.value, size);
+
+        case AstPatternTerm::TERM_MASK: {
+          triton::uint512 mask = -1;
+          return triton::ast::bv(mask >> (512 - size), size);
+        }
+
+        case AstPatternTerm::TERM_NODE: {
+          std::vector<AbstractNode*> childs;
+          triton::uint32 params     = getParameterCount(term.kind);
+          triton::uint32 values[2]  = {0, 0};
+
+          for (triton::uint32 index = 0; index < params; index++) {
+            const AstPatternTerm& param = term.childs[index];
+            values[index] = (param.type == AstPatternTerm::TERM_NUMBER) ? param.value.convert_to<triton::uint32>() : bindings.params[param.index];
+          }
+
+          if (term.kind == BVROL_NODE || term.kind == BVROR_NODE)
+            childs.push_back(triton::ast::decimal(values[0]));
+
+          for (triton::uint32 index = params; index < term.childs.size(); index++)
+            childs.push_back(this->build(term.childs[index], bindings, size));
+
+          return triton::ast::newInstance(term.kind, childs, values[0], values[1]);
+        }
+
+        default:
+          throw std::runtime_error("AstRewriter::build(): Invalid replacement.");
+      }
+    }
+
+
+    AbstractNode* AstRewriter::apply(AbstractNode* node) const {
+      triton::uint32 kind = node->getKind();
+
+      if (kind >= this->rulesByKind.size())
+        return nullptr;
+
+      for (triton::uint32 index : this->rulesByKind[kind]) {
+        const AstRewriteRule& rule = this->rules[index];
+        AstRewriteBindings bindings;
+        AstRewriteGoals goals;
+        AbstractNode* result = nullptr;
+
+        for (triton::uint32 var = 0; var < REWRITE_VARIABLES; var++)
+          bindings.nodes[var] = nullptr;
+        bindings.boundParams = 0;
+
+        goals.push_back(std::make_pair(&rule.pattern, node));
+        if (!matchGoals(goals, bindings))
+          continue;
+
+        /* A replacement which cannot be built (extraction out of range...) does not apply */
+        try {
+          if (rule.function != nullptr)
+            result = rule.function(node, bindings);
+          else
+            result = this->build(rule.replacement, bindings, node->getBitvectorSize());
+        }
+        catch (const std::exception&) {
+          result = nullptr;
+        }
+
+        if (result == nullptr || isSame(result, node))
+          continue;
+
+        if (result->getBitvectorSize() != node->getBitvectorSize() || isLogical(result) != isLogical(node))
+          continue;
+
+        return result;
+      }
+
+      return nullptr;
+    }
+
+
+    AbstractNode* AstRewriter::rewrite(AbstractNode* node) const {
+      AstRewriteCache cache;
+
+      if (node == nullptr)
+        throw std::runtime_error("AstRewriter::rewrite(): node cannot be null.");
+
+      return this->rewrite(node, cache, 0);
+    }
+
+
+    AbstractNode* AstRewriter::rewrite(AbstractNode* root, AstRewriteCache& cache, triton::uint32 depth) const {
+      /* (node, childs pushed) */
+      std::vector<std::pair<AbstractNode*, bool> > stack;
+
+      stack.push_back(std::make_pair(root, false));
+      while (!stack.empty()) {
+        AbstractNode* node = stack.back().first;
+
+        /* Shared and identical sub-trees are rewritten once */
+        if (lookupCache(cache, node) != nullptr) {
+          stack.pop_back();
+          continue;
+        }
+
+        if (!stack.back().second) {
+          stack.back().second = true;
+          for (AbstractNode* child : node->getChilds()) {
+            if (lookupCache(cache, child) == nullptr)
+              stack.push_back(std::make_pair(child, false));
+          }
+          continue;
+        }
+
+        stack.pop_back();
+
+        /* Rebuild the node on the rewritten childs */
+        std::vector<AbstractNode*> childs;
+        AbstractNode* result = node;
+        bool changed         = false;
+
+        for (AbstractNode* child : node->getChilds()) {
+          AbstractNode* rewritten = lookupCache(cache, child);
+          if (rewritten == nullptr)
+            rewritten = child;
+          changed |= (rewritten != child);
+          childs.push_back(rewritten);
+        }
+
+        if (changed)
+          result = triton::ast::newInstance(node, childs);
+
+        if (isConstantOperation(result))
+          result = triton::ast::bv(result->evaluate(), result->getBitvectorSize());
+
+        /* Apply the rules, then rewrite the new nodes of the replacement */
+        AbstractNode* next = this->apply(result);
+        if (next != nullptr)
+          result = (depth < REWRITE_MAX_STEPS) ? this->rewrite(next, cache, depth + 1) : next;
+
+        cache[node->hash()]   = std::make_pair(node, result);
+        cache[result->hash()] = std::make_pair(result, result);
+      }
+
+      AbstractNode* result = lookupCache(cache, root);
+      return (result != nullptr) ? result : root;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
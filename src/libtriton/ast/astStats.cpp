@@ -0,0 +1,239 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include <api.hpp>
+#include <astArena.hpp>
+#include <astStats.hpp>
+#include <astTraversal.hpp>
+#include <cpuSize.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* The tree size and the depth of a node */
+    typedef std::pair<triton::uint64, triton::uint32> AstShape;
+
+
+    /* Adds two tree sizes, saturates instead of wrapping */
+    static triton::uint64 addTreeSize(triton::uint64 a, triton::uint64 b) {
+      if (a > std::numeric_limits<triton::uint64>::max() - b)
+        return std::numeric_limits<triton::uint64>::max();
+      return a + b;
+    }
+
+
+    /* Returns the bytes used by a node: its arena slot, its heap childs and parents and its wide value */
+    static triton::uint64 getNodeBytes(AbstractNode* node) {
+      triton::uint64 bytes = 0;
+
+      switch (node->getKind()) {
+        case DECIMAL_NODE:    bytes = sizeof(DecimalNode); break;
+        case EXTRACT_NODE:    bytes = sizeof(ExtractNode); break;
+        case REFERENCE_NODE:  bytes = sizeof(ReferenceNode); break;
+        case STRING_NODE:     bytes = sizeof(StringNode); break;
+        case SX_NODE:         bytes = sizeof(SxNode); break;
+        case VARIABLE_NODE:   bytes = sizeof(VariableNode); break;
+        case ZX_NODE:         bytes = sizeof(ZxNode); break;
+        default:              bytes = sizeof(AbstractNode); break;
+      }
+
+      bytes  = ((bytes + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT) * ARENA_ALIGNMENT;
+      bytes += node->getChilds().getHeapSize();
+      bytes += node->getParents().getHeapSize();
+      if (node->getBitvectorSize() > QWORD_SIZE_BIT)
+        bytes += sizeof(triton::uint512);
+
+      return bytes;
+    }
+
+
+    std::string getKindName(enum kind_e kind) {
+      switch (kind) {
+        case ASSERT_NODE:            return "assert";
+        case BVADD_NODE:             return "bvadd";
+        case BVAND_NODE:             return "bvand";
+        case BVASHR_NODE:            return "bvashr";
+        case BVDECL_NODE:            return "bvdecl";
+        case BVLSHR_NODE:            return "bvlshr";
+        case BVMUL_NODE:             return "bvmul";
+        case BVNAND_NODE:            return "bvnand";
+        case BVNEG_NODE:             return "bvneg";
+        case BVNOR_NODE:             return "bvnor";
+        case BVNOT_NODE:             return "bvnot";
+        case BVOR_NODE:              return "bvor";
+        case BVROL_NODE:             return "bvrol";
+        case BVROR_NODE:             return "bvror";
+        case BVSDIV_NODE:            return "bvsdiv";
+        case BVSGE_NODE:             return "bvsge";
+        case BVSGT_NODE:             return "bvsgt";
+        case BVSHL_NODE:             return "bvshl";
+        case BVSLE_NODE:             return "bvsle";
+        case BVSLT_NODE:             return "bvslt";
+        case BVSMOD_NODE:            return "bvsmod";
+        case BVSREM_NODE:            return "bvsrem";
+        case BVSUB_NODE:             return "bvsub";
+        case BVUDIV_NODE:            return "bvudiv";
+        case BVUGE_NODE:             return "bvuge";
+        case BVUGT_NODE:             return "bvugt";
+        case BVULE_NODE:             return "bvule";
+        case BVULT_NODE:             return "bvult";
+        case BVUREM_NODE:            return "bvurem";
+        case BVXNOR_NODE:            return "bvxnor";
+        case BVXOR_NODE:             return "bvxor";
+        case BV_NODE:                return "bv";
+        case COMPOUND_NODE:          return "compound";
+        case CONCAT_NODE:            return "concat";
+        case DECIMAL_NODE:           return "decimal";
+        case DECLARE_FUNCTION_NODE:  return "declareFunction";
+        case DISTINCT_NODE:          return "distinct";
+        case EQUAL_NODE:             return "equal";
+        case EXTRACT_NODE:           return "extract";
+        case ITE_NODE:               return "ite";
+        case LAND_NODE:              return "land";
+        case LET_NODE:               return "let";
+        case LNOT_NODE:              return "lnot";
+        case LOR_NODE:               return "lor";
+        case REFERENCE_NODE:         return "reference";
+        case STRING_NODE:            return "string";
+        case SX_NODE:                return "sx";
+        case VARIABLE_NODE:          return "variable";
+        case ZX_NODE:                return "zx";
+        default:
+          throw std::runtime_error("triton::ast::getKindName(): Invalid kind of node.");
+      }
+    }
+
+
+    AstStats getAstStats(AbstractNode* node, bool unroll) {
+      return getAstStats(std::vector<AbstractNode*>(1, node), unroll);
+    }
+
+
+    AstStats getAstStats(const std::vector<AbstractNode*>& roots, bool unroll) {
+      std::unordered_map<AbstractNode*, AstShape> shapes;
+      std::unordered_set<std::string> variables;
+      std::vector<std::pair<AbstractNode*, triton::uint32> > stack;
+      AstStats stats;
+
+      stats.uniqueNodes = 0;
+      stats.treeNodes   = 0;
+      stats.depth       = 0;
+      stats.bytes       = 0;
+      stats.variables   = 0;
+
+      for (std::vector<AbstractNode*>::const_iterator it = roots.begin(); it != roots.end(); it++) {
+        if (*it == nullptr)
+          continue;
+
+        /* The shapes are shared between the roots, a node already visited is not walked again */
+        if (shapes.find(*it) == shapes.end())
+          stack.push_back(std::make_pair(*it, 0));
+
+        while (!stack.empty()) {
+          AbstractNode* node   = stack.back().first;
+          AbstractNode* dep    = nullptr;
+          triton::uint32& next = stack.back().second;
+
+          /* Look for the next dependency not visited yet */
+          if (node->getKind() == REFERENCE_NODE) {
+            if (unroll && next == 0) {
+              next++;
+              dep = reinterpret_cast<ReferenceNode*>(node)->getTarget();
+              if (dep != nullptr && shapes.find(dep) != shapes.end())
+                dep = nullptr;
+            }
+          }
+          else {
+            AstChilds& childs = node->getChilds();
+            while (dep == nullptr && next < childs.size()) {
+              if (shapes.find(childs[next]) == shapes.end())
+                dep = childs[next];
+              next++;
+            }
+          }
+
+          if (dep != nullptr) {
+            stack.push_back(std::make_pair(dep, 0));
+            continue;
+          }
+
+          /* All dependencies are visited, the node may be shared by several stack entries */
+          stack.pop_back();
+          if (shapes.find(node) != shapes.end())
+            continue;
+
+          AstShape shape(1, 1);
+          if (node->getKind() == REFERENCE_NODE) {
+            AbstractNode* target = reinterpret_cast<ReferenceNode*>(node)->getTarget();
+            if (unroll && target != nullptr)
+              shape = shapes[target];
+          }
+          else {
+            AstChilds& childs = node->getChilds();
+            for (triton::uint32 index = 0; index < childs.size(); index++) {
+              const AstShape& child = shapes[childs[index]];
+              shape.first  = addTreeSize(shape.first, child.first);
+              shape.second = std::max(shape.second, child.second + 1);
+            }
+          }
+          shapes[node] = shape;
+
+          stats.uniqueNodes++;
+          stats.bytes += getNodeBytes(node);
+          stats.kinds[getKindName(node->getKind())]++;
+          if (node->getKind() == VARIABLE_NODE)
+            variables.insert(reinterpret_cast<VariableNode*>(node)->getValue());
+        }
+
+        stats.treeNodes = addTreeSize(stats.treeNodes, shapes[*it].first);
+        stats.depth     = std::max(stats.depth, shapes[*it].second);
+      }
+
+      stats.variables = static_cast<triton::uint32>(variables.size());
+      return stats;
+    }
+
+
+    triton::uint64 getAstTreeSize(AbstractNode* node) {
+      std::unordered_map<AbstractNode*, triton::uint64> sizes;
+      std::vector<AbstractNode*> order = postOrderTraversal(node, false);
+
+      for (std::vector<AbstractNode*>::iterator it = order.begin(); it != order.end(); it++) {
+        AbstractNode* n     = *it;
+        triton::uint64 size = 1;
+
+        if (n->getKind() == REFERENCE_NODE) {
+          triton::__uint id = reinterpret_cast<ReferenceNode*>(n)->getValue();
+          /* The size of a removed expression is not recorded anymore, its AST is walked */
+          if (triton::api.isSymbolicExpressionIdExists(id))
+            size = triton::api.getSymbolicExpressionFromId(id)->getTreeSize();
+          else if (reinterpret_cast<ReferenceNode*>(n)->getTarget() != nullptr)
+            size = getAstStats(reinterpret_cast<ReferenceNode*>(n)->getTarget(), true).treeNodes;
+        }
+        else {
+          AstChilds& childs = n->getChilds();
+          for (triton::uint32 index = 0; index < childs.size(); index++)
+            size = addTreeSize(size, sizes[childs[index]]);
+        }
+
+        sizes[n] = size;
+      }
+
+      return sizes[node];
+    }
+
+  }; /* ast namespace */
+}; /*triton namespace */
@@ -0,0 +1,682 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <api.hpp>
+#include <astTape.hpp>
+#include <astTraversal.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /*
+     * The operations below follow the node evaluations of ast.cpp, bit for
+     * bit. The 128-bits domain of the nodes is not used here, values wider
+     * than 64 bits are computed in the 512-bits domain, which gives the same
+     * masked results.
+     */
+
+    //! Returns the bit-vector mask of `size` bits in the T domain.
+    template <typename T> static inline T tapeMask(triton::uint32 size);
+
+    template <> inline triton::uint64 tapeMask<triton::uint64>(triton::uint32 size) {
+      return (size >= 64) ? static_cast<triton::uint64>(-1) : ((static_cast<triton::uint64>(1) << size) - 1);
+    }
+
+    template <> inline triton::uint32 tapeMask<triton::uint32>(triton::uint32 size) {
+      return (size >= 32) ? static_cast<triton::uint32>(-1) : ((static_cast<triton::uint32>(1) << size) - 1);
+    }
+
+    template <> inline triton::uint512 tapeMask<triton::uint512>(triton::uint32 size) {
+      triton::uint512 mask = -1;
+      if (size == 0)
+        return 0;
+      return mask >> (512 - size);
+    }
+
+
+    //! The type the lanes of T are computed in. The lanes narrower than 32 bits are computed in 32 bits, as unsigned values.
+    template <typename T> struct LaneCompute { typedef T type; };
+    template <> struct LaneCompute<triton::uint8> { typedef triton::uint32 type; };
+    template <> struct LaneCompute<triton::uint16> { typedef triton::uint32 type; };
+
+
+    //! Returns the uint32 value of a shift amount, saturated to `size`.
+    template <typename T> static inline triton::uint32 tapeShift(const T& value, triton::uint32 size) {
+      if (value >= size)
+        return size;
+      return static_cast<triton::uint32>(value);
+    }
+
+
+    //! bvsdiv, bvsmod and bvsrem in the 64-bits domain.
+    static triton::uint64 signedOperation(triton::uint32 kind, triton::uint64 value1, triton::uint64 value2, triton::uint32 size) {
+      triton::uint64 mask  = tapeMask<triton::uint64>(size);
+      triton::uint32 shift = 64 - size;
+      triton::sint64 op1   = static_cast<triton::sint64>(value1 << shift) >> shift;
+      triton::sint64 op2   = static_cast<triton::sint64>(value2 << shift) >> shift;
+      triton::sint64 rem   = 0;
+
+      switch (kind) {
+        case BVSDIV_NODE:
+          if (op2 == 0)
+            return static_cast<triton::uint64>(op1 < 0 ? 1 : -1) & mask;
+          /* op1 / -1 overflows when op1 is the minimum value */
+          if (op2 == -1)
+            return (static_cast<triton::uint64>(0) - static_cast<triton::uint64>(op1)) & mask;
+          return static_cast<triton::uint64>(op1 / op2) & mask;
+
+        case BVSMOD_NODE:
+          if (op2 == 0)
+            return value1;
+          rem = (op2 == -1) ? 0 : (op1 % op2);
+          if (rem != 0 && ((rem < 0) != (op2 < 0)))
+            rem += op2;
+          return static_cast<triton::uint64>(rem) & mask;
+
+        default:
+          if (op2 == 0)
+            return value1;
+          if (op2 == -1)
+            return 0;
+          return static_cast<triton::uint64>(op1 % op2) & mask;
+      }
+    }
+
+
+    //! Returns the sign-extended value of a `size` bits value.
+    static inline triton::sint512 tapeSignExtend(const triton::uint512& value, triton::uint32 size) {
+      triton::sint512 result = 0;
+
+      if ((value >> (size - 1)) & 1) {
+        result = -1;
+        result = ((result << size) | value);
+      }
+      else {
+        result = value;
+      }
+
+      return result;
+    }
+
+
+    //! bvsdiv, bvsmod and bvsrem in the 512-bits domain.
+    static triton::uint512 signedOperation(triton::uint32 kind, const triton::uint512& value1, const triton::uint512& value2, triton::uint32 size) {
+      triton::uint512 mask = tapeMask<triton::uint512>(size);
+      triton::sint512 op1  = tapeSignExtend(value1, size);
+      triton::sint512 op2  = tapeSignExtend(value2, size);
+
+      switch (kind) {
+        case BVSDIV_NODE:
+          if (op2 == 0) {
+            triton::uint512 value = (op1 < 0 ? 1 : -1);
+            return value & mask;
+          }
+          return (op1 / op2).convert_to<triton::uint512>() & mask;
+
+        case BVSMOD_NODE:
+          if (op2 == 0)
+            return value1;
+          return (((op1 % op2) + op2) % op2).convert_to<triton::uint512>() & mask;
+
+        default:
+          if (op2 == 0)
+            return value1;
+          return (op1 - ((op1 / op2) * op2)).convert_to<triton::uint512>() & mask;
+      }
+    }
+
+
+    //! Returns true if the kind of node has no operation to evaluate.
+    static inline bool isConstantKind(triton::uint32 kind) {
+      switch (kind) {
+        case ASSERT_NODE:
+        case BVDECL_NODE:
+        case BV_NODE:
+        case COMPOUND_NODE:
+        case DECIMAL_NODE:
+        case DECLARE_FUNCTION_NODE:
+        case STRING_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    //! The traversal filter of the compiler. Sub-trees without symbolic variables are folded.
+    static bool isSymbolizedNode(AbstractNode* node) {
+      return node->isSymbolized();
+    }
+
+
+    AstTape::AstTape(AbstractNode* node) {
+      std::unordered_map<AbstractNode*, TapeOperand> registers;
+      std::vector<AbstractNode*> order;
+
+      this->narrowWidth = 0;
+
+      if (node == nullptr)
+        throw std::runtime_error("AstTape::AstTape(): node cannot be null.");
+
+      order = triton::ast::postOrderTraversal(node, true, isSymbolizedNode);
+
+      for (std::vector<AbstractNode*>::iterator it = order.begin(); it != order.end(); it++) {
+        AbstractNode* current = *it;
+        triton::uint32 kind   = current->getKind();
+        TapeOperand reg;
+
+        /* Values which do not depend on the variables */
+        if (!current->isSymbolized() || isConstantKind(kind)) {
+          reg = this->newRegister(current->getBitvectorSize());
+          this->setRegister(reg, current->evaluate());
+        }
+
+        /* Inputs of the tape, initialized with the current concrete values */
+        else if (kind == VARIABLE_NODE) {
+          triton::engines::symbolic::SymbolicVariable* symVar = triton::api.getSymbolicVariableFromId(reinterpret_cast<VariableNode*>(current)->getSymVarId());
+          if (symVar == nullptr)
+            throw std::runtime_error("AstTape::AstTape(): Variable not found.");
+
+          std::map<triton::__uint, TapeOperand>::iterator var = this->variables.find(symVar->getSymVarId());
+          if (var != this->variables.end())
+            reg = var->second;
+          else {
+            reg = this->newRegister(current->getBitvectorSize());
+            this->setRegister(reg, current->evaluate());
+            this->variables[symVar->getSymVarId()] = reg;
+          }
+        }
+
+        /* Aliases share the register of their value */
+        else if (kind == REFERENCE_NODE)
+          reg = registers.at(triton::api.getAstFromId(reinterpret_cast<ReferenceNode*>(current)->getValue()));
+
+        else if (kind == LET_NODE)
+          reg = registers.at(current->getChilds()[2]);
+
+        /* Operations */
+        else {
+          AstChilds& childs = current->getChilds();
+          triton::uint32 start = (kind == BVROL_NODE || kind == BVROR_NODE) ? 1 : 0;
+          TapeInstruction insn;
+
+          insn.kind  = kind;
+          insn.size  = current->getBitvectorSize();
+          insn.width = insn.size;
+          insn.first = static_cast<triton::uint32>(this->operands.size());
+          insn.count = static_cast<triton::uint32>(childs.size()) - start;
+          insn.param = 0;
+
+          for (triton::uint32 index = start; index < childs.size(); index++) {
+            TapeOperand op = registers.at(childs[index]);
+            if (op.size > insn.width)
+              insn.width = op.size;
+            this->operands.push_back(op);
+          }
+
+          if (kind == BVROL_NODE || kind == BVROR_NODE)
+            insn.param = reinterpret_cast<DecimalNode*>(childs[0])->getValue().convert_to<triton::uint32>() % insn.size;
+
+          else if (kind == EXTRACT_NODE)
+            insn.param = reinterpret_cast<ExtractNode*>(current)->getLow();
+
+          reg = this->newRegister(insn.size);
+          insn.dst = reg.reg;
+          this->instructions.push_back(insn);
+        }
+
+        registers[current] = reg;
+      }
+
+      this->root = registers.at(node);
+    }
+
+
+    AstTape::~AstTape() {
+    }
+
+
+    TapeOperand AstTape::newRegister(triton::uint32 size) {
+      TapeOperand reg;
+
+      reg.size = size;
+      if (size > 64) {
+        reg.reg = static_cast<triton::uint32>(this->wide.size());
+        this->wide.push_back(0);
+      }
+      else {
+        reg.reg = static_cast<triton::uint32>(this->narrow.size());
+        this->narrow.push_back(0);
+        this->narrowWidth = std::max(this->narrowWidth, size);
+      }
+
+      return reg;
+    }
+
+
+    triton::uint512 AstTape::getRegister(const TapeOperand& reg) const {
+      if (reg.size > 64)
+        return this->wide[reg.reg];
+      return this->narrow[reg.reg];
+    }
+
+
+    void AstTape::setRegister(const TapeOperand& reg, const triton::uint512& value) {
+      if (reg.size > 64)
+        this->wide[reg.reg] = value;
+      else
+        this->narrow[reg.reg] = static_cast<triton::uint64>(value);
+    }
+
+
+    void AstTape::load(triton::uint64& value, triton::uint32 operand) const {
+      value = this->narrow[this->operands[operand].reg];
+    }
+
+
+    void AstTape::load(triton::uint512& value, triton::uint32 operand) const {
+      const TapeOperand& op = this->operands[operand];
+      if (op.size > 64)
+        value = this->wide[op.reg];
+      else
+        value = this->narrow[op.reg];
+    }
+
+
+    void AstTape::store(const TapeInstruction& insn, const triton::uint64& value) {
+      this->narrow[insn.dst] = value;
+    }
+
+
+    void AstTape::store(const TapeInstruction& insn, const triton::uint512& value) {
+      if (insn.size > 64)
+        this->wide[insn.dst] = value;
+      else
+        this->narrow[insn.dst] = static_cast<triton::uint64>(value);
+    }
+
+
+    template <typename T>
+    void AstTape::execute(const TapeInstruction& insn) {
+      T mask  = tapeMask<T>(insn.size);
+      T op1   = 0;
+      T op2   = 0;
+      T op3   = 0;
+      T sign  = 0;
+      T value = 0;
+      triton::uint32 opSize = this->operands[insn.first].size;
+      triton::uint32 shift  = 0;
+
+      if (insn.count > 0) this->load(op1, insn.first);
+      if (insn.count > 1) this->load(op2, insn.first + 1);
+      if (insn.count > 2) this->load(op3, insn.first + 2);
+
+      switch (insn.kind) {
+        case BVADD_NODE:  value = (op1 + op2) & mask; break;
+        case BVAND_NODE:  value = op1 & op2; break;
+        case BVMUL_NODE:  value = (op1 * op2) & mask; break;
+        case BVNAND_NODE: value = ~(op1 & op2) & mask; break;
+        case BVNEG_NODE:  value = (T(0) - op1) & mask; break;
+        case BVNOR_NODE:  value = ~(op1 | op2) & mask; break;
+        case BVNOT_NODE:  value = ~op1 & mask; break;
+        case BVOR_NODE:   value = op1 | op2; break;
+        case BVSUB_NODE:  value = (op1 - op2) & mask; break;
+        case BVXNOR_NODE: value = ~(op1 ^ op2) & mask; break;
+        case BVXOR_NODE:  value = op1 ^ op2; break;
+        case BVUDIV_NODE: value = (op2 == 0) ? mask : T(op1 / op2); break;
+        case BVUREM_NODE: value = (op2 == 0) ? op1 : T(op1 % op2); break;
+        case BVUGE_NODE:  value = (op1 >= op2); break;
+        case BVUGT_NODE:  value = (op1 > op2); break;
+        case BVULE_NODE:  value = (op1 <= op2); break;
+        case BVULT_NODE:  value = (op1 < op2); break;
+        case DISTINCT_NODE: value = (op1 != op2); break;
+        case EQUAL_NODE:  value = (op1 == op2); break;
+        case ZX_NODE:     value = op1; break;
+
+        /* Signed comparisons are unsigned comparisons with the sign bit flipped */
+        case BVSGE_NODE: sign = T(1) << (opSize - 1); value = ((op1 ^ sign) >= (op2 ^ sign)); break;
+        case BVSGT_NODE: sign = T(1) << (opSize - 1); value = ((op1 ^ sign) >  (op2 ^ sign)); break;
+        case BVSLE_NODE: sign = T(1) << (opSize - 1); value = ((op1 ^ sign) <= (op2 ^ sign)); break;
+        case BVSLT_NODE: sign = T(1) << (opSize - 1); value = ((op1 ^ sign) <  (op2 ^ sign)); break;
+
+        case BVSDIV_NODE:
+        case BVSMOD_NODE:
+        case BVSREM_NODE:
+          value = signedOperation(insn.kind, op1, op2, insn.size);
+          break;
+
+        case BVASHR_NODE:
+          shift = tapeShift<T>(op2, insn.size);
+          if (shift >= insn.size)
+            value = ((op1 >> (insn.size - 1)) & 1) ? mask : T(0);
+          else if (shift == 0)
+            value = op1;
+          else {
+            value = op1 >> shift;
+            if ((op1 >> (insn.size - 1)) & 1)
+              value = value | (mask & ~(mask >> shift));
+          }
+          break;
+
+        case BVLSHR_NODE:
+          shift = tapeShift<T>(op2, insn.size);
+          value = (shift >= insn.size) ? T(0) : T(op1 >> shift);
+          break;
+
+        case BVSHL_NODE:
+          shift = tapeShift<T>(op2, insn.size);
+          value = (shift >= insn.size) ? T(0) : T((op1 << shift) & mask);
+          break;
+
+        case BVROL_NODE:
+          value = (insn.param == 0) ? op1 : T(((op1 << insn.param) | (op1 >> (insn.size - insn.param))) & mask);
+          break;
+
+        case BVROR_NODE:
+          value = (insn.param == 0) ? op1 : T(((op1 >> insn.param) | (op1 << (insn.size - insn.param))) & mask);
+          break;
+
+        case CONCAT_NODE:
+          value = op1;
+          for (triton::uint32 index = 1; index < insn.count; index++) {
+            T part = 0;
+            this->load(part, insn.first + index);
+            value = (value << this->operands[insn.first + index].size) | part;
+          }
+          break;
+
+        case EXTRACT_NODE:
+          value = (insn.param >= opSize) ? T(0) : T((op1 >> insn.param) & mask);
+          break;
+
+        case ITE_NODE:
+          value = static_cast<triton::uint64>(op1) ? op2 : op3;
+          break;
+
+        case LAND_NODE:
+          value = static_cast<triton::uint64>(static_cast<triton::uint64>(op1) && static_cast<triton::uint64>(op2));
+          break;
+
+        case LNOT_NODE:
+          value = static_cast<triton::uint64>(!static_cast<triton::uint64>(op1));
+          break;
+
+        case LOR_NODE:
+          value = static_cast<triton::uint64>(static_cast<triton::uint64>(op1) || static_cast<triton::uint64>(op2));
+          break;
+
+        case SX_NODE:
+          if ((op1 >> (opSize - 1)) & 1)
+            op1 = op1 | ~tapeMask<T>(opSize);
+          value = op1 & mask;
+          break;
+
+        default:
+          throw std::runtime_error("AstTape::execute(): Invalid kind node.");
+      }
+
+      this->store(insn, value);
+    }
+
+
+    template <> std::vector<triton::uint8>& AstTape::getLanes<triton::uint8>(void) {
+      return this->lanes8;
+    }
+
+
+    template <> std::vector<triton::uint16>& AstTape::getLanes<triton::uint16>(void) {
+      return this->lanes16;
+    }
+
+
+    template <> std::vector<triton::uint32>& AstTape::getLanes<triton::uint32>(void) {
+      return this->lanes32;
+    }
+
+
+    template <> std::vector<triton::uint64>& AstTape::getLanes<triton::uint64>(void) {
+      return this->lanes64;
+    }
+
+
+    /*
+     * The loops below work on TAPE_LANES contiguous values of the narrowest
+     * lane type able to hold every narrow register of the tape, and have no
+     * dependency between lanes. The values are computed in LaneCompute<T>,
+     * which is never narrower than 32 bits, so the 8 and 16 bits lanes are
+     * not promoted to signed ints.
+     */
+    template <typename T> void AstTape::executeLanes(const TapeInstruction& insn) {
+      typedef typename LaneCompute<T>::type W;
+
+      std::vector<T>& lanes   = this->getLanes<T>();
+      T* dst                  = &lanes[insn.dst * TAPE_LANES];
+      const T* a              = &lanes[this->operands[insn.first].reg * TAPE_LANES];
+      const T* b              = (insn.count > 1) ? &lanes[this->operands[insn.first + 1].reg * TAPE_LANES] : a;
+      const T* c              = (insn.count > 2) ? &lanes[this->operands[insn.first + 2].reg * TAPE_LANES] : a;
+      triton::uint32 size     = insn.size;
+      triton::uint32 opSize   = this->operands[insn.first].size;
+      W mask                  = tapeMask<W>(size);
+      W opMask                = tapeMask<W>(opSize);
+      W sign                  = opSize ? (static_cast<W>(1) << (opSize - 1)) : 0;
+      triton::uint32 i        = 0;
+
+      switch (insn.kind) {
+        case BVADD_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>((W(a[i]) + W(b[i])) & mask); break;
+        case BVAND_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>(W(a[i]) & W(b[i])); break;
+        case BVMUL_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>((W(a[i]) * W(b[i])) & mask); break;
+        case BVNAND_NODE:   for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>(~(W(a[i]) & W(b[i])) & mask); break;
+        case BVNEG_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>((W(0) - W(a[i])) & mask); break;
+        case BVNOR_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>(~(W(a[i]) | W(b[i])) & mask); break;
+        case BVNOT_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>(~W(a[i]) & mask); break;
+        case BVOR_NODE:     for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>(W(a[i]) | W(b[i])); break;
+        case BVSUB_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>((W(a[i]) - W(b[i])) & mask); break;
+        case BVXNOR_NODE:   for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>(~(W(a[i]) ^ W(b[i])) & mask); break;
+        case BVXOR_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>(W(a[i]) ^ W(b[i])); break;
+        case BVUDIV_NODE:   for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>((b[i] == 0) ? mask : (W(a[i]) / W(b[i]))); break;
+        case BVUREM_NODE:   for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>((b[i] == 0) ? W(a[i]) : (W(a[i]) % W(b[i]))); break;
+        case BVUGE_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = (a[i] >= b[i]); break;
+        case BVUGT_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = (a[i] > b[i]); break;
+        case BVULE_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = (a[i] <= b[i]); break;
+        case BVULT_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = (a[i] < b[i]); break;
+        case BVSGE_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = ((W(a[i]) ^ sign) >= (W(b[i]) ^ sign)); break;
+        case BVSGT_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = ((W(a[i]) ^ sign) >  (W(b[i]) ^ sign)); break;
+        case BVSLE_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = ((W(a[i]) ^ sign) <= (W(b[i]) ^ sign)); break;
+        case BVSLT_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = ((W(a[i]) ^ sign) <  (W(b[i]) ^ sign)); break;
+        case DISTINCT_NODE: for (i = 0; i < TAPE_LANES; i++) dst[i] = (a[i] != b[i]); break;
+        case EQUAL_NODE:    for (i = 0; i < TAPE_LANES; i++) dst[i] = (a[i] == b[i]); break;
+        case ITE_NODE:      for (i = 0; i < TAPE_LANES; i++) dst[i] = a[i] ? b[i] : c[i]; break;
+        case LAND_NODE:     for (i = 0; i < TAPE_LANES; i++) dst[i] = (a[i] && b[i]); break;
+        case LNOT_NODE:     for (i = 0; i < TAPE_LANES; i++) dst[i] = !a[i]; break;
+        case LOR_NODE:      for (i = 0; i < TAPE_LANES; i++) dst[i] = (a[i] || b[i]); break;
+        case ZX_NODE:       for (i = 0; i < TAPE_LANES; i++) dst[i] = a[i]; break;
+        case SX_NODE:       for (i = 0; i < TAPE_LANES; i++) dst[i] = static_cast<T>(((W(a[i]) & sign) ? (W(a[i]) | ~opMask) : W(a[i])) & mask); break;
+
+        case BVSDIV_NODE:
+        case BVSMOD_NODE:
+        case BVSREM_NODE:
+          for (i = 0; i < TAPE_LANES; i++)
+            dst[i] = static_cast<T>(signedOperation(insn.kind, static_cast<triton::uint64>(a[i]), static_cast<triton::uint64>(b[i]), size));
+          break;
+
+        case BVASHR_NODE:
+          for (i = 0; i < TAPE_LANES; i++) {
+            W shift = (W(b[i]) >= size) ? W(size) : W(b[i]);
+            W fill  = (W(a[i]) & sign) ? mask : 0;
+            if (shift >= size)
+              dst[i] = static_cast<T>(fill);
+            else
+              dst[i] = static_cast<T>((W(a[i]) >> shift) | (fill & ~(mask >> shift)));
+          }
+          break;
+
+        case BVLSHR_NODE:
+          for (i = 0; i < TAPE_LANES; i++)
+            dst[i] = static_cast<T>((W(b[i]) >= size) ? 0 : (W(a[i]) >> b[i]));
+          break;
+
+        case BVSHL_NODE:
+          for (i = 0; i < TAPE_LANES; i++)
+            dst[i] = static_cast<T>((W(b[i]) >= size) ? 0 : ((W(a[i]) << b[i]) & mask));
+          break;
+
+        case BVROL_NODE:
+          for (i = 0; i < TAPE_LANES; i++)
+            dst[i] = static_cast<T>((insn.param == 0) ? W(a[i]) : (((W(a[i]) << insn.param) | (W(a[i]) >> (size - insn.param))) & mask));
+          break;
+
+        case BVROR_NODE:
+          for (i = 0; i < TAPE_LANES; i++)
+            dst[i] = static_cast<T>((insn.param == 0) ? W(a[i]) : (((W(a[i]) >> insn.param) | (W(a[i]) << (size - insn.param))) & mask));
+          break;
+
+        case EXTRACT_NODE:
+          for (i = 0; i < TAPE_LANES; i++)
+            dst[i] = static_cast<T>((insn.param >= opSize) ? 0 : ((W(a[i]) >> insn.param) & mask));
+          break;
+
+        case CONCAT_NODE:
+          std::copy(a, a + TAPE_LANES, dst);
+          for (triton::uint32 index = 1; index < insn.count; index++) {
+            const TapeOperand& op = this->operands[insn.first + index];
+            const T* part         = &lanes[op.reg * TAPE_LANES];
+            for (i = 0; i < TAPE_LANES; i++)
+              dst[i] = static_cast<T>((W(dst[i]) << op.size) | W(part[i]));
+          }
+          break;
+
+        default:
+          throw std::runtime_error("AstTape::executeLanes(): Invalid kind node.");
+      }
+    }
+
+
+    template <typename T> void AstTape::evaluateLanes(const std::vector<std::map<triton::__uint, triton::uint512> >& models, std::vector<triton::uint512>& results) {
+      std::map<triton::__uint, TapeOperand>::const_iterator var;
+      std::vector<T>& lanes = this->getLanes<T>();
+
+      /* Constants are spread once over the lanes */
+      lanes.resize(this->narrow.size() * TAPE_LANES);
+      for (triton::uint32 reg = 0; reg < this->narrow.size(); reg++)
+        std::fill(&lanes[reg * TAPE_LANES], &lanes[reg * TAPE_LANES] + TAPE_LANES, static_cast<T>(this->narrow[reg]));
+
+      for (triton::uint32 base = 0; base < models.size(); base += TAPE_LANES) {
+        triton::uint32 count = std::min<triton::uint32>(TAPE_LANES, static_cast<triton::uint32>(models.size()) - base);
+
+        /* Each lane starts from the current values of the variables, then takes the values of its model */
+        for (var = this->variables.begin(); var != this->variables.end(); var++)
+          std::fill(&lanes[var->second.reg * TAPE_LANES], &lanes[var->second.reg * TAPE_LANES] + TAPE_LANES, static_cast<T>(this->narrow[var->second.reg]));
+
+        for (triton::uint32 lane = 0; lane < count; lane++) {
+          const std::map<triton::__uint, triton::uint512>& model = models[base + lane];
+          for (std::map<triton::__uint, triton::uint512>::const_iterator it = model.begin(); it != model.end(); it++) {
+            var = this->variables.find(it->first);
+            if (var != this->variables.end())
+              lanes[var->second.reg * TAPE_LANES + lane] = static_cast<T>(it->second & tapeMask<triton::uint512>(var->second.size));
+          }
+        }
+
+        for (std::vector<TapeInstruction>::const_iterator it = this->instructions.begin(); it != this->instructions.end(); it++)
+          this->executeLanes<T>(*it);
+
+        for (triton::uint32 lane = 0; lane < count; lane++)
+          results.push_back(lanes[this->root.reg * TAPE_LANES + lane]);
+      }
+    }
+
+
+    std::vector<triton::__uint> AstTape::getVariables(void) const {
+      std::vector<triton::__uint> ret;
+
+      for (std::map<triton::__uint, TapeOperand>::const_iterator it = this->variables.begin(); it != this->variables.end(); it++)
+        ret.push_back(it->first);
+
+      return ret;
+    }
+
+
+    triton::uint32 AstTape::getNumberOfInstructions(void) const {
+      return static_cast<triton::uint32>(this->instructions.size());
+    }
+
+
+    bool AstTape::setVariable(triton::__uint symVarId, const triton::uint512& value) {
+      std::map<triton::__uint, TapeOperand>::const_iterator it = this->variables.find(symVarId);
+
+      if (it == this->variables.end())
+        return false;
+
+      this->setRegister(it->second, value & tapeMask<triton::uint512>(it->second.size));
+      return true;
+    }
+
+
+    triton::uint512 AstTape::evaluate(void) {
+      for (std::vector<TapeInstruction>::const_iterator it = this->instructions.begin(); it != this->instructions.end(); it++) {
+        if (it->width <= 64)
+          this->execute<triton::uint64>(*it);
+        else
+          this->execute<triton::uint512>(*it);
+      }
+
+      return this->getRegister(this->root);
+    }
+
+
+    triton::uint512 AstTape::evaluate(const std::map<triton::__uint, triton::uint512>& model) {
+      for (std::map<triton::__uint, triton::uint512>::const_iterator it = model.begin(); it != model.end(); it++)
+        this->setVariable(it->first, it->second);
+      return this->evaluate();
+    }
+
+
+    std::vector<triton::uint512> AstTape::evaluate(const std::vector<std::map<triton::__uint, triton::uint512> >& models) {
+      std::map<triton::__uint, TapeOperand>::const_iterator var;
+      std::vector<triton::uint512> results;
+
+      results.reserve(models.size());
+
+      /* Wide values are evaluated model by model, from the same variable values */
+      if (!this->wide.empty()) {
+        std::map<triton::__uint, triton::uint512> current;
+
+        for (var = this->variables.begin(); var != this->variables.end(); var++)
+          current[var->first] = this->getRegister(var->second);
+
+        for (triton::uint32 index = 0; index < models.size(); index++) {
+          for (var = this->variables.begin(); var != this->variables.end(); var++)
+            this->setRegister(var->second, current[var->first]);
+          results.push_back(this->evaluate(models[index]));
+        }
+
+        for (var = this->variables.begin(); var != this->variables.end(); var++)
+          this->setRegister(var->second, current[var->first]);
+
+        return results;
+      }
+
+      /* Narrow values are evaluated TAPE_LANES models at a time, in the narrowest lanes which hold them */
+      if (this->narrowWidth <= 8)
+        this->evaluateLanes<triton::uint8>(models, results);
+      else if (this->narrowWidth <= 16)
+        this->evaluateLanes<triton::uint16>(models, results);
+      else if (this->narrowWidth <= 32)
+        this->evaluateLanes<triton::uint32>(models, results);
+      else
+        this->evaluateLanes<triton::uint64>(models, results);
+
+      return results;
+    }
+
+  }; /* ast namespace */
+}; /*triton namespace */
@@ -0,0 +1,86 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#include <unordered_set>
+#include <utility>
+
+#include <api.hpp>
+#include <astTraversal.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Returns the AST of the expression referenced by a reference node, nullptr if the expression does not exist */
+    static AbstractNode* referencedAst(AbstractNode* node) {
+      triton::__uint id = reinterpret_cast<ReferenceNode*>(node)->getValue();
+      if (triton::api.isSymbolicExpressionIdExists(id))
+        return triton::api.getAstFromId(id);
+      return nullptr;
+    }
+
+
+    std::vector<AbstractNode*> postOrderTraversal(AbstractNode* root, bool unroll, AstTraversalFilter descend) {
+      std::unordered_set<AbstractNode*> visited;
+      std::vector<std::pair<AbstractNode*, triton::uint32> > stack;
+      std::vector<AbstractNode*> order;
+
+      if (root == nullptr)
+        return order;
+
+      /* A node is pushed once, the first time it is reached */
+      visited.insert(root);
+      stack.push_back(std::make_pair(root, 0));
+
+      while (!stack.empty()) {
+        AbstractNode* node  = stack.back().first;
+        AbstractNode* dep   = nullptr;
+        triton::uint32& next = stack.back().second;
+
+        /* Look for the next dependency not reached yet */
+        if (descend == nullptr || descend(node)) {
+          if (node->getKind() == REFERENCE_NODE) {
+            if (unroll && next == 0) {
+              next++;
+              dep = referencedAst(node);
+              if (dep != nullptr && visited.find(dep) != visited.end())
+                dep = nullptr;
+            }
+          }
+          else {
+            AstChilds& childs = node->getChilds();
+            while (dep == nullptr && next < childs.size()) {
+              if (visited.find(childs[next]) == visited.end())
+                dep = childs[next];
+              next++;
+            }
+          }
+        }
+
+        if (dep != nullptr) {
+          visited.insert(dep);
+          stack.push_back(std::make_pair(dep, 0));
+          continue;
+        }
+
+        /* All dependencies are listed */
+        order.push_back(node);
+        stack.pop_back();
+      }
+
+      return order;
+    }
+
+
+    std::vector<AbstractNode*> preOrderTraversal(AbstractNode* root, bool unroll, AstTraversalFilter descend) {
+      std::vector<AbstractNode*> order = postOrderTraversal(root, unroll, descend);
+      return std::vector<AbstractNode*>(order.rbegin(), order.rend());
+    }
+
+  }; /* ast namespace */
+}; /*triton namespace */
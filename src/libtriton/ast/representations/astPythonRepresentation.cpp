@@ -302,7 +302,7 @@ namespace triton {
 
       /* bv representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::BvNode* node) {
-        stream << node->getChilds()[0];
+        stream << std::hex << "0x" << node->getValue() << std::dec;
         return stream;
       }
 
@@ -360,14 +360,14 @@ namespace triton {
 
       /* extract representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::ExtractNode* node) {
-        triton::uint64 low = reinterpret_cast<triton::ast::DecimalNode*>(node->getChilds()[1])->getValue().convert_to<triton::uint64>();
+        triton::uint32 low = node->getLow();
 
         if (node->getBitvectorSize() == triton::api.cpuRegisterBitSize())
-          stream << node->getChilds()[2];
+          stream << node->getChilds()[0];
         else if (low == 0)
-          stream << "(" << node->getChilds()[2] << " & " << std::hex << "0x" << node->getBitvectorMask() << std::dec << ")";
+          stream << "(" << node->getChilds()[0] << " & " << std::hex << "0x" << node->getBitvectorMask() << std::dec << ")";
         else
-          stream << "((" << node->getChilds()[2] << " >> " << low << ")" << " & " << std::hex << "0x" << node->getBitvectorMask() << std::dec << ")";
+          stream << "((" << node->getChilds()[0] << " >> " << low << ")" << " & " << std::hex << "0x" << node->getBitvectorMask() << std::dec << ")";
 
         return stream;
       }
@@ -424,12 +424,12 @@ namespace triton {
 
       /* sx representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::SxNode* node) {
-        triton::uint512 extend = reinterpret_cast<triton::ast::DecimalNode*>(node->getChilds()[0])->getValue();
+        triton::uint32 extend = node->getSizeExt();
 
         if (extend)
-          stream << "sx(" << node->getChilds()[0] << ", " << node->getChilds()[1] << ")";
+          stream << "sx(" << extend << ", " << node->getChilds()[0] << ")";
         else
-          stream << node->getChilds()[1];
+          stream << node->getChilds()[0];
 
         return stream;
       }
@@ -444,7 +444,7 @@ namespace triton {
 
       /* zx representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::ZxNode* node) {
-        stream << node->getChilds()[1];
+        stream << node->getChilds()[0];
         return stream;
       }
 
@@ -5,10 +5,12 @@
 **  This program is under the terms of the LGPLv3 License.
 */
 
+#include <sstream>
 #include <stdexcept>
 
 #include <api.hpp>
 #include <astRepresentation.hpp>
+#include <astTraversal.hpp>
 
 
 
@@ -19,22 +21,28 @@ namespace triton {
       AstRepresentation::AstRepresentation() {
         /* Set the default representation */
         this->mode = triton::ast::representations::SMT_REPRESENTATION;
+        this->rendering = nullptr;
 
         /* Init representations interface */
         this->representations[triton::ast::representations::SMT_REPRESENTATION] = new triton::ast::representations::AstSmtRepresentation();
         this->representations[triton::ast::representations::PYTHON_REPRESENTATION] = new triton::ast::representations::AstPythonRepresentation();
+        this->representations[triton::ast::representations::SMT_DAG_REPRESENTATION] = new triton::ast::representations::AstSmtRepresentation();
 
         if (this->representations[triton::ast::representations::SMT_REPRESENTATION] == nullptr)
           throw std::runtime_error("AstRepresentation::AstRepresentation(): Cannot allocate a new representation instance.");
 
         if (this->representations[triton::ast::representations::PYTHON_REPRESENTATION] == nullptr)
           throw std::runtime_error("AstRepresentation::AstRepresentation(): Cannot allocate a new representation instance.");
+
+        if (this->representations[triton::ast::representations::SMT_DAG_REPRESENTATION] == nullptr)
+          throw std::runtime_error("AstRepresentation::AstRepresentation(): Cannot allocate a new representation instance.");
       }
 
 
       AstRepresentation::~AstRepresentation() {
         delete this->representations[triton::ast::representations::SMT_REPRESENTATION];
         delete this->representations[triton::ast::representations::PYTHON_REPRESENTATION];
+        delete this->representations[triton::ast::representations::SMT_DAG_REPRESENTATION];
       }
 
 
@@ -50,8 +58,177 @@ namespace triton {
       }
 
 
+      void AstRepresentation::render(Frame& frame, AbstractNode* node) {
+        std::ostringstream os;
+
+        frame.position = 0;
+        frame.next     = 0;
+
+        this->rendering = &frame;
+        try {
+          this->representations[this->mode]->print(os, node);
+        }
+        catch (...) {
+          this->rendering = nullptr;
+          throw;
+        }
+        this->rendering = nullptr;
+
+        frame.text = os.str();
+      }
+
+
       std::ostream& AstRepresentation::print(std::ostream& stream, AbstractNode* node) {
-        return this->representations[this->mode]->print(stream, node);
+        /*
+         * Called back by a representation for a child of the node being
+         * rendered. The child and the offset where it goes are only
+         * recorded, it will be rendered by printTree(). The text of a leaf
+         * may contain any byte, so the holes are not marked in the text.
+         */
+        if (this->rendering != nullptr) {
+          this->rendering->childs.push_back(node);
+          this->rendering->holes.push_back(static_cast<std::size_t>(stream.tellp()));
+          return stream;
+        }
+
+        if (this->mode == triton::ast::representations::SMT_DAG_REPRESENTATION)
+          return this->printDag(stream, node);
+
+        return this->printTree(stream, node);
+      }
+
+
+      std::ostream& AstRepresentation::printTree(std::ostream& stream, AbstractNode* node) {
+        /*
+         * Each node is rendered alone, then its text is written up to
+         * the next hole, where the matching child is rendered the same
+         * way. The frames live on the heap, so the depth of the AST is
+         * not bounded by the native stack.
+         */
+        std::vector<Frame> frames(1);
+        this->render(frames.back(), node);
+
+        while (!frames.empty()) {
+          Frame& frame = frames.back();
+
+          if (frame.next == frame.childs.size()) {
+            stream.write(frame.text.data() + frame.position, frame.text.size() - frame.position);
+            frames.pop_back();
+            continue;
+          }
+
+          std::size_t hole = frame.holes[frame.next];
+          stream.write(frame.text.data() + frame.position, hole - frame.position);
+          frame.position = hole;
+
+          /* A shared sub-tree already printed is replaced by its name */
+          AbstractNode* child = frame.childs[frame.next++];
+          std::unordered_map<AbstractNode*, std::string>::const_iterator name = this->names.find(child);
+          if (name != this->names.end()) {
+            stream << name->second;
+            continue;
+          }
+
+          frames.push_back(Frame());
+          this->render(frames.back(), child);
+        }
+
+        return stream;
+      }
+
+
+      /* Returns true if a node may be printed once and named. Leaves and commands are not worth it */
+      static bool isSharable(AbstractNode* node) {
+        switch (node->getKind()) {
+          case ASSERT_NODE:
+          case BVDECL_NODE:
+          case BV_NODE:
+          case COMPOUND_NODE:
+          case DECIMAL_NODE:
+          case DECLARE_FUNCTION_NODE:
+          case LET_NODE:
+          case REFERENCE_NODE:
+          case STRING_NODE:
+          case VARIABLE_NODE:
+            return false;
+          default:
+            return true;
+        }
+      }
+
+
+      /* Returns the SMT sort of a node */
+      static std::string getSort(AbstractNode* node) {
+        switch (node->getKind()) {
+          case BVSGE_NODE:
+          case BVSGT_NODE:
+          case BVSLE_NODE:
+          case BVSLT_NODE:
+          case BVUGE_NODE:
+          case BVUGT_NODE:
+          case BVULE_NODE:
+          case BVULT_NODE:
+          case DISTINCT_NODE:
+          case EQUAL_NODE:
+          case LAND_NODE:
+          case LNOT_NODE:
+          case LOR_NODE:
+            return "Bool";
+          default:
+            return "(_ BitVec " + std::to_string(node->getBitvectorSize()) + ")";
+        }
+      }
+
+
+      std::ostream& AstRepresentation::printDag(std::ostream& stream, AbstractNode* node) {
+        std::vector<AbstractNode*> order = triton::ast::postOrderTraversal(node, false);
+        std::unordered_map<AbstractNode*, triton::uint32> uses;
+        std::vector<AbstractNode*> shared;
+        bool commands = (node->getKind() == ASSERT_NODE);
+
+        /* Count the uses of each node by the printed tree only, the node may have other parents */
+        for (std::vector<AbstractNode*>::iterator it = order.begin(); it != order.end(); it++) {
+          AstChilds& childs = (*it)->getChilds();
+          for (triton::uint32 index = 0; index < childs.size(); index++)
+            uses[childs[index]]++;
+        }
+
+        /* The post-order puts each shared sub-tree after the shared sub-trees it uses */
+        for (std::vector<AbstractNode*>::iterator it = order.begin(); it != order.end(); it++) {
+          if (*it != node && uses[*it] > 1 && isSharable(*it))
+            shared.push_back(*it);
+        }
+
+        try {
+          for (triton::uint32 index = 0; index < shared.size(); index++) {
+            std::string name = "dag!" + std::to_string(index);
+            if (commands) {
+              stream << "(define-fun " << name << " () " << getSort(shared[index]) << " ";
+              this->printTree(stream, shared[index]);
+              stream << ")" << std::endl;
+            }
+            else {
+              stream << "(let ((" << name << " ";
+              this->printTree(stream, shared[index]);
+              stream << ")) ";
+            }
+            this->names[shared[index]] = name;
+          }
+
+          this->printTree(stream, node);
+
+          if (!commands) {
+            for (triton::uint32 index = 0; index < shared.size(); index++)
+              stream << ")";
+          }
+        }
+        catch (...) {
+          this->names.clear();
+          throw;
+        }
+
+        this->names.clear();
+        return stream;
       }
 
     };
@@ -300,7 +300,7 @@ namespace triton {
 
       /* bv representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvNode* node) {
-        stream << "(_ bv" << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
+        stream << "(_ bv" << node->getValue() << " " << node->getBitvectorSize() << ")";
         return stream;
       }
 
@@ -315,7 +315,7 @@ namespace triton {
 
       /* concat representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::ConcatNode* node) {
-        std::vector<triton::ast::AbstractNode*> childs = node->getChilds();
+        triton::ast::AstChilds& childs = node->getChilds();
         triton::uint32 size = childs.size();
 
         if (size < 2)
@@ -360,7 +360,7 @@ namespace triton {
 
       /* extract representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::ExtractNode* node) {
-        stream << "((_ extract " << node->getChilds()[0] << " " << node->getChilds()[1] << ") " << node->getChilds()[2] << ")";
+        stream << "((_ extract " << node->getHigh() << " " << node->getLow() << ") " << node->getChilds()[0] << ")";
         return stream;
       }
 
@@ -416,7 +416,7 @@ namespace triton {
 
       /* sx representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::SxNode* node) {
-        stream << "((_ sign_extend " << node->getChilds()[0] << ") " << node->getChilds()[1] << ")";
+        stream << "((_ sign_extend " << node->getSizeExt() << ") " << node->getChilds()[0] << ")";
         return stream;
       }
 
@@ -430,7 +430,7 @@ namespace triton {
 
       /* zx representation */
       std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::ZxNode* node) {
-        stream << "((_ zero_extend " << node->getChilds()[0] << ") " << node->getChilds()[1] << ")";
+        stream << "((_ zero_extend " << node->getSizeExt() << ") " << node->getChilds()[0] << ")";
         return stream;
       }
 
@@ -8,6 +8,7 @@
 #include <stdexcept>
 
 #include <api.hpp>
+#include <astTraversal.hpp>
 #include <cpuSize.hpp>
 #include <symbolicExpression.hpp>
 #include <symbolicVariable.hpp>
@@ -18,8 +19,15 @@
 namespace triton {
   namespace ast {
 
+    /* The body of a let depends on its symbol, it is converted by the let itself */
+    static bool isNotLet(triton::ast::AbstractNode* node) {
+      return node->getKind() != triton::ast::LET_NODE;
+    }
+
+
     TritonToZ3Ast::TritonToZ3Ast(bool eval) {
-      this->isEval = eval;
+      this->converting = false;
+      this->isEval     = eval;
     }
 
 
@@ -28,7 +36,44 @@ namespace triton {
 
 
     Z3Result& TritonToZ3Ast::eval(triton::ast::AbstractNode& e) {
-      e.accept(*this);
+      std::unordered_map<triton::ast::AbstractNode*, z3::expr>::iterator it = this->exprs.find(&e);
+
+      /* Already converted */
+      if (it != this->exprs.end()) {
+        this->result.setExpr(it->second);
+        return this->result;
+      }
+
+      /* Nodes left aside by the conversion (strings and let bodies) are converted on demand */
+      if (this->converting) {
+        e.accept(*this);
+        return this->result;
+      }
+
+      /*
+       * Convert the unique nodes childs first, so the visitors only find
+       * childs which are already converted and never recurse.
+       */
+      std::vector<triton::ast::AbstractNode*> nodes = triton::ast::postOrderTraversal(&e, true, isNotLet);
+      this->converting = true;
+      try {
+        for (std::vector<triton::ast::AbstractNode*>::iterator node = nodes.begin(); node != nodes.end(); node++) {
+          if ((*node)->getKind() == triton::ast::STRING_NODE)
+            continue;
+          (*node)->accept(*this);
+          this->exprs.insert(std::make_pair(*node, this->result.getExpr()));
+        }
+        if (e.getKind() == triton::ast::STRING_NODE)
+          e.accept(*this);
+      }
+      catch (...) {
+        this->converting = false;
+        this->exprs.clear();
+        throw;
+      }
+      this->converting = false;
+      this->exprs.clear();
+
       return this->result;
     }
 
@@ -309,9 +354,7 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvNode& e) {
-      Z3Result value = this->eval(*e.getChilds()[0]);
-      Z3Result size = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr = this->result.getContext().bv_val(value.getStringValue().c_str(), size.getUintValue());
+      z3::expr newexpr = this->result.getContext().bv_val(e.getValue().str().c_str(), e.getBitvectorSize());
 
       this->result.setExpr(newexpr);
     }
@@ -323,7 +366,7 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::ConcatNode& e) {
-      std::vector<triton::ast::AbstractNode*> childs = e.getChilds();
+      triton::ast::AstChilds& childs = e.getChilds();
 
       triton::uint32 idx;
 
@@ -373,10 +416,8 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::ExtractNode& e) {
-      Z3Result high = this->eval(*e.getChilds()[0]);
-      Z3Result low = this->eval(*e.getChilds()[1]);
-      Z3Result value = this->eval(*e.getChilds()[2]);
-      z3::expr newexpr = to_expr(this->result.getContext(), Z3_mk_extract(this->result.getContext(), high.getUintValue(), low.getUintValue(), value.getExpr()));
+      Z3Result value = this->eval(*e.getChilds()[0]);
+      z3::expr newexpr = to_expr(this->result.getContext(), Z3_mk_extract(this->result.getContext(), e.getHigh(), e.getLow(), value.getExpr()));
 
       this->result.setExpr(newexpr);
     }
@@ -448,9 +489,8 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::SxNode& e) {
-      Z3Result i       = this->eval(*e.getChilds()[0]);
-      Z3Result value   = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr = to_expr(this->result.getContext(), Z3_mk_sign_ext(this->result.getContext(), i.getUintValue(), value.getExpr()));
+      Z3Result value   = this->eval(*e.getChilds()[0]);
+      z3::expr newexpr = to_expr(this->result.getContext(), Z3_mk_sign_ext(this->result.getContext(), e.getSizeExt(), value.getExpr()));
 
       this->result.setExpr(newexpr);
     }
@@ -458,7 +498,7 @@ namespace triton {
 
     void TritonToZ3Ast::operator()(triton::ast::VariableNode& e) {
       std::string varName = e.getValue();
-      triton::engines::symbolic::SymbolicVariable* symVar = triton::api.getSymbolicVariableFromName(varName);
+      triton::engines::symbolic::SymbolicVariable* symVar = triton::api.getSymbolicVariableFromId(e.getSymVarId());
 
       if (symVar == nullptr)
         throw std::runtime_error("TritonToZ3Ast::VariableNode(): Can't get the symbolic variable (nullptr).");
@@ -494,9 +534,8 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::ZxNode& e) {
-      Z3Result i       = this->eval(*e.getChilds()[0]);
-      Z3Result value   = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr = to_expr(this->result.getContext(), Z3_mk_zero_ext(this->result.getContext(), i.getUintValue(), value.getExpr()));
+      Z3Result value   = this->eval(*e.getChilds()[0]);
+      z3::expr newexpr = to_expr(this->result.getContext(), Z3_mk_zero_ext(this->result.getContext(), e.getSizeExt(), value.getExpr()));
 
       this->result.setExpr(newexpr);
     }
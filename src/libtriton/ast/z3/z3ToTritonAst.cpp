@@ -7,6 +7,9 @@
 
 #include <stdexcept>
 #include <list>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <api.hpp>
 #include <symbolicVariable.hpp>
@@ -43,13 +46,53 @@ namespace triton {
 
 
     AbstractNode* Z3ToTritonAst::convert(void) {
-      return this->visit(this->expr);
+      std::vector<std::pair<z3::expr, triton::uint32> > stack;
+      std::unordered_set<triton::uint32> visited;
+      AbstractNode* node = nullptr;
+
+      /*
+       * Convert the unique Z3 nodes arguments first with an explicit stack,
+       * so visit() only finds arguments which are already converted.
+       */
+      visited.insert(Z3_get_ast_id(this->expr.ctx(), this->expr));
+      stack.push_back(std::make_pair(this->expr, 0));
+
+      try {
+        while (!stack.empty()) {
+          z3::expr current = stack.back().first;
+          triton::uint32 next = stack.back().second;
+
+          if (current.is_app() && next < current.num_args()) {
+            z3::expr arg = current.arg(next);
+            stack.back().second++;
+            if (visited.insert(Z3_get_ast_id(arg.ctx(), arg)).second)
+              stack.push_back(std::make_pair(arg, 0));
+            continue;
+          }
+
+          this->nodes[Z3_get_ast_id(current.ctx(), current)] = this->visit(current);
+          stack.pop_back();
+        }
+        node = this->visit(this->expr);
+      }
+      catch (...) {
+        this->nodes.clear();
+        throw;
+      }
+
+      this->nodes.clear();
+      return node;
     }
 
 
     AbstractNode* Z3ToTritonAst::visit(z3::expr const& expr) {
       AbstractNode* node = nullptr;
 
+      /* Already converted */
+      std::unordered_map<triton::uint32, AbstractNode*>::iterator it = this->nodes.find(Z3_get_ast_id(expr.ctx(), expr));
+      if (it != this->nodes.end())
+        return it->second;
+
       /* Currently, only support application node */
       if (expr.is_quantifier())
         throw std::runtime_error("Z3ToTritonAst::visit(): Quantifier not supported yet.");
@@ -100,6 +100,7 @@ tree but contains a reference to another subtree. Below, an example of one "part
 
 If you try to go through the full AST you will fail at the first reference node because a reference node does not contains child nodes.
 The only way to jump from a reference node to the targeted node is to use the triton::engines::symbolic::SymbolicEngine::getFullAst() function.
+This function builds the full tree aside and does not modify the partial tree.
 
 ~~~~~~~~~~~~~{.py}
 >>> zfId = getSymbolicRegisterId(REG.ZF)
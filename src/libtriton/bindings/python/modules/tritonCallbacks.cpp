@@ -8,6 +8,7 @@
 #ifdef TRITON_PYTHON_BINDINGS
 
 #include <api.hpp>
+#include <astTape.hpp>
 #include <bitsVector.hpp>
 #include <cpuSize.hpp>
 #include <immediateOperand.hpp>
@@ -88,6 +89,10 @@ Builds a symbolic \ref py_REG_page and returns a \ref py_AstNode_page.
 - **clearPathConstraints(void)**<br>
 Clears the logical conjunction vector of path constraints.
 
+- **collectSymbolicExpressions(void)**<br>
+Removes the symbolic expressions which cannot be reached anymore from the registers, the memory, the path constraints and the pinned expressions, and returns
+their number. The \ref py_SymbolicExpression_page objects and the instructions which hold a removed expression keep it alive.
+
 - **concretizeAllMemory(void)**<br>
 Concretizes all symbolic memory references.
 
@@ -151,9 +156,19 @@ Enabled, Triton will use the simplification passes of z3 before to call its reco
 - **enableTaintEngine(bool flag)**<br>
 Enables or disables the taint engine.
 
+- **evaluateAstForModels(\ref py_AstNode_page node, [{integer symVarId: integer value, ...}, ...])**<br>
+Compiles an AST into an evaluation tape once and evaluates it for each model of the list. A model is a dictionary of symbolic variable ids and values,
+the variables which are not in a model keep their concrete value. Up to 64 bits, the models are evaluated by batches, several at once. Returns the list
+of results as integers, without modifying the AST.
+
 - **evaluateAstViaZ3(\ref py_AstNode_page node)**<br>
 Evaluates an AST via Z3 and returns the symbolic value as integer.
 
+- **freeAllAstNodes(void)**<br>
+Frees all AST nodes which are not owned by a symbolic expression, a path constraint, an instruction, a memory operand, the aligned memory or a Python
+object. The nodes of this kind built by processing() and getModels() (e.g. the intermediate nodes of the builders) are freed when these calls return,
+the other ones stay allocated until this call.
+
 - **getAllRegisters(void)**<br>
 Returns the list of all registers. Each item of this list is a \ref py_Register_page.
 
@@ -167,14 +182,30 @@ Returns the AST representation mode as \ref py_AST_REPRESENTATION_page.
 Returns the partial AST as \ref py_AstNode_page from a symbolic expression id.
 
 - **getAstDictionariesStats(void)**<br>
-Returns a dictionary which contains all information about number of nodes allocated via AST dictionaries.
+Returns a dictionary which contains all information about number of nodes allocated via AST dictionaries. Besides the number of unique nodes per kind, the dictionary contains the `capacity`, the `loadFactor` (percent) of the table and the number of `hits` and `misses` of the lookups as well as their `hitRate` (percent).
+
+- **getAstStats(void)**<br>
+Returns the shape of the ASTs of all symbolic expressions taken together, as a dictionary. See `getAstStats(node)`, the nodes shared by several expressions are counted once and `treeNodes` is the sum over the expressions.
+
+- **getAstStats(\ref py_AstNode_page node)**<br>
+Returns the shape of an AST as a dictionary with references unrolled: the number of unique nodes (`uniqueNodes`), the number of nodes once the shared sub-trees are expanded (`treeNodes`), the `depth`, the memory used by the unique nodes in `bytes`, the number of different symbolic `variables` reached and `kinds`, a dictionary of the number of unique nodes per kind.
+
+- **getBackwardSlice(integer symExprId)**<br>
+Returns the backward slice of a symbolic expression, the expression included, as a dictionary: `expressions` is the list of the symbolic expression ids,
+`addresses` the list of the addresses of their instructions and `variables` the list of the symbolic variable ids it depends on.
+
+- **getBackwardSlice(\ref py_AstNode_page node)**<br>
+Returns the backward slice of an AST, a path constraint for instance, as a dictionary like above.
 
 - **getFullAst(\ref py_AstNode_page node)**<br>
-Returns the full AST of a root node as \ref py_AstNode_page.
+Returns the full AST of a root node as \ref py_AstNode_page. The given AST is not modified and keeps its references.
 
 - **getFullAstFromId(integer symExprId)**<br>
 Returns the full AST as \ref py_AstNode_page from a symbolic expression id.
 
+- **getLargestSymbolicExpressions(integer n)**<br>
+Returns the list of the `n` \ref py_SymbolicExpression_page with the biggest tree size, the biggest first. The tree sizes are recorded when the expressions are created, so this is cheap enough to be called during a long trace. The instruction which created an expression is given by its `getAddress()`.
+
 - **getMemoryAreaValue(integer baseAddr, integer size)**<br>
 If the emulation is enabled, returns the emulated value otherwise returns the last concrete values of a memory area as a list of integer.
 
@@ -190,6 +221,9 @@ Computes and returns a model as a dictionary of {integer symVarId : \ref py_Solv
 - **getModels(\ref py_AstNode_page node)**<br>
 Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
 
+- **getNumberOfAllocatedAstNodes(void)**<br>
+Returns the number of AST nodes allocated.
+
 - **getParentRegisters(void)**<br>
 Returns the list of parent registers. Each item of this list is a \ref py_Register_page.
 
@@ -199,6 +233,10 @@ Returns the logical conjunction vector of path constraints as list of \ref py_Pa
 - **getPathConstraintsAst(void)**<br>
 Returns the logical conjunction AST of path constraints as \ref py_AstNode_page.
 
+- **getPathConstraintsBackwardSlices(void)**<br>
+Returns the backward slices of the taken branches of the path constraints as a list of dictionaries like `getBackwardSlice()`, in the order of
+`getPathConstraints()`. The ASTs are walked once for all the slices.
+
 - **getRegisterValue(\ref py_REG_page reg)**<br>
 If the emulation is enabled, returns the emulated value otherwise returns the last concrete value recorded of the register.
 
@@ -271,24 +309,46 @@ Returns true if Triton can use the simplification passes of z3.
 - **isTaintEngineEnabled(void)**<br>
 Returns true if the taint engine is enabled.
 
+- **loadSymbolicState(string filename)**<br>
+Replaces the symbolic expressions, variables, registers and memory by the ones saved with `saveSymbolicState()`. The path constraints are
+cleared and the architecture must be the one of the saved state. If the file is invalid, the current state is kept.
+
 - **newSymbolicExpression(\ref py_AstNode_page node, string comment="")**<br>
 Returns a new symbolic expression. Note that if there are simplification passes recorded, simplification will be applied.
 
 - **newSymbolicVariable(intger varSize, string comment="")**<br>
 Returns a new symbolic variable.
 
+- **pinSymbolicExpression(integer symExprId)**<br>
+Keeps a symbolic expression and the expressions it refers to alive through the collections.
+
 - **processing(\ref py_Instruction_page inst)**<br>
 The main function. This function processes everything (engine, IR, optimization, state, ...) from a given instruction.
 
+- **recordRewriteRule(string pattern, string replacement)**<br>
+Records a rule of the AST rewriter, e.g. `recordRewriteRule("(bvxor x x)", "0")`. Lowercase letters are variables matching any node, numbers match
+constant bit-vectors, `-1` matches the constant with all bits set and uppercase letters match the bits of extract, the size of sx/zx or a rotation
+(`(extract H L x)`). The rule is applied after the default rules.
+
 - **recordSimplificationCallback(function cb)**<br>
 Records a simplification callback. The callback will be called before every symbolic assignments.
 
 - **removeSimplificationCallback(function cb)**<br>
 Removes a simplification callback.
 
+- **removeSymbolicExpression(integer symExprId)**<br>
+Removes a symbolic expression. The registers and the memory which refer to it are concretized.
+
 - **resetEngines(void)**<br>
 Resets everything.
 
+- **rewriteAst(\ref py_AstNode_page node)**<br>
+Rewrites the AST with the default and the recorded rewrite rules and returns the rewritten node. New symbolic expressions are rewritten the same way
+when the `OPTIMIZATION.AST_REWRITING` optimization is enabled.
+
+- **saveSymbolicState(string filename)**<br>
+Saves the symbolic expressions, variables, registers and memory into a binary file. The ASTs are saved as one table of shared nodes.
+
 - **setArchitecture(\ref py_ARCH_page arch)**<br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -307,6 +367,10 @@ Sets the last concrete value of a memory access.
 - **setLastRegisterValue(\ref py_REG_page reg)**<br>
 Sets the last concrete value of a register state. You cannot set an isolated flag, if so, use the flags registers like EFLAGS.
 
+- **setSymbolicGarbageCollectionThreshold(integer threshold)**<br>
+Enables the collection of the symbolic expressions after each instruction, once there are at least `threshold` expressions. The next collection waits for
+the live expressions to double. `0` disables it (default). The expressions of the processed instruction are kept until the next collection.
+
 - **setTaintMemory(\ref py_Memory_page mem, bool flag)**<br>
 Sets the targeted memory as tainted or not.
 
@@ -361,6 +425,9 @@ Taints `regDst` from `memSrc` with an union - `regDst` is tainted if `regDst` or
 - <b>taintUnionRegisterRegister(\ref py_REG_page regDst, \ref py_REG_page regSrc)</b><br>
 Taints `regDst` from `regSrc` with an union - `regDst` is tainted if `regDst` or `regSrc` are tainted.
 
+- **unpinSymbolicExpression(integer symExprId)**<br>
+Lets a pinned symbolic expression be collected.
+
 - **untaintMemory(intger addr)**<br>
 Untaints an address.
 
@@ -779,6 +846,20 @@ namespace triton {
       }
 
 
+      static PyObject* triton_collectSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "collectSymbolicExpressions(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUint(triton::api.collectSymbolicExpressions());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1255,6 +1336,59 @@ namespace triton {
       }
 
 
+      static PyObject* triton_evaluateAstForModels(PyObject* self, PyObject* args) {
+        PyObject* node   = nullptr;
+        PyObject* models = nullptr;
+        PyObject* ret    = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &models);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "evaluateAstForModels(): Architecture is not defined.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "evaluateAstForModels(): Expects a AstNode as first argument.");
+
+        if (models == nullptr || !PyList_Check(models))
+          return PyErr_Format(PyExc_TypeError, "evaluateAstForModels(): Expects a list as second argument.");
+
+        try {
+          std::vector<std::map<triton::__uint, triton::uint512> > batch(PyList_Size(models));
+          std::vector<triton::uint512> results;
+
+          for (Py_ssize_t i = 0; i < PyList_Size(models); i++) {
+            PyObject* item  = PyList_GetItem(models, i);
+            PyObject* key   = nullptr;
+            PyObject* value = nullptr;
+            Py_ssize_t pos  = 0;
+
+            if (!PyDict_Check(item))
+              return PyErr_Format(PyExc_TypeError, "evaluateAstForModels(): Each item of the list must be a dictionary.");
+
+            while (PyDict_Next(item, &pos, &key, &value)) {
+              if ((!PyLong_Check(key) && !PyInt_Check(key)) || (!PyLong_Check(value) && !PyInt_Check(value)))
+                return PyErr_Format(PyExc_TypeError, "evaluateAstForModels(): Keys and values of a model must be integers.");
+              batch[i][PyLong_AsUint(key)] = PyLong_AsUint512(value);
+            }
+          }
+
+          triton::ast::AstTape tape(PyAstNode_AsAstNode(node));
+          results = tape.evaluate(batch);
+
+          ret = xPyList_New(results.size());
+          for (triton::uint32 i = 0; i < results.size(); i++)
+            PyList_SetItem(ret, i, PyLong_FromUint512(results[i]));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_evaluateAstViaZ3(PyObject* self, PyObject* node) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1278,6 +1412,23 @@ namespace triton {
       }
 
 
+      static PyObject* triton_freeAllAstNodes(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "freeAllAstNodes(): Architecture is not defined.");
+
+        try {
+          triton::api.freeAllAstNodes();
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_getAllRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         std::set<triton::arch::RegisterOperand*> reg;
@@ -1355,6 +1506,92 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getAstStats(PyObject* self, PyObject* args) {
+        PyObject* node  = nullptr;
+        PyObject* kinds = nullptr;
+        PyObject* ret   = nullptr;
+        triton::ast::AstStats stats;
+        std::map<std::string, triton::uint64>::iterator it;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|O", &node);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getAstStats(): Architecture is not defined.");
+
+        if (node != nullptr && !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getAstStats(): Expects a AstNode as argument.");
+
+        try {
+          if (node != nullptr)
+            stats = triton::api.getAstStats(PyAstNode_AsAstNode(node));
+          else
+            stats = triton::api.getAstStats();
+
+          kinds = xPyDict_New();
+          for (it = stats.kinds.begin(); it != stats.kinds.end(); it++)
+            PyDict_SetItem(kinds, PyString_FromString(it->first.c_str()), PyLong_FromUint512(it->second));
+
+          ret = xPyDict_New();
+          PyDict_SetItem(ret, PyString_FromString("bytes"),       PyLong_FromUint512(stats.bytes));
+          PyDict_SetItem(ret, PyString_FromString("depth"),       PyLong_FromUint(stats.depth));
+          PyDict_SetItem(ret, PyString_FromString("kinds"),       kinds);
+          PyDict_SetItem(ret, PyString_FromString("treeNodes"),   PyLong_FromUint512(stats.treeNodes));
+          PyDict_SetItem(ret, PyString_FromString("uniqueNodes"), PyLong_FromUint512(stats.uniqueNodes));
+          PyDict_SetItem(ret, PyString_FromString("variables"),   PyLong_FromUint(stats.variables));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      /* Converts a backward slice into a dictionary */
+      static PyObject* PySymbolicSlice(const triton::engines::symbolic::SymbolicSlice& slice) {
+        PyObject* addresses   = xPyList_New(slice.addresses.size());
+        PyObject* expressions = xPyList_New(slice.expressions.size());
+        PyObject* variables   = xPyList_New(slice.variables.size());
+        PyObject* ret         = xPyDict_New();
+
+        for (triton::uint32 index = 0; index < slice.addresses.size(); index++)
+          PyList_SetItem(addresses, index, PyLong_FromUint(slice.addresses[index]));
+
+        for (triton::uint32 index = 0; index < slice.expressions.size(); index++)
+          PyList_SetItem(expressions, index, PyLong_FromUint(slice.expressions[index]));
+
+        for (triton::uint32 index = 0; index < slice.variables.size(); index++)
+          PyList_SetItem(variables, index, PyLong_FromUint(slice.variables[index]));
+
+        PyDict_SetItem(ret, PyString_FromString("addresses"),   addresses);
+        PyDict_SetItem(ret, PyString_FromString("expressions"), expressions);
+        PyDict_SetItem(ret, PyString_FromString("variables"),   variables);
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getBackwardSlice(PyObject* self, PyObject* arg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getBackwardSlice(): Architecture is not defined.");
+
+        if (!PyInt_Check(arg) && !PyLong_Check(arg) && !PyAstNode_Check(arg))
+          return PyErr_Format(PyExc_TypeError, "getBackwardSlice(): Expects an integer or a AstNode as argument.");
+
+        try {
+          if (PyAstNode_Check(arg))
+            return PySymbolicSlice(triton::api.getBackwardSlice(PyAstNode_AsAstNode(arg)));
+          return PySymbolicSlice(triton::api.getBackwardSlice(PyLong_AsUint(arg)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_getFullAst(PyObject* self, PyObject* node) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1389,6 +1626,31 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getLargestSymbolicExpressions(PyObject* self, PyObject* n) {
+        PyObject* ret = nullptr;
+        std::vector<triton::engines::symbolic::SymbolicExpression*> expressions;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getLargestSymbolicExpressions(): Architecture is not defined.");
+
+        if (!PyLong_Check(n) && !PyInt_Check(n))
+          return PyErr_Format(PyExc_TypeError, "getLargestSymbolicExpressions(): Expects an integer as argument.");
+
+        try {
+          expressions = triton::api.getLargestSymbolicExpressions(static_cast<triton::uint32>(PyLong_AsUint(n)));
+          ret = xPyList_New(expressions.size());
+          for (triton::uint32 index = 0; index < expressions.size(); index++)
+            PyList_SetItem(ret, index, PySymbolicExpression(expressions[index]));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getMemoryAreaValue(PyObject* self, PyObject* args) {
         std::vector<triton::uint8> vv;
         PyObject* ret  = nullptr;
@@ -1504,6 +1766,20 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getNumberOfAllocatedAstNodes(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getNumberOfAllocatedAstNodes(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUint(triton::api.getNumberOfAllocatedAstNodes());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_getParentRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         std::set<triton::arch::RegisterOperand*> reg;
@@ -1565,6 +1841,28 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getPathConstraintsBackwardSlices(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getPathConstraintsBackwardSlices(): Architecture is not defined.");
+
+        try {
+          std::vector<triton::engines::symbolic::SymbolicSlice> slices = triton::api.getPathConstraintsBackwardSlices();
+
+          ret = xPyList_New(slices.size());
+          for (triton::uint32 index = 0; index < slices.size(); index++)
+            PyList_SetItem(ret, index, PySymbolicSlice(slices[index]));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getRegisterValue(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1601,8 +1899,8 @@ namespace triton {
 
       static PyObject* triton_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
-        const std::map<triton::__uint, triton::engines::symbolic::SymbolicExpression*>& expressions = triton::api.getSymbolicExpressions();
-        std::map<triton::__uint, triton::engines::symbolic::SymbolicExpression*>::const_iterator it;
+        const triton::engines::symbolic::IdTable<triton::engines::symbolic::SymbolicExpression*>& expressions = triton::api.getSymbolicExpressions();
+        triton::engines::symbolic::IdTable<triton::engines::symbolic::SymbolicExpression*>::const_iterator it;
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1775,8 +2073,8 @@ namespace triton {
 
       static PyObject* triton_getSymbolicVariables(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
-        const std::map<triton::__uint, triton::engines::symbolic::SymbolicVariable*>& variables = triton::api.getSymbolicVariables();
-        std::map<triton::__uint, triton::engines::symbolic::SymbolicVariable*>::const_iterator it;
+        const triton::engines::symbolic::IdTable<triton::engines::symbolic::SymbolicVariable*>& variables = triton::api.getSymbolicVariables();
+        triton::engines::symbolic::IdTable<triton::engines::symbolic::SymbolicVariable*>::const_iterator it;
 
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1961,6 +2259,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_loadSymbolicState(PyObject* self, PyObject* filename) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "loadSymbolicState(): Architecture is not defined.");
+
+        if (!PyString_Check(filename))
+          return PyErr_Format(PyExc_TypeError, "loadSymbolicState(): Expects a string as argument.");
+
+        try {
+          triton::api.loadSymbolicState(PyString_AsString(filename));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_newSymbolicVariable(PyObject* self, PyObject* args) {
         PyObject* size        = nullptr;
         PyObject* comment     = nullptr;
@@ -1991,6 +2309,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_pinSymbolicExpression(PyObject* self, PyObject* symExprId) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "pinSymbolicExpression(): Architecture is not defined.");
+
+        if (!PyInt_Check(symExprId) && !PyLong_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "pinSymbolicExpression(): Expects an integer as argument.");
+
+        try {
+          triton::api.pinSymbolicExpression(PyLong_AsUint(symExprId));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_processing(PyObject* self, PyObject* inst) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2011,6 +2349,35 @@ namespace triton {
       }
 
 
+      static PyObject* triton_recordRewriteRule(PyObject* self, PyObject* args) {
+        PyObject* pattern     = nullptr;
+        PyObject* replacement = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &pattern, &replacement);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "recordRewriteRule(): Architecture is not defined.");
+
+        if (pattern == nullptr || !PyString_Check(pattern))
+          return PyErr_Format(PyExc_TypeError, "recordRewriteRule(): Expects a string as first argument.");
+
+        if (replacement == nullptr || !PyString_Check(replacement))
+          return PyErr_Format(PyExc_TypeError, "recordRewriteRule(): Expects a string as second argument.");
+
+        try {
+          triton::api.recordRewriteRule(PyString_AsString(pattern), PyString_AsString(replacement));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_recordSimplificationCallback(PyObject* self, PyObject* cb) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2051,6 +2418,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_removeSymbolicExpression(PyObject* self, PyObject* symExprId) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "removeSymbolicExpression(): Architecture is not defined.");
+
+        if (!PyInt_Check(symExprId) && !PyLong_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "removeSymbolicExpression(): Expects an integer as argument.");
+
+        try {
+          triton::api.removeSymbolicExpression(PyLong_AsUint(symExprId));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_resetEngines(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2068,6 +2455,43 @@ namespace triton {
       }
 
 
+      static PyObject* triton_rewriteAst(PyObject* self, PyObject* node) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "rewriteAst(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "rewriteAst(): Expects a AstNode as argument.");
+
+        try {
+          return PyAstNode(triton::api.rewriteAst(PyAstNode_AsAstNode(node)));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_saveSymbolicState(PyObject* self, PyObject* filename) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "saveSymbolicState(): Architecture is not defined.");
+
+        if (!PyString_Check(filename))
+          return PyErr_Format(PyExc_TypeError, "saveSymbolicState(): Expects a string as argument.");
+
+        try {
+          triton::api.saveSymbolicState(PyString_AsString(filename));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as argument.");
@@ -2211,6 +2635,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_setSymbolicGarbageCollectionThreshold(PyObject* self, PyObject* threshold) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSymbolicGarbageCollectionThreshold(): Architecture is not defined.");
+
+        if (!PyInt_Check(threshold) && !PyLong_Check(threshold))
+          return PyErr_Format(PyExc_TypeError, "setSymbolicGarbageCollectionThreshold(): Expects an integer as argument.");
+
+        try {
+          triton::api.setSymbolicGarbageCollectionThreshold(PyLong_AsUint(threshold));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_setTaintMemory(PyObject* self, PyObject* args) {
         PyObject* mem    = nullptr;
         PyObject* flag   = nullptr;
@@ -2641,6 +3085,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_unpinSymbolicExpression(PyObject* self, PyObject* symExprId) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "unpinSymbolicExpression(): Architecture is not defined.");
+
+        if (!PyInt_Check(symExprId) && !PyLong_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "unpinSymbolicExpression(): Expects an integer as argument.");
+
+        try {
+          triton::api.unpinSymbolicExpression(PyLong_AsUint(symExprId));
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_untaintMemory(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2699,6 +3163,7 @@ namespace triton {
         {"buildSymbolicMemory",                 (PyCFunction)triton_buildSymbolicMemory,                    METH_O,             ""},
         {"buildSymbolicRegister",               (PyCFunction)triton_buildSymbolicRegister,                  METH_O,             ""},
         {"clearPathConstraints",                (PyCFunction)triton_clearPathConstraints,                   METH_NOARGS,        ""},
+        {"collectSymbolicExpressions",          (PyCFunction)triton_collectSymbolicExpressions,             METH_NOARGS,        ""},
         {"concretizeAllMemory",                 (PyCFunction)triton_concretizeAllMemory,                    METH_NOARGS,        ""},
         {"concretizeAllRegister",               (PyCFunction)triton_concretizeAllRegister,                  METH_NOARGS,        ""},
         {"concretizeMemory",                    (PyCFunction)triton_concretizeMemory,                       METH_O,             ""},
@@ -2719,21 +3184,28 @@ namespace triton {
         {"enableSymbolicOptimization",          (PyCFunction)triton_enableSymbolicOptimization,             METH_VARARGS,       ""},
         {"enableSymbolicZ3Simplification",      (PyCFunction)triton_enableSymbolicZ3Simplification,         METH_O,             ""},
         {"enableTaintEngine",                   (PyCFunction)triton_enableTaintEngine,                      METH_O,             ""},
+        {"evaluateAstForModels",                (PyCFunction)triton_evaluateAstForModels,                   METH_VARARGS,       ""},
         {"evaluateAstViaZ3",                    (PyCFunction)triton_evaluateAstViaZ3,                       METH_O,             ""},
+        {"freeAllAstNodes",                     (PyCFunction)triton_freeAllAstNodes,                        METH_NOARGS,        ""},
         {"getAllRegisters",                     (PyCFunction)triton_getAllRegisters,                        METH_NOARGS,        ""},
         {"getArchitecture",                     (PyCFunction)triton_getArchitecture,                        METH_NOARGS,        ""},
         {"getAstFromId",                        (PyCFunction)triton_getAstFromId,                           METH_O,             ""},
         {"getAstRepresentationMode",            (PyCFunction)triton_getAstRepresentationMode,               METH_NOARGS,        ""},
         {"getAstDictionariesStats",             (PyCFunction)triton_getAstDictionariesStats,                METH_NOARGS,        ""},
+        {"getAstStats",                         (PyCFunction)triton_getAstStats,                            METH_VARARGS,       ""},
+        {"getBackwardSlice",                    (PyCFunction)triton_getBackwardSlice,                       METH_O,             ""},
         {"getFullAst",                          (PyCFunction)triton_getFullAst,                             METH_O,             ""},
         {"getFullAstFromId",                    (PyCFunction)triton_getFullAstFromId,                       METH_O,             ""},
+        {"getLargestSymbolicExpressions",       (PyCFunction)triton_getLargestSymbolicExpressions,          METH_O,             ""},
         {"getMemoryAreaValue",                  (PyCFunction)triton_getMemoryAreaValue,                     METH_VARARGS,       ""},
         {"getMemoryValue",                      (PyCFunction)triton_getMemoryValue,                         METH_O,             ""},
         {"getModel",                            (PyCFunction)triton_getModel,                               METH_O,             ""},
         {"getModels",                           (PyCFunction)triton_getModels,                              METH_VARARGS,       ""},
+        {"getNumberOfAllocatedAstNodes",        (PyCFunction)triton_getNumberOfAllocatedAstNodes,           METH_NOARGS,        ""},
         {"getParentRegisters",                  (PyCFunction)triton_getParentRegisters,                     METH_NOARGS,        ""},
         {"getPathConstraints",                  (PyCFunction)triton_getPathConstraints,                     METH_NOARGS,        ""},
         {"getPathConstraintsAst",               (PyCFunction)triton_getPathConstraintsAst,                  METH_NOARGS,        ""},
+        {"getPathConstraintsBackwardSlices",    (PyCFunction)triton_getPathConstraintsBackwardSlices,       METH_NOARGS,        ""},
         {"getRegisterValue",                    (PyCFunction)triton_getRegisterValue,                       METH_O,             ""},
         {"getSymbolicExpressionFromId",         (PyCFunction)triton_getSymbolicExpressionFromId,            METH_O,             ""},
         {"getSymbolicExpressions",              (PyCFunction)triton_getSymbolicExpressions,                 METH_NOARGS,        ""},
@@ -2756,17 +3228,24 @@ namespace triton {
         {"isSymbolicOptimizationEnabled",       (PyCFunction)triton_isSymbolicOptimizationEnabled,          METH_O,             ""},
         {"isSymbolicZ3SimplificationEnabled",   (PyCFunction)triton_isSymbolicZ3SimplificationEnabled,      METH_NOARGS,        ""},
         {"isTaintEngineEnabled",                (PyCFunction)triton_isTaintEngineEnabled,                   METH_NOARGS,        ""},
+        {"loadSymbolicState",                   (PyCFunction)triton_loadSymbolicState,                      METH_O,             ""},
         {"newSymbolicExpression",               (PyCFunction)triton_newSymbolicExpression,                  METH_VARARGS,       ""},
         {"newSymbolicVariable",                 (PyCFunction)triton_newSymbolicVariable,                    METH_VARARGS,       ""},
+        {"pinSymbolicExpression",               (PyCFunction)triton_pinSymbolicExpression,                  METH_O,             ""},
         {"processing",                          (PyCFunction)triton_processing,                             METH_O,             ""},
+        {"recordRewriteRule",                   (PyCFunction)triton_recordRewriteRule,                      METH_VARARGS,       ""},
         {"recordSimplificationCallback",        (PyCFunction)triton_recordSimplificationCallback,           METH_O,             ""},
         {"removeSimplificationCallback",        (PyCFunction)triton_removeSimplificationCallback,           METH_O,             ""},
+        {"removeSymbolicExpression",            (PyCFunction)triton_removeSymbolicExpression,               METH_O,             ""},
         {"resetEngines",                        (PyCFunction)triton_resetEngines,                           METH_NOARGS,        ""},
+        {"rewriteAst",                          (PyCFunction)triton_rewriteAst,                             METH_O,             ""},
+        {"saveSymbolicState",                   (PyCFunction)triton_saveSymbolicState,                      METH_O,             ""},
         {"setArchitecture",                     (PyCFunction)triton_setArchitecture,                        METH_O,             ""},
         {"setAstRepresentationMode",            (PyCFunction)triton_setAstRepresentationMode,               METH_O,             ""},
         {"setLastMemoryAreaValue",              (PyCFunction)triton_setLastMemoryAreaValue,                 METH_VARARGS,       ""},
         {"setLastMemoryValue",                  (PyCFunction)triton_setLastMemoryValue,                     METH_VARARGS,       ""},
         {"setLastRegisterValue",                (PyCFunction)triton_setLastRegisterValue,                   METH_O,             ""},
+        {"setSymbolicGarbageCollectionThreshold", (PyCFunction)triton_setSymbolicGarbageCollectionThreshold,  METH_O,             ""},
         {"setTaintMemory",                      (PyCFunction)triton_setTaintMemory,                         METH_VARARGS,       ""},
         {"setTaintRegister",                    (PyCFunction)triton_setTaintRegister,                       METH_VARARGS,       ""},
         {"simplify",                            (PyCFunction)triton_simplify,                               METH_VARARGS,       ""},
@@ -2784,6 +3263,7 @@ namespace triton {
         {"taintUnionRegisterImmediate",         (PyCFunction)triton_taintUnionRegisterImmediate,            METH_O,             ""},
         {"taintUnionRegisterMemory",            (PyCFunction)triton_taintUnionRegisterMemory,               METH_VARARGS,       ""},
         {"taintUnionRegisterRegister",          (PyCFunction)triton_taintUnionRegisterRegister,             METH_VARARGS,       ""},
+        {"unpinSymbolicExpression",             (PyCFunction)triton_unpinSymbolicExpression,                METH_O,             ""},
         {"untaintMemory",                       (PyCFunction)triton_untaintMemory,                          METH_O,             ""},
         {"untaintRegister",                     (PyCFunction)triton_untaintRegister,                        METH_O,             ""},
         {nullptr,                               nullptr,                                                    0,                  nullptr}
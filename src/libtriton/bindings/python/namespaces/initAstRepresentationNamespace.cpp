@@ -38,6 +38,9 @@ Enabled, all prints of AST expressions will be represented into the SMT2-Lib syn
 - **AST_REPRESENTATION.PYTHON**<br>
 Enabled, all prints of AST expressions will be represented into the Python syntax.
 
+- **AST_REPRESENTATION.SMT_DAG**<br>
+Enabled, all prints of AST expressions will be represented into the SMT2-Lib syntax and the sub-trees used several times are printed once. If the root is an `assert`, they are declared by `define-fun` commands before it, otherwise they are bound by `let`. The size of the text is then linear in the number of unique nodes, use it to export the queries of `getFullAst()`.
+
 
 */
 
@@ -48,8 +51,9 @@ namespace triton {
     namespace python {
 
       void initAstRepresentationNamespace(PyObject* astRepresentationDict) {
-        PyDict_SetItemString(astRepresentationDict, "SMT",    PyLong_FromUint(triton::ast::representations::SMT_REPRESENTATION));
-        PyDict_SetItemString(astRepresentationDict, "PYTHON", PyLong_FromUint(triton::ast::representations::PYTHON_REPRESENTATION));
+        PyDict_SetItemString(astRepresentationDict, "SMT",     PyLong_FromUint(triton::ast::representations::SMT_REPRESENTATION));
+        PyDict_SetItemString(astRepresentationDict, "PYTHON",  PyLong_FromUint(triton::ast::representations::PYTHON_REPRESENTATION));
+        PyDict_SetItemString(astRepresentationDict, "SMT_DAG", PyLong_FromUint(triton::ast::representations::SMT_DAG_REPRESENTATION));
       }
 
     }; /* python namespace */
@@ -37,7 +37,16 @@ The OPTIMIZATION namespace contains all kinds of symbolic optimization.
 Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory explosion of `LOAD` and `STORE` acceess.
 
 - **OPTIMIZATION.AST_DICTIONARIES**<br>
-Enabled, Triton will record all AST nodes into several dictionaries and try to return node already allocated instead of allocate twice the same node.
+Enabled, Triton will record all AST nodes into a dictionary and return the node already allocated instead of allocating twice the same node.
+
+- **OPTIMIZATION.AST_REWRITING**<br>
+Enabled, Triton will rewrite every new symbolic expression with the rules of its AST rewriter before the simplification callbacks. The default rules
+cover the bitwise and arithmetic identities, the fusion of extractions and concatenations and the x86 flags. See `recordRewriteRule()`.
+
+- **OPTIMIZATION.CONSTANT_FOLDING**<br>
+Enabled, the AST builders return a constant bit-vector instead of an operation whose operands are all constants, and return an operand as is for
+trivial identities (`x + 0`, `x & 0`, `x ^ x`, an extraction of all the bits, an extension by 0 bits...). Logical nodes are kept as they are Bool
+terms. Fully concrete bit-vector computations do not build any operation node.
 
 - **OPTIMIZATION.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
@@ -59,6 +68,8 @@ namespace triton {
       void initSymOptiNamespace(PyObject* symOptiDict) {
         PyDict_SetItemString(symOptiDict, "ALIGNED_MEMORY",         PyLong_FromUint(triton::engines::symbolic::ALIGNED_MEMORY));
         PyDict_SetItemString(symOptiDict, "AST_DICTIONARIES",       PyLong_FromUint(triton::engines::symbolic::AST_DICTIONARIES));
+        PyDict_SetItemString(symOptiDict, "AST_REWRITING",          PyLong_FromUint(triton::engines::symbolic::AST_REWRITING));
+        PyDict_SetItemString(symOptiDict, "CONSTANT_FOLDING",       PyLong_FromUint(triton::engines::symbolic::CONSTANT_FOLDING));
         PyDict_SetItemString(symOptiDict, "ONLY_ON_SYMBOLIZED",     PyLong_FromUint(triton::engines::symbolic::ONLY_ON_SYMBOLIZED));
         PyDict_SetItemString(symOptiDict, "ONLY_ON_TAINTED",        PyLong_FromUint(triton::engines::symbolic::ONLY_ON_TAINTED));
         PyDict_SetItemString(symOptiDict, "PC_TRACKING_SYMBOLIC",   PyLong_FromUint(triton::engines::symbolic::PC_TRACKING_SYMBOLIC));
@@ -9,6 +9,7 @@
 
 #include <z3++.h>
 
+#include <api.hpp>
 #include <ast.hpp>
 #include <pythonObjects.hpp>
 #include <pythonUtils.hpp>
@@ -60,7 +61,7 @@ Returns the node vector size.
 Returns the list of child nodes as \ref py_AstNode_page.
 
 - **getHash(void)**<br>
-Returns the hash (signature) of the AST as float.
+Returns the hash (signature) of the AST as integer.
 
 - **getKind(void)**<br>
 Returns the kind of the node as \ref py_AST_NODE_page.<br>
@@ -70,7 +71,7 @@ e.g: `AST_NODE.BVADD`
 Returns the parents list nodes as \ref py_AstNode_page. The list is empty if there is still no parent defined.
 
 - **getValue(void)**<br>
-Returns the node value as integer or string (it depends of the kind). For example if the kind of node is `decimal`, the value is an integer.
+Returns the node value as integer or string (it depends of the kind). For example if the kind of node is `decimal` or `bv`, the value is an integer.
 
 - **isSigned(void)**<br>
 According to the size of the expression, returns true if the MSB is 1.
@@ -92,6 +93,7 @@ namespace triton {
       //! AstNode destructor.
       void AstNode_dealloc(PyObject* self) {
         std::cout << std::flush;
+        triton::api.releaseAstNode(PyAstNode_AsAstNode(self));
         Py_DECREF(self);
       }
 
@@ -146,7 +148,7 @@ namespace triton {
 
       static PyObject* AstNode_getHash(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint512(PyAstNode_AsAstNode(self)->hash(1));
+          return PyLong_FromUint512(PyAstNode_AsAstNode(self)->hash());
         }
         catch (const std::exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -167,10 +169,14 @@ namespace triton {
       static PyObject* AstNode_getParents(PyObject* self, PyObject* noarg) {
         try {
           PyObject* ret = nullptr;
-          std::set<triton::ast::AbstractNode*>& parents = PyAstNode_AsAstNode(self)->getParents();
-          ret = xPyList_New(parents.size());
+          triton::ast::AstParents& parents = PyAstNode_AsAstNode(self)->getParents();
+
+          /* The parents hold one entry per edge, a node which uses the same child twice is listed once */
+          std::set<triton::ast::AbstractNode*> unique(parents.begin(), parents.end());
+
+          ret = xPyList_New(unique.size());
           triton::uint32 index = 0;
-          for (std::set<triton::ast::AbstractNode*>::iterator it = parents.begin(); it != parents.end(); it++)
+          for (std::set<triton::ast::AbstractNode*>::iterator it = unique.begin(); it != unique.end(); it++)
             PyList_SetItem(ret, index++, PyAstNode(*it));
           return ret;
           }
@@ -187,6 +193,9 @@ namespace triton {
           if (node->getKind() == triton::ast::DECIMAL_NODE)
             return PyLong_FromUint512(reinterpret_cast<triton::ast::DecimalNode *>(node)->getValue());
 
+          else if (node->getKind() == triton::ast::BV_NODE)
+            return PyLong_FromUint512(reinterpret_cast<triton::ast::BvNode *>(node)->getValue());
+
           else if (node->getKind() == triton::ast::REFERENCE_NODE)
             return PyLong_FromUint(reinterpret_cast<triton::ast::ReferenceNode *>(node)->getValue());
 
@@ -247,7 +256,6 @@ namespace triton {
           src = PyAstNode_AsAstNode(node);
           dst = PyAstNode_AsAstNode(self);
           dst->setChild(i, src);
-          dst->init();
 
           Py_RETURN_TRUE;
         }
@@ -264,7 +272,7 @@ namespace triton {
 
 
       static int AstNode_cmp(AstNode_Object* a, AstNode_Object* b) {
-        return !(a->node->hash(1) == b->node->hash(1));
+        return !(a->node->hash() == b->node->hash());
       }
 
 
@@ -562,8 +570,10 @@ namespace triton {
 
         PyType_Ready(&AstNode_Type);
         object = PyObject_NEW(AstNode_Object, &AstNode_Type);
-        if (object != NULL)
+        if (object != NULL) {
           object->node = node;
+          triton::api.retainAstNode(node);
+        }
 
         return (PyObject*)object;
       }
@@ -23,7 +23,8 @@
 \section py_SymbolicExpression_description Description
 <hr>
 
-This object is used to represent a symbolic expression.
+This object is used to represent a symbolic expression. It holds the expression, which stays valid once removed from the
+symbolic engine (e.g. by a collection of the dead expressions).
 
 ~~~~~~~~~~~~~{.py}
 >>> from triton import *
@@ -82,6 +83,9 @@ rax:64 bv[63..0]
 \section SymbolicExpression_py_api Python API - Methods of the SymbolicExpression class
 <hr>
 
+- **getAddress(void)**<br>
+Returns the address of the instruction which created the symbolic expression as integer, `0` if it was not created by an instruction. See `hasAddress()`.
+
 - **getAst(void)**<br>
 Returns the SMT AST root node of the symbolic expression as \ref py_AstNode_page. This is the semantics.
 
@@ -105,6 +109,12 @@ Returns the origin memory access as \ref py_Memory_page if `isMemory()` is equal
 - **getOriginRegister(void)**<br>
 Returns the origin register as \ref py_Register_page if `isRegister()` is equal `True`, `REG.INVALID` otherwise. This register represents the target assignment.
 
+- **getTreeSize(void)**<br>
+Returns the number of nodes of the AST once its references are unrolled and its shared sub-trees expanded, as integer. The size is computed on the first call after the AST is set.
+
+- **hasAddress(void)**<br>
+Returns true if the expression was created by an instruction, whatever its address.
+
 - **isMemory(void)**<br>
 Returns true if the expression is assigned to a memory.
 
@@ -128,6 +138,7 @@ namespace triton {
       //! SymbolicExpression destructor.
       void SymbolicExpression_dealloc(PyObject* self) {
         std::cout << std::flush;
+        triton::engines::symbolic::releaseIdTableEntry(PySymbolicExpression_AsSymbolicExpression(self));
         Py_DECREF(self);
       }
 
@@ -152,6 +163,16 @@ namespace triton {
       }
 
 
+      static PyObject* SymbolicExpression_getAddress(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint(PySymbolicExpression_AsSymbolicExpression(self)->getAddress());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* SymbolicExpression_getId(PyObject* self, PyObject* noarg) {
         try {
           return Py_BuildValue("k", PySymbolicExpression_AsSymbolicExpression(self)->getId());
@@ -202,6 +223,28 @@ namespace triton {
       }
 
 
+      static PyObject* SymbolicExpression_getTreeSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint512(PySymbolicExpression_AsSymbolicExpression(self)->getTreeSize());
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* SymbolicExpression_hasAddress(PyObject* self, PyObject* noarg) {
+        try {
+          if (PySymbolicExpression_AsSymbolicExpression(self)->hasAddress() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const std::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* SymbolicExpression_isMemory(PyObject* self, PyObject* noarg) {
         try {
           if (PySymbolicExpression_AsSymbolicExpression(self)->isMemory() == true)
@@ -272,6 +315,7 @@ namespace triton {
 
       //! SymbolicExpression methods.
       PyMethodDef SymbolicExpression_callbacks[] = {
+        {"getAddress",        SymbolicExpression_getAddress,        METH_NOARGS,    ""},
         {"getAst",            SymbolicExpression_getAst,            METH_NOARGS,    ""},
         {"getComment",        SymbolicExpression_getComment,        METH_NOARGS,    ""},
         {"getId",             SymbolicExpression_getId,             METH_NOARGS,    ""},
@@ -279,6 +323,8 @@ namespace triton {
         {"getNewAst",         SymbolicExpression_getNewAst,         METH_NOARGS,    ""},
         {"getOriginMemory",   SymbolicExpression_getOriginMemory,   METH_NOARGS,    ""},
         {"getOriginRegister", SymbolicExpression_getOriginRegister, METH_NOARGS,    ""},
+        {"getTreeSize",       SymbolicExpression_getTreeSize,       METH_NOARGS,    ""},
+        {"hasAddress",        SymbolicExpression_hasAddress,        METH_NOARGS,    ""},
         {"isMemory",          SymbolicExpression_isMemory,          METH_NOARGS,    ""},
         {"isRegister",        SymbolicExpression_isRegister,        METH_NOARGS,    ""},
         {"isTainted",         SymbolicExpression_isTainted,         METH_NOARGS,    ""},
@@ -338,8 +384,10 @@ namespace triton {
 
         PyType_Ready(&SymbolicExpression_Type);
         object = PyObject_NEW(SymbolicExpression_Object, &SymbolicExpression_Type);
-        if (object != NULL)
+        if (object != NULL) {
           object->symExpr = symExpr;
+          triton::engines::symbolic::retainIdTableEntry(symExpr);
+        }
 
         return (PyObject*)object;
       }
@@ -120,12 +120,13 @@ namespace triton {
         z3::context                                       ctx;
         z3::solver                                        solver(ctx);
         triton::uint32                                    representationMode = triton::api.getAstRepresentationMode();
+        triton::__uint                                    mark = triton::api.markAstRegion();
 
         if (node == nullptr)
           throw std::runtime_error("SolverEngine::getModels(): node cannot be null.");
 
-        /* Switch into the SMT mode */
-        triton::api.setAstRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
+        /* Switch into the SMT mode, the shared sub-trees of the full AST are printed once */
+        triton::api.setAstRepresentationMode(triton::ast::representations::SMT_DAG_REPRESENTATION);
 
         /* First, set the QF_AUFBV flag  */
         formula << "(set-logic QF_AUFBV)";
@@ -136,6 +137,9 @@ namespace triton {
         /* And concat the user expression */
         formula << triton::api.getFullAst(node);
 
+        /* The unrolled copy of the AST is printed, its nodes are freed */
+        triton::api.freeAstRegion(mark);
+
         /* Create the context and AST */
         Z3_ast ast = Z3_parse_smtlib2_string(ctx, formula.str().c_str(), 0, 0, 0, 0, 0, 0);
         z3::expr eq(ctx, ast);
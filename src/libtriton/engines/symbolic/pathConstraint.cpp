@@ -6,6 +6,7 @@
 */
 
 #include <stdexcept>
+#include <api.hpp>
 #include <pathConstraint.hpp>
 
 
@@ -20,16 +21,41 @@ namespace triton {
 
       PathConstraint::PathConstraint(const PathConstraint &copy) {
         this->branches = copy.branches;
+        this->retainBranches();
       }
 
 
       PathConstraint::~PathConstraint() {
+        this->releaseBranches();
+      }
+
+
+      PathConstraint& PathConstraint::operator=(const PathConstraint &other) {
+        if (this == &other)
+          return *this;
+        this->releaseBranches();
+        this->branches = other.branches;
+        this->retainBranches();
+        return *this;
+      }
+
+
+      void PathConstraint::retainBranches(void) {
+        for (auto it = this->branches.begin(); it != this->branches.end(); it++)
+          triton::api.retainAstNode(std::get<2>(*it));
+      }
+
+
+      void PathConstraint::releaseBranches(void) {
+        for (auto it = this->branches.begin(); it != this->branches.end(); it++)
+          triton::api.releaseAstNode(std::get<2>(*it));
       }
 
 
       void PathConstraint::addBranchConstraint(bool taken, triton::__uint bbAddr, triton::ast::AbstractNode* pc) {
         if (pc == nullptr)
           throw std::runtime_error("PathConstraint::addBranchConstraint(): The PC node cannot be null.");
+        triton::api.retainAstNode(pc);
         this->branches.push_back(std::make_tuple(taken, bbAddr, pc));
       }
 
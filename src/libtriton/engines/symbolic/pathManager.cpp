@@ -18,6 +18,7 @@ namespace triton {
     namespace symbolic {
 
       PathManager::PathManager() {
+        this->pathConstraints = std::make_shared<std::vector<triton::engines::symbolic::PathConstraint> >();
       }
 
 
@@ -32,7 +33,15 @@ namespace triton {
 
       /* Returns the logical conjunction vector of path constraint */
       const std::vector<triton::engines::symbolic::PathConstraint>& PathManager::getPathConstraints(void) const {
-        return this->pathConstraints;
+        return *this->pathConstraints;
+      }
+
+
+      /* The path constraints retain their ASTs, the copy retains them once more */
+      std::vector<triton::engines::symbolic::PathConstraint>& PathManager::getWritablePathConstraints(void) {
+        if (this->pathConstraints.use_count() > 1)
+          this->pathConstraints = std::make_shared<std::vector<triton::engines::symbolic::PathConstraint> >(*this->pathConstraints);
+        return *this->pathConstraints;
       }
 
 
@@ -48,7 +57,7 @@ namespace triton {
                );
 
         /* Then, we create a conjunction of pc */
-        for (it = this->pathConstraints.begin(); it != this->pathConstraints.end(); it++) {
+        for (it = this->pathConstraints->begin(); it != this->pathConstraints->end(); it++) {
           node = triton::ast::land(node, it->getTakenPathConstraintAst());
         }
 
@@ -57,7 +66,7 @@ namespace triton {
 
 
       triton::uint32 PathManager::getNumberOfPathConstraints(void) const {
-        return this->pathConstraints.size();
+        return this->pathConstraints->size();
       }
 
 
@@ -81,7 +90,7 @@ namespace triton {
           return;
 
         /* Basic block taken */
-        targetBb = pc->evaluate().convert_to<triton::__uint>();
+        targetBb = static_cast<triton::__uint>(pc->evaluate64());
         size     = pc->getBitvectorSize();
 
         if (size == 0)
@@ -89,8 +98,8 @@ namespace triton {
 
         /* Multiple branches */
         if (pc->getKind() == triton::ast::ITE_NODE) {
-          triton::__uint bb1 = pc->getChilds()[1]->evaluate().convert_to<triton::__uint>();
-          triton::__uint bb2 = pc->getChilds()[2]->evaluate().convert_to<triton::__uint>();
+          triton::__uint bb1 = static_cast<triton::__uint>(pc->getChilds()[1]->evaluate64());
+          triton::__uint bb2 = static_cast<triton::__uint>(pc->getChilds()[2]->evaluate64());
 
           triton::ast::AbstractNode* bb1pc = (bb1 == targetBb) ? triton::ast::equal(pc, triton::ast::bv(targetBb, size)) :
                                                                  triton::ast::lnot(triton::ast::equal(pc, triton::ast::bv(targetBb, size)));
@@ -101,20 +110,20 @@ namespace triton {
           pco.addBranchConstraint(bb1 == targetBb, bb1, bb1pc);
           pco.addBranchConstraint(bb2 == targetBb, bb2, bb2pc);
 
-          this->pathConstraints.push_back(pco);
+          this->getWritablePathConstraints().push_back(pco);
         }
 
         /* Direct branch */
         else {
           pco.addBranchConstraint(true, targetBb, triton::ast::equal(pc, triton::ast::bv(targetBb, size)));
-          this->pathConstraints.push_back(pco);
+          this->getWritablePathConstraints().push_back(pco);
         }
 
       }
 
 
       void PathManager::clearPathConstraints(void) {
-        this->pathConstraints.clear();
+        this->pathConstraints = std::make_shared<std::vector<triton::engines::symbolic::PathConstraint> >();
       }
 
     }; /* symbolic namespace */
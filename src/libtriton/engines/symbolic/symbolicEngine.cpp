@@ -5,12 +5,19 @@
 **  This program is under the terms of the LGPLv3 License.
 */
 
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <api.hpp>
+#include <astTraversal.hpp>
 #include <coreUtils.hpp>
 #include <symbolicEngine.hpp>
+#include <symbolicSerialization.hpp>
 
 #ifdef TRITON_PYTHON_BINDINGS
   #include <pythonBindings.hpp>
@@ -84,10 +91,14 @@ namespace triton {
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
           this->symbolicReg[i] = triton::engines::symbolic::UNSET;
 
-        this->emulationFlag   = false;
-        this->enableFlag      = true;
-        this->uniqueSymExprId = 0;
-        this->uniqueSymVarId  = 0;
+        this->collectionThreshold = 0;
+        this->emulationFlag       = false;
+        this->enableFlag          = true;
+        this->largestCapacity     = 0;
+        this->largestGeneration   = 0;
+        this->nextCollection      = 0;
+        this->uniqueSymExprId     = 0;
+        this->uniqueSymVarId      = 0;
       }
 
 
@@ -101,11 +112,20 @@ namespace triton {
           this->symbolicReg[i] = other.symbolicReg[i];
 
         this->alignedMemoryReference      = other.alignedMemoryReference;
+        this->collectionThreshold         = other.collectionThreshold;
         this->emulationFlag               = other.emulationFlag;
         this->enableFlag                  = other.enableFlag;
         this->enabledOptimizations        = other.enabledOptimizations;
+        this->largestCapacity             = other.largestCapacity;
+        this->largestExpressions          = other.largestExpressions;
+        this->largestGeneration           = other.largestGeneration;
+        this->locations                   = other.locations;
+        this->memoryVariables             = other.memoryVariables;
         this->memoryReference             = other.memoryReference;
+        this->nextCollection              = other.nextCollection;
         this->pathConstraints             = other.pathConstraints;
+        this->pinnedExpressions           = other.pinnedExpressions;
+        this->registerVariables           = other.registerVariables;
         this->simplificationCallbacks     = other.simplificationCallbacks;
         this->symbolicExpressions         = other.symbolicExpressions;
         this->symbolicVariables           = other.symbolicVariables;
@@ -114,6 +134,9 @@ namespace triton {
         #ifdef TRITON_PYTHON_BINDINGS
         this->pySimplificationCallbacks   = other.pySimplificationCallbacks;
         #endif
+
+        /* The expressions are shared, the sizes they cached may refer to ids of the other engine */
+        SymbolicExpression::invalidateTreeSizes();
       }
 
 
@@ -128,18 +151,8 @@ namespace triton {
       }
 
 
+      /* The symbolic expressions and variables are deleted by their tables, once no copy of the engine shares them */
       SymbolicEngine::~SymbolicEngine() {
-        std::map<triton::__uint, SymbolicExpression*>::iterator it1 = this->symbolicExpressions.begin();
-        std::map<triton::__uint, SymbolicVariable*>::iterator it2 = this->symbolicVariables.begin();
-
-        /* Delete all symbolic expressions */
-        for (; it1 != this->symbolicExpressions.end(); ++it1)
-          delete it1->second;
-
-        /* Delete all symbolic variables */
-        for (; it2 != this->symbolicVariables.end(); ++it2)
-          delete it2->second;
-
         /* Delete all symbolic register */
         delete[] this->symbolicReg;
       }
@@ -173,8 +186,10 @@ namespace triton {
       void SymbolicEngine::concretizeMemory(const triton::arch::MemoryOperand& mem) {
         triton::__uint addr = mem.getAddress();
         triton::uint32 size = mem.getSize();
-        for (triton::uint32 index = 0; index < size; index++)
-          this->concretizeMemory(addr+index);
+
+        this->memoryReference.erase(addr, size);
+        if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
+          this->removeAlignedMemory(addr, size);
       }
 
 
@@ -197,78 +212,77 @@ namespace triton {
       }
 
 
-      /* Remove aligned memory */
-      void SymbolicEngine::removeAlignedMemory(triton::__uint addr) {
-        /* Remove address with several sizes */
-        this->alignedMemoryReference.erase(std::make_pair(addr,  BYTE_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr,  WORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr,  DWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr,  QWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr,  DQWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr,  QQWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr,  DQQWORD_SIZE));
-
-        /* Remove overloaded range */
-        this->alignedMemoryReference.erase(std::make_pair(addr-BYTE_SIZE,   WORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-BYTE_SIZE,   DWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-BYTE_SIZE,   QWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-BYTE_SIZE,   DQWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-BYTE_SIZE,   QQWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-BYTE_SIZE,   DQQWORD_SIZE));
-
-        this->alignedMemoryReference.erase(std::make_pair(addr-WORD_SIZE,   DWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-WORD_SIZE,   QWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-WORD_SIZE,   DQWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-WORD_SIZE,   QQWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-WORD_SIZE,   DQQWORD_SIZE));
-
-        this->alignedMemoryReference.erase(std::make_pair(addr-DWORD_SIZE,  QWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-DWORD_SIZE,  DQWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-DWORD_SIZE,  QQWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-DWORD_SIZE,  DQQWORD_SIZE));
-
-        this->alignedMemoryReference.erase(std::make_pair(addr-QWORD_SIZE,  DQWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-QWORD_SIZE,  QQWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-QWORD_SIZE,  DQQWORD_SIZE));
-
-        this->alignedMemoryReference.erase(std::make_pair(addr-DQWORD_SIZE, QQWORD_SIZE));
-        this->alignedMemoryReference.erase(std::make_pair(addr-DQWORD_SIZE, DQQWORD_SIZE));
-
-        this->alignedMemoryReference.erase(std::make_pair(addr-QQWORD_SIZE, DQQWORD_SIZE));
+      /* Removes the aligned entries overlapping a range */
+      void SymbolicEngine::removeAlignedMemory(triton::__uint addr, triton::uint32 size) {
+        this->alignedMemoryReference.erase(addr, size);
       }
 
 
       /* Returns the reference memory if it's referenced otherwise returns UNSET */
       triton::__uint SymbolicEngine::getSymbolicMemoryId(triton::__uint addr) const {
-        std::map<triton::__uint, triton::__uint>::const_iterator it;
-        if ((it = this->memoryReference.find(addr)) != this->memoryReference.end())
-          return it->second;
-        return triton::engines::symbolic::UNSET;
+        return this->memoryReference.get(addr);
       }
 
 
       /* Returns the symbolic variable otherwise returns nullptr */
       SymbolicVariable* SymbolicEngine::getSymbolicVariableFromId(triton::__uint symVarId) const {
-        if (this->symbolicVariables.find(symVarId) == this->symbolicVariables.end())
-          return nullptr;
-        return this->symbolicVariables.at(symVarId);
+        return this->symbolicVariables.get(symVarId);
       }
 
 
-      /* Returns the symbolic variable otherwise returns nullptr */
+      /* Returns the symbolic variable otherwise returns nullptr. The names are built from the ids, so the id is read back from the name */
       SymbolicVariable* SymbolicEngine::getSymbolicVariableFromName(const std::string& symVarName) const {
-        std::map<triton::__uint, SymbolicVariable*>::const_iterator it;
+        SymbolicVariable* symVar = nullptr;
+        char* end                = nullptr;
 
-        for (it = this->symbolicVariables.begin(); it != this->symbolicVariables.end(); it++) {
-          if (it->second->getSymVarName() == symVarName)
-            return it->second;
+        if (symVarName.size() <= TRITON_SYMVAR_NAME_SIZE || symVarName.compare(0, TRITON_SYMVAR_NAME_SIZE, TRITON_SYMVAR_NAME) != 0)
+          return nullptr;
+
+        triton::__uint id = std::strtoull(symVarName.c_str() + TRITON_SYMVAR_NAME_SIZE, &end, 10);
+        if (*end != '\0')
+          return nullptr;
+
+        symVar = this->symbolicVariables.get(id);
+        if (symVar == nullptr || symVar->getSymVarName() != symVarName)
+          return nullptr;
+
+        return symVar;
+      }
+
+
+      /* Returns the last symbolic variable created for a register or a memory address */
+      SymbolicVariable* SymbolicEngine::getSymbolicVariableFromOrigin(symkind_e kind, triton::__uint kindValue) const {
+        const std::unordered_map<triton::__uint, SymbolicVariable*>* variables = nullptr;
+
+        switch (kind) {
+          case triton::engines::symbolic::REG: variables = &this->registerVariables; break;
+          case triton::engines::symbolic::MEM: variables = &this->memoryVariables; break;
+          default:
+            return nullptr;
         }
-        return nullptr;
+
+        std::unordered_map<triton::__uint, SymbolicVariable*>::const_iterator it = variables->find(kindValue);
+        if (it == variables->end())
+          return nullptr;
+
+        return it->second;
+      }
+
+
+      /* Records a symbolic variable by id and by origin */
+      void SymbolicEngine::addSymbolicVariable(SymbolicVariable* symVar) {
+        this->symbolicVariables.set(symVar->getSymVarId(), symVar);
+
+        if (symVar->getSymVarKind() == triton::engines::symbolic::REG)
+          this->registerVariables[symVar->getSymVarKindValue()] = symVar;
+
+        else if (symVar->getSymVarKind() == triton::engines::symbolic::MEM)
+          this->memoryVariables[symVar->getSymVarKindValue()] = symVar;
       }
 
 
       /* Returns all symbolic variables */
-      const std::map<triton::__uint, SymbolicVariable*>& SymbolicEngine::getSymbolicVariables(void) const {
+      const IdTable<SymbolicVariable*>& SymbolicEngine::getSymbolicVariables(void) const {
         return this->symbolicVariables;
       }
 
@@ -285,7 +299,7 @@ namespace triton {
       /* Returns the symbolic address value */
       triton::uint8 SymbolicEngine::getSymbolicMemoryValue(triton::__uint address) {
         triton::arch::MemoryOperand mem(address, BYTE_SIZE, 0);
-        return this->getSymbolicMemoryValue(mem).convert_to<triton::uint8>();
+        return static_cast<triton::uint8>(this->buildSymbolicMemoryOperand(mem)->evaluate64());
       }
 
 
@@ -296,12 +310,26 @@ namespace triton {
       }
 
 
-      /* Returns the symbolic values of a memory area */
+      /* Returns the symbolic values of a memory area. Only the referenced bytes are evaluated, the pages without reference are concrete */
       std::vector<triton::uint8> SymbolicEngine::getSymbolicMemoryAreaValue(triton::__uint baseAddr, triton::uint32 size) {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area = triton::api.getLastMemoryAreaValue(baseAddr, size);
+        triton::uint32 index = 0;
+
+        while (index < size) {
+          triton::__uint addr   = baseAddr + index;
+          triton::__uint offset = addr & (MEMORY_PAGE_SIZE - 1);
+          triton::uint32 length = static_cast<triton::uint32>(std::min<triton::__uint>(size - index, MEMORY_PAGE_SIZE - offset));
+          const triton::__uint* ids = this->memoryReference.getPage(addr);
+
+          if (ids != nullptr) {
+            for (triton::uint32 i = 0; i < length; i++) {
+              if (ids[offset + i] != triton::engines::symbolic::UNSET)
+                area[index + i] = this->getSymbolicMemoryValue(addr + i);
+            }
+          }
 
-        for (triton::uint32 index = 0; index < size; index++)
-          area.push_back(this->getSymbolicMemoryValue(baseAddr+index));
+          index += length;
+        }
 
         return area;
       }
@@ -333,78 +361,536 @@ namespace triton {
       /* Creates a new symbolic expression with comment */
       SymbolicExpression* SymbolicEngine::newSymbolicExpression(triton::ast::AbstractNode* node, triton::engines::symbolic::symkind_e kind, const std::string& comment) {
         triton::__uint id = this->getUniqueSymExprId();
+        if (this->isOptimizationEnabled(triton::engines::symbolic::AST_REWRITING))
+          node = this->rewriteAst(node);
         node = this->processSimplification(node);
         SymbolicExpression* expr = new SymbolicExpression(node, id, kind, comment);
         if (expr == nullptr)
           throw std::runtime_error("SymbolicEngine::newSymbolicExpression(): not enough memory");
-        this->symbolicExpressions[id] = expr;
+        this->symbolicExpressions.set(id, expr);
+        this->addLargestSymbolicExpression(expr);
         return expr;
       }
 
 
       /* Removes the symbolic expression corresponding to the id */
       void SymbolicEngine::removeSymbolicExpression(triton::__uint symExprId) {
-        std::map<triton::__uint, triton::__uint>::iterator it;
-
-        if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end()) {
-          /* Delete and remove the pointer */
-          delete this->symbolicExpressions[symExprId];
-          this->symbolicExpressions.erase(symExprId);
-
-          /* Concretize the register if it exists */
-          for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
-            if (this->symbolicReg[i] == symExprId) {
-              this->symbolicReg[i] = triton::engines::symbolic::UNSET;
-              return;
-            }
+        /* The expression is deleted with its AST unless a copy of the engine shares it */
+        if (this->symbolicExpressions.remove(symExprId)) {
+          this->pinnedExpressions.erase(symExprId);
+
+          /* Concretize the registers and the memory which still refer to it */
+          std::vector<SymbolicLocation> locations = this->locations.take(symExprId);
+          for (std::vector<SymbolicLocation>::const_iterator it = locations.begin(); it != locations.end(); it++) {
+            if (!this->isLocationOf(symExprId, *it))
+              continue;
+            if (it->kind == triton::engines::symbolic::REG)
+              this->symbolicReg[it->value] = triton::engines::symbolic::UNSET;
+            else
+              this->concretizeMemory(it->value);
           }
+        }
+      }
 
-          /* Concretize the memory if it exists */
-          for (it = this->memoryReference.begin(); it != memoryReference.end(); it++) {
-            if (it->second == symExprId) {
-              this->concretizeMemory(it->first);
-              return;
-            }
+
+      /* Marks an expression. Its AST is queued instead of walked, so a long chain of references does not recurse */
+      void SymbolicEngine::markSymbolicExpression(triton::__uint symExprId, std::vector<bool>& marked, std::vector<triton::ast::AbstractNode*>& worklist) const {
+        SymbolicExpression* expr = this->symbolicExpressions.get(symExprId);
+
+        if (expr == nullptr || marked[symExprId])
+          return;
+
+        marked[symExprId] = true;
+        worklist.push_back(expr->getAst());
+      }
+
+
+      /*
+       * Mark and sweep over the graph of the expressions. The roots are the symbolic
+       * state and the ASTs are walked once whatever the number of expressions which
+       * share them. A reference marks the expression of its id, which is the one
+       * getFullAst() and the solver follow.
+       */
+      triton::__uint SymbolicEngine::collectSymbolicExpressions(const std::vector<SymbolicExpression*>& roots) {
+        std::vector<bool> marked(this->uniqueSymExprId, false);
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::vector<triton::__uint> dead;
+
+        /* The registers and the memory */
+        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
+          if (this->symbolicReg[i] != triton::engines::symbolic::UNSET)
+            this->markSymbolicExpression(this->symbolicReg[i], marked, worklist);
+        }
+
+        for (MemoryReferenceTable::const_iterator it = this->memoryReference.begin(); it != this->memoryReference.end(); it++)
+          this->markSymbolicExpression(it->second, marked, worklist);
+
+        /* The pinned expressions and the ones given by the caller */
+        for (std::set<triton::__uint>::const_iterator it = this->pinnedExpressions.begin(); it != this->pinnedExpressions.end(); it++)
+          this->markSymbolicExpression(*it, marked, worklist);
+
+        for (std::vector<SymbolicExpression*>::const_iterator it = roots.begin(); it != roots.end(); it++)
+          this->markSymbolicExpression((*it)->getId(), marked, worklist);
+
+        /* The ASTs of the aligned memory and of the path constraints */
+        const AlignedMemoryTable::EntryMap& aligned = this->alignedMemoryReference.getEntries();
+        for (AlignedMemoryTable::EntryMap::const_iterator it = aligned.begin(); it != aligned.end(); it++)
+          worklist.push_back(it->second.getAst());
+
+        for (std::vector<PathConstraint>::const_iterator it = this->pathConstraints->begin(); it != this->pathConstraints->end(); it++) {
+          const std::vector<std::tuple<bool, triton::__uint, triton::ast::AbstractNode*>>& branches = it->getBranchConstraints();
+          for (std::vector<std::tuple<bool, triton::__uint, triton::ast::AbstractNode*>>::const_iterator branch = branches.begin(); branch != branches.end(); branch++)
+            worklist.push_back(std::get<2>(*branch));
+        }
+
+        /* Mark */
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* node = worklist.back();
+          worklist.pop_back();
+
+          if (node == nullptr || !visited.insert(node).second)
+            continue;
+
+          if (node->getKind() == triton::ast::REFERENCE_NODE) {
+            this->markSymbolicExpression(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue(), marked, worklist);
+            continue;
           }
+
+          triton::ast::AstChilds& childs = node->getChilds();
+          for (triton::uint32 index = 0; index < childs.size(); index++)
+            worklist.push_back(childs[index]);
+        }
+
+        /* Sweep. The dead expressions are assigned nowhere, only their locations are dropped */
+        for (IdTable<SymbolicExpression*>::const_iterator it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++) {
+          if (!marked[it->first])
+            dead.push_back(it->first);
+        }
+
+        for (std::vector<triton::__uint>::const_iterator it = dead.begin(); it != dead.end(); it++) {
+          this->symbolicExpressions.remove(*it);
+          this->locations.take(*it);
+        }
+
+        /* The next automatic collection waits for the live expressions to double */
+        this->nextCollection = std::max(this->collectionThreshold, 2 * this->symbolicExpressions.size());
+
+        return dead.size();
+      }
+
+
+      /* Returns true if an automatic collection must be done */
+      bool SymbolicEngine::isSymbolicGarbageCollectionNeeded(void) const {
+        if (this->collectionThreshold == 0)
+          return false;
+        return this->symbolicExpressions.size() >= this->nextCollection;
+      }
+
+
+      /* Sets the threshold of the automatic collections, 0 disables them */
+      void SymbolicEngine::setSymbolicGarbageCollectionThreshold(triton::__uint threshold) {
+        this->collectionThreshold = threshold;
+        this->nextCollection      = threshold;
+      }
+
+
+      /* Returns the threshold of the automatic collections */
+      triton::__uint SymbolicEngine::getSymbolicGarbageCollectionThreshold(void) const {
+        return this->collectionThreshold;
+      }
+
+
+      /* Pins a symbolic expression */
+      void SymbolicEngine::pinSymbolicExpression(triton::__uint symExprId) {
+        if (!this->symbolicExpressions.exists(symExprId))
+          throw std::runtime_error("SymbolicEngine::pinSymbolicExpression(): symbolic expression id not found");
+        this->pinnedExpressions.insert(symExprId);
+      }
+
+
+      /* Unpins a symbolic expression */
+      void SymbolicEngine::unpinSymbolicExpression(triton::__uint symExprId) {
+        this->pinnedExpressions.erase(symExprId);
+      }
+
+
+      /* Returns true if the location still refers to the expression */
+      bool SymbolicEngine::isLocationOf(triton::__uint symExprId, const SymbolicLocation& location) const {
+        switch (location.kind) {
+          case triton::engines::symbolic::REG:
+            return location.value < this->numberOfRegisters && this->symbolicReg[location.value] == symExprId;
+          case triton::engines::symbolic::MEM:
+            return this->memoryReference.get(location.value) == symExprId;
+          default:
+            return false;
         }
+      }
+
+
+      /* Records a location of an expression. A stale first location is replaced, so an expression moved around does not pile up locations */
+      void SymbolicEngine::addLocation(triton::__uint symExprId, symkind_e kind, triton::__uint value) {
+        SymbolicLocation location = {value, kind};
+        SymbolicLocation first    = this->locations.getFirst(symExprId);
 
+        if (first.kind == kind && first.value == value)
+          return;
+
+        this->locations.add(symExprId, location, !this->isLocationOf(symExprId, first));
       }
 
 
       /* Gets the symbolic expression pointer from a symbolic id */
       SymbolicExpression* SymbolicEngine::getSymbolicExpressionFromId(triton::__uint symExprId) const {
-        if (this->symbolicExpressions.find(symExprId) == this->symbolicExpressions.end())
+        SymbolicExpression* expr = this->symbolicExpressions.get(symExprId);
+        if (expr == nullptr)
           throw std::runtime_error("SymbolicEngine::getSymbolicExpressionFromId(): symbolic expression id not found");
-        return this->symbolicExpressions.at(symExprId);
+        return expr;
       }
 
 
       /* Returns all symbolic expressions */
-      const std::map<triton::__uint, SymbolicExpression*>& SymbolicEngine::getSymbolicExpressions(void) const {
+      const IdTable<SymbolicExpression*>& SymbolicEngine::getSymbolicExpressions(void) const {
         return this->symbolicExpressions;
       }
 
 
+      /* Returns the shape of all ASTs. The expressions are walked by id, so a reference reaches an AST already visited */
+      triton::ast::AstStats SymbolicEngine::getAstStats(void) const {
+        std::vector<triton::ast::AbstractNode*> roots;
+
+        roots.reserve(this->symbolicExpressions.size());
+        for (IdTable<SymbolicExpression*>::const_iterator it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++)
+          roots.push_back(it->second->getAst());
+
+        return triton::ast::getAstStats(roots, true);
+      }
+
+
+      /* Orders the <tree size:id> of the symbolic expressions by decreasing tree size, then by id */
+      static bool isLargerTreeSize(const std::pair<triton::uint64, triton::__uint>& a, const std::pair<triton::uint64, triton::__uint>& b) {
+        if (a.first != b.first)
+          return a.first > b.first;
+        return a.second < b.second;
+      }
+
+
+      /* Records a new symbolic expression in the heap of the largest ones */
+      void SymbolicEngine::addLargestSymbolicExpression(const SymbolicExpression* expr) {
+        if (this->largestCapacity == 0)
+          return;
+
+        std::pair<triton::uint64, triton::__uint> entry(expr->getTreeSize(), expr->getId());
+
+        if (this->largestExpressions.size() < this->largestCapacity) {
+          this->largestExpressions.push_back(entry);
+          std::push_heap(this->largestExpressions.begin(), this->largestExpressions.end(), isLargerTreeSize);
+        }
+        else if (isLargerTreeSize(entry, this->largestExpressions.front())) {
+          std::pop_heap(this->largestExpressions.begin(), this->largestExpressions.end(), isLargerTreeSize);
+          this->largestExpressions.back() = entry;
+          std::push_heap(this->largestExpressions.begin(), this->largestExpressions.end(), isLargerTreeSize);
+        }
+      }
+
+
+      /*
+       * Returns the largest symbolic expressions. The first call walks all the
+       * expressions once, then the heap is updated when an expression is created.
+       * It is walked again when an AST was replaced since the heap was built.
+       */
+      std::vector<SymbolicExpression*> SymbolicEngine::getLargestSymbolicExpressions(triton::uint32 n) {
+        std::vector<std::pair<triton::uint64, triton::__uint>> sorted;
+        std::vector<SymbolicExpression*> exprs;
+        bool rebuild = (n > this->largestCapacity || this->largestGeneration != SymbolicExpression::getTreeSizeGeneration());
+
+        /* An expression of the heap was removed */
+        for (std::vector<std::pair<triton::uint64, triton::__uint>>::const_iterator it = this->largestExpressions.begin(); !rebuild && it != this->largestExpressions.end(); it++)
+          rebuild = !this->symbolicExpressions.exists(it->second);
+
+        if (rebuild) {
+          this->largestCapacity = std::max(n, this->largestCapacity);
+          this->largestExpressions.clear();
+          for (IdTable<SymbolicExpression*>::const_iterator it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++)
+            this->addLargestSymbolicExpression(it->second);
+          this->largestGeneration = SymbolicExpression::getTreeSizeGeneration();
+        }
+
+        sorted = this->largestExpressions;
+        std::sort(sorted.begin(), sorted.end(), isLargerTreeSize);
+
+        n = std::min(n, static_cast<triton::uint32>(sorted.size()));
+        for (triton::uint32 index = 0; index < n; index++)
+          exprs.push_back(this->symbolicExpressions.get(sorted[index].second));
+
+        return exprs;
+      }
+
+
+      /* Returns the backward slice of an expression */
+      SymbolicSlice SymbolicEngine::getBackwardSlice(triton::__uint symExprId) const {
+        if (!this->symbolicExpressions.exists(symExprId))
+          throw std::runtime_error("SymbolicEngine::getBackwardSlice(): symbolic expression id not found");
+        return SymbolicSlicer(this->symbolicExpressions, this->uniqueSymExprId).slice(symExprId);
+      }
+
+
+      /* Returns the backward slice of an AST */
+      SymbolicSlice SymbolicEngine::getBackwardSlice(triton::ast::AbstractNode* node) const {
+        if (node == nullptr)
+          throw std::runtime_error("SymbolicEngine::getBackwardSlice(): node cannot be null.");
+        return SymbolicSlicer(this->symbolicExpressions, this->uniqueSymExprId).slice(node);
+      }
+
+
+      /* Returns the slices of the path constraints. One slicer is shared, so an AST is walked once whatever the number of slices it is in */
+      std::vector<SymbolicSlice> SymbolicEngine::getPathConstraintsBackwardSlices(void) const {
+        SymbolicSlicer slicer(this->symbolicExpressions, this->uniqueSymExprId);
+        std::vector<SymbolicSlice> slices;
+
+        slices.reserve(this->pathConstraints->size());
+        for (std::vector<PathConstraint>::const_iterator it = this->pathConstraints->begin(); it != this->pathConstraints->end(); it++)
+          slices.push_back(slicer.slice(it->getTakenPathConstraintAst()));
+
+        return slices;
+      }
+
+
+      /* Saves the symbolic state. The expressions are written by id, so a reference is written after its target */
+      void SymbolicEngine::saveSymbolicState(const std::string& filename) const {
+        SymbolicStateWriter writer(triton::api.getArchitecture(), this->numberOfRegisters, this->uniqueSymExprId, this->uniqueSymVarId);
+
+        for (IdTable<SymbolicVariable*>::const_iterator it = this->symbolicVariables.begin(); it != this->symbolicVariables.end(); it++)
+          writer.addVariable(*it->second);
+
+        for (IdTable<SymbolicExpression*>::const_iterator it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++)
+          writer.addExpression(*it->second);
+
+        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
+          if (this->symbolicReg[i] != triton::engines::symbolic::UNSET)
+            writer.addRegister(i, this->symbolicReg[i]);
+        }
+
+        for (MemoryReferenceTable::const_iterator it = this->memoryReference.begin(); it != this->memoryReference.end(); it++)
+          writer.addMemory(it->first, it->second);
+
+        writer.save(filename);
+      }
+
+
+      /* Rebuilds a node whose childs are rebuilt */
+      static triton::ast::AbstractNode* loadAstNode(const SymbolicStateView& view, const SerializedNode& record, const std::vector<triton::ast::AbstractNode*>& childs) {
+        switch (record.kind) {
+          case triton::ast::DECIMAL_NODE:
+            return triton::ast::decimal(view.getValue(record.value, record.flags & SERIALIZED_INLINE_VALUE));
+
+          case triton::ast::REFERENCE_NODE:
+            return triton::ast::reference(record.value);
+
+          case triton::ast::STRING_NODE:
+            return triton::ast::string(view.getString(record.value));
+
+          case triton::ast::VARIABLE_NODE:
+            return triton::ast::variable(*triton::api.getSymbolicVariableFromId(record.value));
+
+          case triton::ast::BV_NODE:
+            return triton::ast::bv(view.getValue(record.value, record.flags & SERIALIZED_INLINE_VALUE), record.size);
+
+          case triton::ast::DECLARE_FUNCTION_NODE:
+          case triton::ast::LET_NODE:
+            if (childs.empty() || childs[0]->getKind() != triton::ast::STRING_NODE)
+              break;
+            return triton::ast::newInstance(static_cast<triton::ast::kind_e>(record.kind), childs);
+
+          case triton::ast::EXTRACT_NODE:
+            return triton::ast::newInstance(triton::ast::EXTRACT_NODE, childs, static_cast<triton::uint32>(record.value >> 32), static_cast<triton::uint32>(record.value));
+
+          case triton::ast::SX_NODE:
+          case triton::ast::ZX_NODE:
+            return triton::ast::newInstance(static_cast<triton::ast::kind_e>(record.kind), childs, static_cast<triton::uint32>(record.value));
+
+          default:
+            return triton::ast::newInstance(static_cast<triton::ast::kind_e>(record.kind), childs);
+        }
+
+        throw std::runtime_error("SymbolicEngine::loadSymbolicState(): Invalid node.");
+      }
+
+
+      /*
+       * Loads a symbolic state. The nodes are rebuilt in order and each expression
+       * is created as soon as its root is, so the references to it find it. The
+       * tables of expressions and variables are replaced during the rebuild and
+       * restored if it fails; the rest of the state is only replaced once the
+       * whole file is rebuilt.
+       */
+      void SymbolicEngine::loadSymbolicState(const std::string& filename) {
+        SymbolicStateView view(filename);
+        const SerializedHeader& header            = view.getHeader();
+        const SerializedNode* records             = view.getNodes();
+        const triton::uint32* childs              = view.getChilds();
+        const SerializedExpression* expressions   = view.getExpressions();
+        const SerializedVariable* variables       = view.getVariables();
+        IdTable<SymbolicExpression*> previousExpressions;
+        IdTable<SymbolicVariable*> previousVariables;
+        std::vector<std::pair<triton::ast::ReferenceNode*, triton::ast::AbstractNode*> > retargeted;
+        std::vector<triton::ast::AbstractNode*> nodes;
+        std::vector<std::pair<triton::uint64, triton::uint64> > roots;
+
+        if (header.architecture != triton::api.getArchitecture() || header.numberOfRegisters != this->numberOfRegisters)
+          throw std::runtime_error("SymbolicEngine::loadSymbolicState(): The state was saved with another architecture.");
+
+        /* The current tables are kept aside, a copy shares them */
+        previousExpressions = this->symbolicExpressions;
+        previousVariables   = this->symbolicVariables;
+        this->symbolicExpressions.clear();
+        this->symbolicVariables.clear();
+
+        try {
+          for (triton::uint64 index = 0; index < header.variables.count; index++) {
+            const SerializedVariable& record = variables[index];
+            SymbolicVariable* symVar = new SymbolicVariable(static_cast<symkind_e>(record.kind), record.kindValue, record.id, record.size, view.getString(record.comment), view.getConstant(record.concreteValue));
+            this->symbolicVariables.set(symVar->getSymVarId(), symVar);
+          }
+
+          /* The roots may be shared, or met before the ASTs of smaller ids */
+          for (triton::uint64 index = 0; index < header.expressions.count; index++)
+            roots.push_back(std::make_pair(expressions[index].root, index));
+          std::sort(roots.begin(), roots.end());
+
+          nodes.reserve(header.nodes.count);
+          std::vector<std::pair<triton::uint64, triton::uint64> >::iterator root = roots.begin();
+          for (triton::uint64 index = 0; index < header.nodes.count; index++) {
+            const SerializedNode& record = records[index];
+            std::vector<triton::ast::AbstractNode*> operands;
+
+            for (triton::uint32 child = 0; child < record.numberOfChilds; child++)
+              operands.push_back(nodes[childs[record.firstChild + child]]);
+
+            triton::ast::AbstractNode* node = loadAstNode(view, record, operands);
+
+            /* A shared reference may still point to a previous AST, it is restored if the load fails */
+            if (node->getKind() == triton::ast::REFERENCE_NODE && this->symbolicExpressions.exists(record.value)) {
+              triton::ast::ReferenceNode* ref = reinterpret_cast<triton::ast::ReferenceNode*>(node);
+              triton::ast::AbstractNode* ast  = this->symbolicExpressions.get(record.value)->getAst();
+              if (ref->getTarget() != ast) {
+                if (ref->getTarget() != nullptr)
+                  triton::api.retainAstNode(ref->getTarget());
+                retargeted.push_back(std::make_pair(ref, ref->getTarget()));
+                ref->setTarget(ast);
+              }
+            }
+
+            if (node->getBitvectorSize() != record.size)
+              throw std::runtime_error("SymbolicEngine::loadSymbolicState(): A node does not have its saved size.");
+
+            nodes.push_back(node);
+
+            for (; root != roots.end() && root->first == index; root++) {
+              const SerializedExpression& record = expressions[root->second];
+              SymbolicExpression* expr = new SymbolicExpression(node, record.id, static_cast<symkind_e>(record.kind), view.getString(record.comment));
+              this->symbolicExpressions.set(record.id, expr);
+              if (record.flags & SERIALIZED_ADDRESS)
+                expr->setAddress(record.address);
+              expr->isTainted = (record.flags & SERIALIZED_TAINTED) != 0;
+              if (record.originMemorySize != 0)
+                expr->setOriginMemory(triton::arch::MemoryOperand(record.originMemoryAddress, record.originMemorySize, view.getValue(record.originMemoryValue, record.flags & SERIALIZED_INLINE_MEMORY_VALUE)));
+              if (record.originRegister != triton::api.cpuInvalidRegister())
+                expr->setOriginRegister(triton::arch::RegisterOperand(record.originRegister, view.getValue(record.originRegisterValue, record.flags & SERIALIZED_INLINE_REGISTER_VALUE)));
+            }
+          }
+        }
+        catch (...) {
+          for (std::vector<std::pair<triton::ast::ReferenceNode*, triton::ast::AbstractNode*> >::reverse_iterator it = retargeted.rbegin(); it != retargeted.rend(); it++) {
+            it->first->setTarget(it->second);
+            if (it->second != nullptr)
+              triton::api.releaseAstNode(it->second);
+          }
+          this->symbolicExpressions = previousExpressions;
+          this->symbolicVariables   = previousVariables;
+          throw;
+        }
+
+        for (std::vector<std::pair<triton::ast::ReferenceNode*, triton::ast::AbstractNode*> >::const_iterator it = retargeted.begin(); it != retargeted.end(); it++) {
+          if (it->second != nullptr)
+            triton::api.releaseAstNode(it->second);
+        }
+
+        /* Everything is rebuilt, the rest of the current state is dropped */
+        this->largestExpressions.clear();
+        this->largestCapacity = 0;
+        this->registerVariables.clear();
+        this->memoryVariables.clear();
+        this->locations.clear();
+        this->pinnedExpressions.clear();
+        this->concretizeAllMemory();
+        this->concretizeAllRegister();
+        this->clearPathConstraints();
+
+        for (IdTable<SymbolicVariable*>::const_iterator it = this->symbolicVariables.begin(); it != this->symbolicVariables.end(); it++) {
+          if (it->second->getSymVarKind() == triton::engines::symbolic::REG)
+            this->registerVariables[it->second->getSymVarKindValue()] = it->second;
+          else if (it->second->getSymVarKind() == triton::engines::symbolic::MEM)
+            this->memoryVariables[it->second->getSymVarKindValue()] = it->second;
+        }
+
+        for (triton::uint64 index = 0; index < header.registers.count; index++) {
+          const SerializedReference& record = view.getRegisters()[index];
+          if (record.key < this->numberOfRegisters) {
+            this->symbolicReg[record.key] = record.id;
+            this->addLocation(record.id, triton::engines::symbolic::REG, record.key);
+          }
+        }
+
+        for (triton::uint64 index = 0; index < header.memory.count; index++)
+          this->addMemoryReference(view.getMemory()[index].key, view.getMemory()[index].id);
+
+        this->uniqueSymExprId = header.uniqueSymExprId;
+        this->uniqueSymVarId  = header.uniqueSymVarId;
+      }
+
+
       /* Returns the full symbolic expression backtracked. */
       triton::ast::AbstractNode* SymbolicEngine::getFullAst(triton::ast::AbstractNode* node) {
-        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> unrolled;
+        std::vector<triton::ast::AbstractNode*> nodes = triton::ast::postOrderTraversal(node, true);
+
+        /*
+         * Nodes come childs first. The given tree is not modified, a node is
+         * rebuilt only if one of its childs has been unrolled and the subtrees
+         * without references are shared with the given tree.
+         */
+        for (std::vector<triton::ast::AbstractNode*>::iterator it = nodes.begin(); it != nodes.end(); it++) {
+          triton::ast::AbstractNode* current = *it;
+
+          /* A reference is replaced by the AST of its expression */
+          if (current->getKind() == triton::ast::REFERENCE_NODE) {
+            triton::__uint id = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue();
+            unrolled[current] = unrolled.at(this->getSymbolicExpressionFromId(id)->getAst());
+            continue;
+          }
 
-        for (triton::uint32 index = 0; index < childs.size(); index++) {
-          if (childs[index]->getKind() == triton::ast::REFERENCE_NODE) {
-            triton::__uint id = reinterpret_cast<triton::ast::ReferenceNode*>(childs[index])->getValue();
-            triton::ast::AbstractNode* ref = this->getSymbolicExpressionFromId(id)->getAst();
-            childs[index] = ref;
+          triton::ast::AstChilds& childs = current->getChilds();
+          std::vector<triton::ast::AbstractNode*> newChilds;
+          bool changed = false;
+
+          newChilds.reserve(childs.size());
+          for (triton::uint32 index = 0; index < childs.size(); index++) {
+            triton::ast::AbstractNode* child = unrolled.at(childs[index]);
+            changed |= (child != childs[index]);
+            newChilds.push_back(child);
           }
-          this->getFullAst(childs[index]);
+
+          unrolled[current] = changed ? triton::ast::newInstance(current, newChilds) : current;
         }
 
-        return node;
+        return unrolled.at(node);
       }
 
 
       /* Returns a list which contains all tainted expressions */
       std::list<SymbolicExpression*> SymbolicEngine::getTaintedSymbolicExpressions(void) const {
-        std::map<triton::__uint, SymbolicExpression*>::const_iterator it;
+        IdTable<SymbolicExpression*>::const_iterator it;
         std::list<SymbolicExpression*> taintedExprs;
 
         for (it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++) {
@@ -417,7 +903,7 @@ namespace triton {
 
       /* Returns the list of the symbolic variables declared in the trace */
       std::string SymbolicEngine::getVariablesDeclaration(void) const {
-        std::map<triton::__uint, SymbolicVariable*>::const_iterator it;
+        IdTable<SymbolicVariable*>::const_iterator it;
         std::stringstream stream;
 
         for(it = this->symbolicVariables.begin(); it != this->symbolicVariables.end(); it++)
@@ -445,7 +931,7 @@ namespace triton {
       /* Returns the map of symbolic memory defined */
       std::map<triton::__uint, SymbolicExpression*> SymbolicEngine::getSymbolicMemory(void) const {
         std::map<triton::__uint, SymbolicExpression*> ret;
-        std::map<triton::__uint, triton::__uint>::const_iterator it;
+        MemoryReferenceTable::const_iterator it;
 
         for (it = this->memoryReference.begin(); it != this->memoryReference.end(); it++)
           ret[it->first] = this->getSymbolicExpressionFromId(it->second);
@@ -471,9 +957,7 @@ namespace triton {
             symVar->setSymVarConcreteValue(expression->getAst()->evaluate());
 
         tmp = triton::ast::variable(*symVar);
-        tmp->setParent(expression->getAst()->getParents());
         expression->setAst(tmp);
-        tmp->init();
 
         return symVar;
       }
@@ -508,22 +992,21 @@ namespace triton {
           memSymId = this->getSymbolicMemoryId(memAddr+index);
           if (memSymId == triton::engines::symbolic::UNSET) {
             se = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference");
-            se->setOriginMemory(triton::arch::MemoryOperand(memAddr+index, BYTE_SIZE, tmp->evaluate()));
+            se->setOriginMemory(triton::arch::MemoryOperand(memAddr+index, BYTE_SIZE, tmp->evaluate64()));
           }
           else {
             se = this->getSymbolicExpressionFromId(memSymId);
-            tmp->setParent(se->getAst()->getParents());
             se->setAst(tmp);
-            tmp->init();
-            se->setOriginMemory(triton::arch::MemoryOperand(memAddr+index, BYTE_SIZE, tmp->evaluate()));
+            se->setOriginMemory(triton::arch::MemoryOperand(memAddr+index, BYTE_SIZE, tmp->evaluate64()));
           }
 
           /* Add the new memory reference */
           this->addMemoryReference(memAddr+index, se->getId());
-          if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
-            removeAlignedMemory(memAddr+index);
         }
 
+        if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY))
+          this->removeAlignedMemory(memAddr, symVarSize);
+
         return symVar;
       }
 
@@ -551,6 +1034,7 @@ namespace triton {
           SymbolicExpression* se = this->newSymbolicExpression(tmp, triton::engines::symbolic::REG);
           se->setOriginRegister(reg);
           this->symbolicReg[parentId] = se->getId();
+          this->addLocation(se->getId(), triton::engines::symbolic::REG, parentId);
         }
 
         else {
@@ -563,9 +1047,7 @@ namespace triton {
           /* Create the AST node */
           triton::ast::AbstractNode* tmp = triton::ast::variable(*symVar);
           /* Set the AST node */
-          tmp->setParent(expression->getAst()->getParents());
           expression->setAst(tmp);
-          tmp->init();
         }
 
         return symVar;
@@ -580,7 +1062,7 @@ namespace triton {
         if (symVar == nullptr)
           throw std::runtime_error("SymbolicEngine::newSymbolicVariable(): Cannot allocate a new symbolic variable");
 
-        this->symbolicVariables[uniqueId] = symVar;
+        this->addSymbolicVariable(symVar);
         return symVar;
       }
 
@@ -605,8 +1087,13 @@ namespace triton {
         std::list<triton::ast::AbstractNode*> opVec;
 
         triton::ast::AbstractNode* tmp            = nullptr;
+        triton::ast::AbstractNode* source         = nullptr;
         triton::__uint address                    = mem.getAddress();
         triton::uint32 size                       = mem.getSize();
+        triton::uint32 high                       = 0;
+        triton::uint32 low                        = 0;
+        triton::uint32 bits                       = 0;
+        triton::uint512 chunk                     = 0;
         triton::__uint symMem                     = triton::engines::symbolic::UNSET;
         triton::uint8 concreteValue[DQQWORD_SIZE] = {0};
         triton::uint512 value                     = triton::api.getLastMemoryValue(mem);
@@ -618,42 +1105,92 @@ namespace triton {
          * If the memory access is aligned, don't split the memory.
          */
         if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY)) {
-          if (this->alignedMemoryReference.find(std::make_pair(address, size)) != this->alignedMemoryReference.end()) {
-            return this->alignedMemoryReference[std::make_pair(address, size)];
-          }
+          triton::ast::AbstractNode* aligned = this->alignedMemoryReference.get(address, size);
+          if (aligned != nullptr)
+            return aligned;
         }
 
+        /*
+         * Each byte is read from its own reference, from the highest address to
+         * the lowest. A store splits its value into byte extractions of a reference
+         * to the store expression, so the contiguous bytes of the same store are
+         * merged back into one extraction of that reference (or the reference
+         * itself), and the contiguous concrete bytes into one bit-vector. A load of
+         * bytes written by a single store is then O(1) nodes instead of O(size),
+         * and still depends on the store expression. The bytes of a symbolic
+         * variable are merged the same way over the variable.
+         */
         while (size) {
+          triton::ast::AbstractNode* byteSource = nullptr;
+          triton::uint32 byteHigh               = BYTE_SIZE_BIT - 1;
+          triton::uint32 byteLow                = 0;
+          triton::uint512 byteValue             = concreteValue[size - 1];
+
           symMem = this->getSymbolicMemoryId(address + size - 1);
           if (symMem != triton::engines::symbolic::UNSET) {
-            tmp = triton::ast::reference(symMem);
-            opVec.push_back(triton::ast::extract((BYTE_SIZE_BIT - 1), 0, tmp));
+            SymbolicExpression* expr = this->symbolicExpressions.get(symMem);
+            triton::ast::AbstractNode* ast = (expr != nullptr) ? expr->getAst() : nullptr;
+
+            if (ast != nullptr && ast->getKind() == triton::ast::BV_NODE) {
+              byteValue = ast->evaluate();
+            }
+            else if (ast != nullptr && ast->getKind() == triton::ast::EXTRACT_NODE && ast->getBitvectorSize() == BYTE_SIZE_BIT &&
+                     (ast->getChilds()[0]->getKind() == triton::ast::REFERENCE_NODE || ast->getChilds()[0]->getKind() == triton::ast::VARIABLE_NODE)) {
+              byteSource = ast->getChilds()[0];
+              byteHigh   = reinterpret_cast<triton::ast::ExtractNode*>(ast)->getHigh();
+              byteLow    = reinterpret_cast<triton::ast::ExtractNode*>(ast)->getLow();
+            }
+            else {
+              byteSource = triton::ast::reference(symMem);
+            }
+          }
+
+          /* Extend the current chunk with the byte if they are contiguous */
+          if (bits && source == nullptr && byteSource == nullptr) {
+            chunk = (chunk << BYTE_SIZE_BIT) | byteValue;
+            bits += BYTE_SIZE_BIT;
+          }
+          else if (bits && source != nullptr && source == byteSource && low == byteHigh + 1) {
+            low   = byteLow;
+            bits += BYTE_SIZE_BIT;
           }
           else {
-            tmp = triton::ast::bv(concreteValue[size - 1], BYTE_SIZE_BIT);
-            opVec.push_back(triton::ast::extract((BYTE_SIZE_BIT - 1), 0, tmp));
+            if (bits)
+              opVec.push_back(this->buildSymbolicMemoryChunk(source, high, low, chunk, bits));
+            source = byteSource;
+            high   = byteHigh;
+            low    = byteLow;
+            chunk  = byteValue;
+            bits   = BYTE_SIZE_BIT;
           }
+
           size--;
         }
 
-        switch (opVec.size()) {
-          case DQQWORD_SIZE:
-          case QQWORD_SIZE:
-          case DQWORD_SIZE:
-          case QWORD_SIZE:
-          case DWORD_SIZE:
-          case WORD_SIZE:
-            tmp = triton::ast::concat(opVec);
-            break;
-          case BYTE_SIZE:
-            tmp = opVec.front();
-            break;
-        }
+        if (bits)
+          opVec.push_back(this->buildSymbolicMemoryChunk(source, high, low, chunk, bits));
+
+        if (opVec.size() == 1)
+          tmp = opVec.front();
+        else
+          tmp = triton::ast::concat(opVec);
 
         return tmp;
       }
 
 
+      /* Returns the node of contiguous bytes read from the memory */
+      triton::ast::AbstractNode* SymbolicEngine::buildSymbolicMemoryChunk(triton::ast::AbstractNode* source, triton::uint32 high, triton::uint32 low, const triton::uint512& value, triton::uint32 bits) {
+        if (source == nullptr)
+          return triton::ast::bv(value, bits);
+
+        if (low == 0 && high + 1 == source->getBitvectorSize())
+          return source;
+
+        return triton::ast::extract(high, low, source);
+      }
+
+
       /* Returns a symbolic memory operand and defines the memory as input of the instruction */
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicMemoryOperand(triton::arch::Instruction& inst, triton::arch::MemoryOperand& mem) {
         triton::ast::AbstractNode* node = this->buildSymbolicMemoryOperand(mem);
@@ -691,17 +1228,23 @@ namespace triton {
 
       /* Returns the new symbolic memory expression */
       SymbolicExpression* SymbolicEngine::createSymbolicMemoryExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::MemoryOperand& mem, const std::string& comment) {
-        triton::ast::AbstractNode* tmp = nullptr;
-        std::list<triton::ast::AbstractNode*> ret;
+        triton::ast::AbstractNode* tmp    = nullptr;
+        triton::ast::AbstractNode* source = node;
 
-        SymbolicExpression* se   = nullptr;
-        triton::__uint address   = mem.getAddress();
-        triton::uint32 writeSize = mem.getSize();
+        SymbolicExpression* se    = nullptr;
+        SymbolicExpression* store = nullptr;
+        triton::__uint address    = mem.getAddress();
+        triton::uint32 writeSize  = mem.getSize();
 
-        /* Record the aligned memory for a symbolic optimization */
-        if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY)) {
-          this->removeAlignedMemory(address);
-          this->alignedMemoryReference[std::make_pair(address, writeSize)] = node;
+        /*
+         * A store of several bytes gets its own expression, and its bytes are
+         * extracted from a reference to it. A load of these bytes is then an
+         * extraction of that reference, which keeps its dependency on the store.
+         */
+        if (writeSize > 1) {
+          store = this->newSymbolicExpression(node, triton::engines::symbolic::UNDEF, "Temporary concatenation reference - " + comment);
+          store->setOriginMemory(triton::arch::MemoryOperand(address, writeSize, node->evaluate()));
+          source = triton::ast::reference(store->getId());
         }
 
         /*
@@ -710,33 +1253,30 @@ namespace triton {
          */
         while (writeSize) {
           /* Extract each byte of the memory */
-          tmp = triton::ast::extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
+          tmp = triton::ast::extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), source);
           se = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference - " + comment);
-          se->setOriginMemory(triton::arch::MemoryOperand(((address + writeSize) - 1), BYTE_SIZE, tmp->evaluate()));
-          ret.push_back(tmp);
+          se->setOriginMemory(triton::arch::MemoryOperand(((address + writeSize) - 1), BYTE_SIZE, tmp->evaluate64()));
           inst.addSymbolicExpression(se);
           /* Assign memory with little endian */
           this->addMemoryReference((address + writeSize) - 1, se->getId());
           writeSize--;
         }
 
-        /* If there is only one reference, we return the symbolic expression */
-        if (ret.size() == 1) {
-          if (tmp != nullptr)
-            mem.setConcreteValue(tmp->evaluate());
-          inst.setStoreAccess(mem, tmp);
-          return se;
+        /* If there are several bytes, we return the store expression */
+        if (store != nullptr) {
+          se  = store;
+          tmp = node;
+          inst.addSymbolicExpression(se);
         }
 
-        /* Otherwise, we return the concatenation of all symbolic expressions */
-        tmp = triton::ast::concat(ret);
         mem.setConcreteValue(tmp->evaluate());
+        inst.setStoreAccess(mem, tmp);
 
-        se  = this->newSymbolicExpression(tmp, triton::engines::symbolic::UNDEF, "Temporary concatenation reference - " + comment);
-        se->setOriginMemory(triton::arch::MemoryOperand(address, mem.getSize(), tmp->evaluate()));
+        /* Record the aligned memory for a symbolic optimization */
+        if (triton::api.isSymbolicOptimizationEnabled(triton::engines::symbolic::ALIGNED_MEMORY)) {
+          this->alignedMemoryReference.set(address, mem.getSize(), triton::ast::reference(se->getId()));
+        }
 
-        inst.setStoreAccess(mem, tmp);
-        inst.addSymbolicExpression(se);
         return se;
       }
 
@@ -801,7 +1341,7 @@ namespace triton {
       SymbolicExpression* SymbolicEngine::createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::RegisterOperand& flag, const std::string& comment) {
         if (!flag.isFlag())
           throw std::runtime_error("SymbolicEngine::createSymbolicFlagExpression(): The register must be a flag.");
-        flag.setConcreteValue(node->evaluate());
+        flag.setConcreteValue(node->evaluate64());
         triton::engines::symbolic::SymbolicExpression *se = this->newSymbolicExpression(node, triton::engines::symbolic::REG, comment);
         this->assignSymbolicExpressionToRegister(se, flag);
         inst.addSymbolicExpression(se);
@@ -820,7 +1360,8 @@ namespace triton {
 
       /* Adds and assign a new memory reference */
       void SymbolicEngine::addMemoryReference(triton::__uint mem, triton::__uint id) {
-        this->memoryReference[mem] = id;
+        this->memoryReference.set(mem, id);
+        this->addLocation(id, triton::engines::symbolic::MEM, mem);
       }
 
 
@@ -841,6 +1382,7 @@ namespace triton {
         se->setKind(triton::engines::symbolic::REG);
         se->setOriginRegister(reg);
         this->symbolicReg[id] = se->getId();
+        this->addLocation(se->getId(), triton::engines::symbolic::REG, id);
       }
 
 
@@ -854,6 +1396,10 @@ namespace triton {
         if (node->getBitvectorSize() != mem.getBitSize())
           throw std::runtime_error("SymbolicEngine::assignSymbolicExpressionToMemory(): The size of the symbolic expression is not equal to the memory access.");
 
+        /* The bytes are extracted from a reference to the expression, as for a store */
+        if (writeSize > 1)
+          node = triton::ast::reference(se->getId());
+
         /*
          * As the x86's memory can be accessed without alignment, each byte of the
          * memory must be assigned to an unique reference.
@@ -862,7 +1408,7 @@ namespace triton {
           /* Extract each byte of the memory */
           triton::ast::AbstractNode* tmp = triton::ast::extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
           SymbolicExpression* byteRef = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference");
-          byteRef->setOriginMemory(triton::arch::MemoryOperand(((address + writeSize) - 1), BYTE_SIZE, tmp->evaluate()));
+          byteRef->setOriginMemory(triton::arch::MemoryOperand(((address + writeSize) - 1), BYTE_SIZE, tmp->evaluate64()));
           /* Assign memory with little endian */
           this->addMemoryReference((address + writeSize) - 1, byteRef->getId());
           writeSize--;
@@ -884,9 +1430,7 @@ namespace triton {
 
       /* Returns true if the symbolic expression ID exists. */
       bool SymbolicEngine::isSymbolicExpressionIdExists(triton::__uint symExprId) const {
-        if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end())
-          return true;
-        return false;
+        return this->symbolicExpressions.exists(symExprId);
       }
 
 
@@ -5,9 +5,13 @@
 **  This program is under the terms of the LGPLv3 License.
 */
 
+#include <algorithm>
+#include <set>
 #include <stdexcept>
 #include <api.hpp>
 #include <astRepresentation.hpp>
+#include <astStats.hpp>
+#include <astTraversal.hpp>
 #include <symbolicExpression.hpp>
 
 
@@ -16,16 +20,27 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
+      triton::uint64 SymbolicExpression::treeSizeGeneration = 0;
+
+
       SymbolicExpression::SymbolicExpression(triton::ast::AbstractNode* node, triton::__uint id, symkind_e kind, const std::string& comment) : originRegister() {
-        this->comment       = comment;
-        this->ast           = node;
-        this->id            = id;
-        this->isTainted     = false;
-        this->kind          = kind;
+        this->address         = 0;
+        this->addressFlag     = false;
+        this->comment         = comment;
+        this->ast             = node;
+        this->id              = id;
+        this->isTainted       = false;
+        this->kind            = kind;
+        this->treeSize        = 0;
+        this->treeSizeVersion = 0;
+
+        /* The expression owns its AST */
+        triton::api.retainAstNode(this->ast);
       }
 
 
       SymbolicExpression::~SymbolicExpression() {
+        triton::api.releaseAstNode(this->ast);
       }
 
 
@@ -54,7 +69,8 @@ namespace triton {
 
 
       std::string SymbolicExpression::getFormattedId(void) const {
-        if (triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
+        if (triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION ||
+            triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_DAG_REPRESENTATION)
           return "ref!" + std::to_string(this->id);
 
         else if (triton::api.getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
@@ -69,7 +85,8 @@ namespace triton {
         if (this->getComment().empty())
           return "";
 
-        else if (triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
+        else if (triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION ||
+                 triton::api.getAstRepresentationMode() == triton::ast::representations::SMT_DAG_REPRESENTATION)
           return "; " + this->getComment();
 
         else if (triton::api.getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
@@ -95,10 +112,106 @@ namespace triton {
       }
 
 
+      triton::__uint SymbolicExpression::getAddress(void) const {
+        return this->address;
+      }
+
+
+      /* Orders the symbolic expressions by id */
+      static bool isOlderSymbolicExpression(const SymbolicExpression* a, const SymbolicExpression* b) {
+        return a->getId() < b->getId();
+      }
+
+
+      bool SymbolicExpression::hasAddress(void) const {
+        return this->addressFlag;
+      }
+
+
+      bool SymbolicExpression::isTreeSizeValid(void) const {
+        return this->treeSize != 0 && this->treeSizeVersion == SymbolicExpression::treeSizeGeneration;
+      }
+
+
+      triton::uint64 SymbolicExpression::getTreeSize(void) const {
+        std::vector<const SymbolicExpression*> pending;
+        std::vector<const SymbolicExpression*> worklist;
+        std::set<triton::__uint> visited;
+
+        if (this->isTreeSizeValid())
+          return this->treeSize;
+
+        /*
+         * The size is computed on demand. The referenced expressions whose size is
+         * not computed yet are collected first, then computed from the oldest one,
+         * as an expression only refers to older ones. A long chain of references
+         * is then not walked recursively.
+         */
+        worklist.push_back(this);
+        visited.insert(this->id);
+        while (!worklist.empty()) {
+          const SymbolicExpression* expr = worklist.back();
+          worklist.pop_back();
+          pending.push_back(expr);
+
+          std::vector<triton::ast::AbstractNode*> nodes = triton::ast::postOrderTraversal(expr->ast, false);
+          for (std::vector<triton::ast::AbstractNode*>::const_iterator it = nodes.begin(); it != nodes.end(); it++) {
+            if ((*it)->getKind() != triton::ast::REFERENCE_NODE)
+              continue;
+            triton::__uint id = reinterpret_cast<triton::ast::ReferenceNode*>(*it)->getValue();
+            if (!visited.insert(id).second || !triton::api.isSymbolicExpressionIdExists(id))
+              continue;
+            const SymbolicExpression* ref = triton::api.getSymbolicExpressionFromId(id);
+            if (!ref->isTreeSizeValid())
+              worklist.push_back(ref);
+          }
+        }
+
+        std::sort(pending.begin(), pending.end(), isOlderSymbolicExpression);
+        for (std::vector<const SymbolicExpression*>::const_iterator it = pending.begin(); it != pending.end(); it++) {
+          (*it)->treeSize        = triton::ast::getAstTreeSize((*it)->ast);
+          (*it)->treeSizeVersion = SymbolicExpression::treeSizeGeneration;
+        }
+
+        return this->treeSize;
+      }
+
+
+      triton::uint64 SymbolicExpression::getTreeSizeGeneration(void) {
+        return SymbolicExpression::treeSizeGeneration;
+      }
+
+
+      void SymbolicExpression::invalidateTreeSizes(void) {
+        SymbolicExpression::treeSizeGeneration++;
+      }
+
+
       void SymbolicExpression::setAst(triton::ast::AbstractNode* node) {
-        node->setParent(this->ast->getParents());
+        triton::ast::AbstractNode* old = this->ast;
+        triton::ast::AstParents& parents = old->getParents();
+
+        triton::api.retainAstNode(node);
+
+        /* References to this expression now point to the new AST */
+        for (triton::uint32 index = parents.size(); index > 0; index--) {
+          triton::ast::AbstractNode* parent = parents[index - 1];
+          if (parent->getKind() == triton::ast::REFERENCE_NODE && reinterpret_cast<triton::ast::ReferenceNode*>(parent)->getTarget() == old)
+            reinterpret_cast<triton::ast::ReferenceNode*>(parent)->setTarget(node);
+        }
+
         this->ast = node;
-        this->ast->init();
+        this->ast->invalidate();
+
+        /* The expressions which refer to this one have a stale size as well */
+        SymbolicExpression::invalidateTreeSizes();
+        triton::api.releaseAstNode(old);
+      }
+
+
+      void SymbolicExpression::setAddress(triton::__uint addr) {
+        this->address     = addr;
+        this->addressFlag = true;
       }
 
 
@@ -0,0 +1,99 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#include <symbolicLocations.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      SymbolicLocationIndex::SymbolicLocationIndex() {
+        this->clear();
+      }
+
+
+      SymbolicLocation SymbolicLocationIndex::getFirst(triton::__uint id) const {
+        SymbolicLocation none = {0, triton::engines::symbolic::UNDEF};
+        triton::__uint chunk  = id >> CHUNK_BITS;
+
+        if (chunk >= this->first->size() || (*this->first)[chunk] == nullptr)
+          return none;
+
+        return (*this->first)[chunk]->first[id & (CHUNK_SIZE - 1)];
+      }
+
+
+      SymbolicLocation& SymbolicLocationIndex::getWritableFirst(triton::__uint id) {
+        triton::__uint chunk = id >> CHUNK_BITS;
+
+        if (this->first.use_count() > 1)
+          this->first = std::make_shared<std::vector<std::shared_ptr<Chunk> > >(*this->first);
+
+        if (chunk >= this->first->size())
+          this->first->resize(chunk + 1);
+
+        std::shared_ptr<Chunk>& slots = (*this->first)[chunk];
+        if (slots == nullptr) {
+          SymbolicLocation none = {0, triton::engines::symbolic::UNDEF};
+          slots = std::make_shared<Chunk>();
+          for (triton::__uint index = 0; index < CHUNK_SIZE; index++)
+            slots->first[index] = none;
+        }
+        else if (slots.use_count() > 1)
+          slots = std::make_shared<Chunk>(*slots);
+
+        return slots->first[id & (CHUNK_SIZE - 1)];
+      }
+
+
+      std::unordered_multimap<triton::__uint, SymbolicLocation>& SymbolicLocationIndex::getWritableOthers(void) {
+        if (this->others.use_count() > 1)
+          this->others = std::make_shared<std::unordered_multimap<triton::__uint, SymbolicLocation> >(*this->others);
+        return *this->others;
+      }
+
+
+      void SymbolicLocationIndex::add(triton::__uint id, const SymbolicLocation& location, bool replaceFirst) {
+        if (replaceFirst || this->getFirst(id).kind == triton::engines::symbolic::UNDEF)
+          this->getWritableFirst(id) = location;
+        else
+          this->getWritableOthers().insert(std::make_pair(id, location));
+      }
+
+
+      std::vector<SymbolicLocation> SymbolicLocationIndex::take(triton::__uint id) {
+        std::vector<SymbolicLocation> locations;
+        SymbolicLocation location = this->getFirst(id);
+
+        if (location.kind != triton::engines::symbolic::UNDEF) {
+          locations.push_back(location);
+          this->getWritableFirst(id).kind = triton::engines::symbolic::UNDEF;
+
+          /* An id has other locations only if it has a first one */
+          if (this->others->count(id)) {
+            std::unordered_multimap<triton::__uint, SymbolicLocation>& others = this->getWritableOthers();
+            auto range = others.equal_range(id);
+            for (auto it = range.first; it != range.second; it++)
+              locations.push_back(it->second);
+            others.erase(range.first, range.second);
+          }
+        }
+
+        return locations;
+      }
+
+
+      void SymbolicLocationIndex::clear(void) {
+        this->first  = std::make_shared<std::vector<std::shared_ptr<Chunk> > >();
+        this->others = std::make_shared<std::unordered_multimap<triton::__uint, SymbolicLocation> >();
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
@@ -0,0 +1,371 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#include <algorithm>
+
+#include <api.hpp>
+#include <symbolicMemoryTable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      MemoryReferenceTable::const_iterator::const_iterator() {
+        this->offset = 0;
+      }
+
+
+      MemoryReferenceTable::const_iterator::const_iterator(PageMap::const_iterator page, PageMap::const_iterator last) {
+        this->page   = page;
+        this->last   = last;
+        this->offset = 0;
+        this->skip();
+      }
+
+
+      /* A page is allocated only while it has a byte referenced, so the loop ends on the page */
+      void MemoryReferenceTable::const_iterator::skip(void) {
+        for (; this->page != this->last; this->page++, this->offset = 0) {
+          for (; this->offset < MEMORY_PAGE_SIZE; this->offset++) {
+            triton::__uint id = this->page->second->ids[this->offset];
+            if (id != triton::engines::symbolic::UNSET) {
+              this->current = std::make_pair((this->page->first << MEMORY_PAGE_BITS) | this->offset, id);
+              return;
+            }
+          }
+        }
+        this->offset = 0;
+      }
+
+
+      const std::pair<triton::__uint, triton::__uint>& MemoryReferenceTable::const_iterator::operator*(void) const {
+        return this->current;
+      }
+
+
+      const std::pair<triton::__uint, triton::__uint>* MemoryReferenceTable::const_iterator::operator->(void) const {
+        return &this->current;
+      }
+
+
+      MemoryReferenceTable::const_iterator& MemoryReferenceTable::const_iterator::operator++(void) {
+        this->offset++;
+        this->skip();
+        return *this;
+      }
+
+
+      MemoryReferenceTable::const_iterator MemoryReferenceTable::const_iterator::operator++(int) {
+        const_iterator copy = *this;
+        ++(*this);
+        return copy;
+      }
+
+
+      bool MemoryReferenceTable::const_iterator::operator==(const const_iterator& other) const {
+        return this->page == other.page && this->offset == other.offset;
+      }
+
+
+      bool MemoryReferenceTable::const_iterator::operator!=(const const_iterator& other) const {
+        return !(*this == other);
+      }
+
+
+      MemoryReferenceTable::MemoryReferenceTable() {
+        this->pages          = std::make_shared<PageMap>();
+        this->count          = 0;
+        this->lastPageNumber = 0;
+        this->lastPage       = nullptr;
+      }
+
+
+      MemoryReferenceTable::MemoryReferenceTable(const MemoryReferenceTable& copy) {
+        this->pages          = copy.pages;
+        this->count          = copy.count;
+        this->lastPageNumber = 0;
+        this->lastPage       = nullptr;
+      }
+
+
+      MemoryReferenceTable& MemoryReferenceTable::operator=(const MemoryReferenceTable& other) {
+        this->pages    = other.pages;
+        this->count    = other.count;
+        this->lastPage = nullptr;
+        return *this;
+      }
+
+
+      MemoryReferencePage* MemoryReferenceTable::findPage(triton::__uint addr) const {
+        triton::__uint number = addr >> MEMORY_PAGE_BITS;
+
+        if (this->lastPage == nullptr || this->lastPageNumber != number) {
+          PageMap::const_iterator it = this->pages->find(number);
+          if (it == this->pages->end())
+            return nullptr;
+          this->lastPageNumber = number;
+          this->lastPage       = it->second.get();
+        }
+
+        return this->lastPage;
+      }
+
+
+      /* The map holds pointers, copying it does not copy the pages */
+      MemoryReferenceTable::PageMap& MemoryReferenceTable::getWritablePages(void) {
+        if (this->pages.use_count() > 1)
+          this->pages = std::make_shared<PageMap>(*this->pages);
+        return *this->pages;
+      }
+
+
+      /* The cache is moved to the copy, so the next reads see the writes */
+      MemoryReferencePage* MemoryReferenceTable::getWritablePage(PageMap::iterator it) {
+        if (it->second.use_count() > 1) {
+          if (this->lastPage == it->second.get())
+            this->lastPage = nullptr;
+          it->second = std::make_shared<MemoryReferencePage>(*it->second);
+        }
+        return it->second.get();
+      }
+
+
+      void MemoryReferenceTable::removePage(PageMap::iterator it) {
+        if (this->lastPage == it->second.get())
+          this->lastPage = nullptr;
+        this->pages->erase(it);
+      }
+
+
+      triton::__uint MemoryReferenceTable::get(triton::__uint addr) const {
+        MemoryReferencePage* page = this->findPage(addr);
+        if (page == nullptr)
+          return triton::engines::symbolic::UNSET;
+        return page->ids[addr & (MEMORY_PAGE_SIZE - 1)];
+      }
+
+
+      const triton::__uint* MemoryReferenceTable::getPage(triton::__uint addr) const {
+        MemoryReferencePage* page = this->findPage(addr);
+        return (page != nullptr) ? page->ids : nullptr;
+      }
+
+
+      void MemoryReferenceTable::set(triton::__uint addr, triton::__uint id) {
+        if (id == triton::engines::symbolic::UNSET) {
+          this->erase(addr);
+          return;
+        }
+
+        PageMap& pages = this->getWritablePages();
+        PageMap::iterator it = pages.find(addr >> MEMORY_PAGE_BITS);
+        MemoryReferencePage* page = nullptr;
+
+        if (it == pages.end()) {
+          std::shared_ptr<MemoryReferencePage> fresh = std::make_shared<MemoryReferencePage>();
+          for (triton::__uint offset = 0; offset < MEMORY_PAGE_SIZE; offset++)
+            fresh->ids[offset] = triton::engines::symbolic::UNSET;
+          fresh->count = 0;
+          page = fresh.get();
+          pages[addr >> MEMORY_PAGE_BITS] = fresh;
+        }
+        else
+          page = this->getWritablePage(it);
+
+        this->lastPageNumber = addr >> MEMORY_PAGE_BITS;
+        this->lastPage       = page;
+
+        triton::__uint& slot = page->ids[addr & (MEMORY_PAGE_SIZE - 1)];
+        if (slot == triton::engines::symbolic::UNSET) {
+          page->count++;
+          this->count++;
+        }
+        slot = id;
+      }
+
+
+      void MemoryReferenceTable::erase(triton::__uint addr) {
+        this->erase(addr, 1);
+      }
+
+
+      /* Concretizes the bytes a page at a time, the pages not allocated are skipped and the shared ones are copied only if they have a byte to concretize */
+      void MemoryReferenceTable::erase(triton::__uint addr, triton::__uint size) {
+        while (size) {
+          triton::__uint offset = addr & (MEMORY_PAGE_SIZE - 1);
+          triton::__uint length = std::min(size, MEMORY_PAGE_SIZE - offset);
+          const triton::__uint* ids = this->getPage(addr);
+          triton::__uint index = offset;
+
+          while (ids != nullptr && index < offset + length && ids[index] == triton::engines::symbolic::UNSET)
+            index++;
+
+          if (ids != nullptr && index < offset + length) {
+            PageMap::iterator it = this->getWritablePages().find(addr >> MEMORY_PAGE_BITS);
+            MemoryReferencePage* page = this->getWritablePage(it);
+            for (; index < offset + length; index++) {
+              if (page->ids[index] != triton::engines::symbolic::UNSET) {
+                page->ids[index] = triton::engines::symbolic::UNSET;
+                page->count--;
+                this->count--;
+              }
+            }
+            if (page->count == 0)
+              this->removePage(it);
+          }
+
+          addr += length;
+          size -= length;
+        }
+      }
+
+
+      void MemoryReferenceTable::clear(void) {
+        this->pages    = std::make_shared<PageMap>();
+        this->count    = 0;
+        this->lastPage = nullptr;
+      }
+
+
+      triton::__uint MemoryReferenceTable::size(void) const {
+        return this->count;
+      }
+
+
+      triton::__uint MemoryReferenceTable::getNumberOfPages(void) const {
+        return this->pages->size();
+      }
+
+
+      MemoryReferenceTable::const_iterator MemoryReferenceTable::begin(void) const {
+        return const_iterator(this->pages->begin(), this->pages->end());
+      }
+
+
+      MemoryReferenceTable::const_iterator MemoryReferenceTable::end(void) const {
+        return const_iterator(this->pages->end(), this->pages->end());
+      }
+
+
+
+      AlignedMemoryEntry::AlignedMemoryEntry(triton::uint32 size, triton::ast::AbstractNode* node) {
+        this->size = size;
+        this->node = node;
+        triton::api.retainAstNode(this->node);
+      }
+
+
+      AlignedMemoryEntry::AlignedMemoryEntry(const AlignedMemoryEntry& copy) {
+        this->size = copy.size;
+        this->node = copy.node;
+        triton::api.retainAstNode(this->node);
+      }
+
+
+      AlignedMemoryEntry::~AlignedMemoryEntry() {
+        triton::api.releaseAstNode(this->node);
+      }
+
+
+      AlignedMemoryEntry& AlignedMemoryEntry::operator=(const AlignedMemoryEntry& other) {
+        /* Retain first, both entries may hold the same AST */
+        triton::api.retainAstNode(other.node);
+        triton::api.releaseAstNode(this->node);
+        this->size = other.size;
+        this->node = other.node;
+        return *this;
+      }
+
+
+      triton::uint32 AlignedMemoryEntry::getSize(void) const {
+        return this->size;
+      }
+
+
+      triton::ast::AbstractNode* AlignedMemoryEntry::getAst(void) const {
+        return this->node;
+      }
+
+
+      AlignedMemoryTable::AlignedMemoryTable() {
+        this->entries = std::make_shared<EntryMap>();
+      }
+
+
+      AlignedMemoryTable::EntryMap& AlignedMemoryTable::getWritableEntries(void) {
+        if (this->entries.use_count() > 1)
+          this->entries = std::make_shared<EntryMap>(*this->entries);
+        return *this->entries;
+      }
+
+
+      triton::ast::AbstractNode* AlignedMemoryTable::get(triton::__uint addr, triton::uint32 size) const {
+        EntryMap::const_iterator it = this->entries->find(addr);
+        if (it == this->entries->end() || it->second.getSize() != size)
+          return nullptr;
+        return it->second.getAst();
+      }
+
+
+      void AlignedMemoryTable::set(triton::__uint addr, triton::uint32 size, triton::ast::AbstractNode* node) {
+        /* The range is free once erased, so the entry is always inserted */
+        this->erase(addr, size);
+        this->getWritableEntries().insert(std::make_pair(addr, AlignedMemoryEntry(size, node)));
+      }
+
+
+      /*
+       * The entries do not overlap, so only the previous one can start before the range and reach it.
+       * Every store erases its range, so the shared entries are copied only if there is something to erase.
+       */
+      void AlignedMemoryTable::erase(triton::__uint addr, triton::uint32 size) {
+        EntryMap::const_iterator found = this->entries->lower_bound(addr);
+        bool overlap = (found != this->entries->end() && found->first < addr + size);
+
+        if (!overlap && found != this->entries->begin()) {
+          EntryMap::const_iterator prev = found;
+          prev--;
+          overlap = (prev->first + prev->second.getSize() > addr);
+        }
+
+        if (!overlap)
+          return;
+
+        EntryMap& entries = this->getWritableEntries();
+        EntryMap::iterator it = entries.lower_bound(addr);
+
+        if (it != entries.begin()) {
+          EntryMap::iterator prev = it;
+          prev--;
+          if (prev->first + prev->second.getSize() > addr)
+            entries.erase(prev);
+        }
+
+        while (it != entries.end() && it->first < addr + size)
+          it = entries.erase(it);
+      }
+
+
+      void AlignedMemoryTable::clear(void) {
+        this->entries = std::make_shared<EntryMap>();
+      }
+
+
+      triton::__uint AlignedMemoryTable::size(void) const {
+        return this->entries->size();
+      }
+
+
+      const AlignedMemoryTable::EntryMap& AlignedMemoryTable::getEntries(void) const {
+        return *this->entries;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
@@ -0,0 +1,616 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <api.hpp>
+#include <symbolicSerialization.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* Returns `offset` rounded up to the alignment of the sections */
+      static triton::uint64 alignSection(triton::uint64 offset) {
+        return (offset + 7) & ~static_cast<triton::uint64>(7);
+      }
+
+
+      /* Orders the serialized expressions by id */
+      static bool isLowerExpressionId(const SerializedExpression& expr, triton::uint64 id) {
+        return expr.id < id;
+      }
+
+
+      /* Returns true if an expression of the sorted records has this id */
+      static bool hasExpressionId(const SerializedExpression* expressions, triton::uint64 count, triton::uint64 id) {
+        const SerializedExpression* it = std::lower_bound(expressions, expressions + count, id, isLowerExpressionId);
+        return it != expressions + count && it->id == id;
+      }
+
+
+      /* Returns true if a node of this kind may be rebuilt with this number of childs */
+      static bool isValidArity(triton::uint32 kind, triton::uint32 numberOfChilds) {
+        switch (kind) {
+          case triton::ast::BV_NODE:
+          case triton::ast::DECIMAL_NODE:
+          case triton::ast::REFERENCE_NODE:
+          case triton::ast::STRING_NODE:
+          case triton::ast::VARIABLE_NODE:
+            return numberOfChilds == 0;
+
+          case triton::ast::ASSERT_NODE:
+          case triton::ast::BVNEG_NODE:
+          case triton::ast::BVNOT_NODE:
+          case triton::ast::EXTRACT_NODE:
+          case triton::ast::LNOT_NODE:
+          case triton::ast::SX_NODE:
+          case triton::ast::ZX_NODE:
+            return numberOfChilds == 1;
+
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVASHR_NODE:
+          case triton::ast::BVLSHR_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVROL_NODE:
+          case triton::ast::BVROR_NODE:
+          case triton::ast::BVSDIV_NODE:
+          case triton::ast::BVSGE_NODE:
+          case triton::ast::BVSGT_NODE:
+          case triton::ast::BVSHL_NODE:
+          case triton::ast::BVSLE_NODE:
+          case triton::ast::BVSLT_NODE:
+          case triton::ast::BVSMOD_NODE:
+          case triton::ast::BVSREM_NODE:
+          case triton::ast::BVSUB_NODE:
+          case triton::ast::BVUDIV_NODE:
+          case triton::ast::BVUGE_NODE:
+          case triton::ast::BVUGT_NODE:
+          case triton::ast::BVULE_NODE:
+          case triton::ast::BVULT_NODE:
+          case triton::ast::BVUREM_NODE:
+          case triton::ast::BVXNOR_NODE:
+          case triton::ast::BVXOR_NODE:
+          case triton::ast::DECLARE_FUNCTION_NODE:
+          case triton::ast::DISTINCT_NODE:
+          case triton::ast::EQUAL_NODE:
+          case triton::ast::LAND_NODE:
+          case triton::ast::LOR_NODE:
+            return numberOfChilds == 2;
+
+          case triton::ast::ITE_NODE:
+          case triton::ast::LET_NODE:
+            return numberOfChilds == 3;
+
+          case triton::ast::COMPOUND_NODE:
+          case triton::ast::CONCAT_NODE:
+            return numberOfChilds >= 1;
+
+          default:
+            return false;
+        }
+      }
+
+
+      SymbolicStateWriter::SymbolicStateWriter(triton::uint32 architecture, triton::uint32 numberOfRegisters, triton::__uint uniqueSymExprId, triton::__uint uniqueSymVarId) {
+        std::memset(&this->header, 0, sizeof(this->header));
+        std::memcpy(this->header.magic, SERIALIZED_MAGIC, sizeof(this->header.magic));
+        this->header.version            = SERIALIZED_VERSION;
+        this->header.byteOrder          = SERIALIZED_BYTE_ORDER;
+        this->header.architecture       = architecture;
+        this->header.numberOfRegisters  = numberOfRegisters;
+        this->header.uniqueSymExprId    = uniqueSymExprId;
+        this->header.uniqueSymVarId     = uniqueSymVarId;
+
+        /* The offset 0 is the empty string */
+        this->strings.push_back('\0');
+      }
+
+
+      SymbolicStateWriter::~SymbolicStateWriter() {
+      }
+
+
+      triton::uint64 SymbolicStateWriter::addConstant(const triton::uint512& value) {
+        std::map<triton::uint512, triton::uint64>::const_iterator it = this->constantIndexes.find(value);
+        SerializedConstant constant;
+
+        if (it != this->constantIndexes.end())
+          return it->second;
+
+        for (triton::uint32 index = 0; index < 8; index++)
+          constant.words[index] = ((value >> (64 * index)) & 0xffffffffffffffff).convert_to<triton::uint64>();
+
+        this->constants.push_back(constant);
+        this->constantIndexes[value] = this->constants.size() - 1;
+        return this->constants.size() - 1;
+      }
+
+
+      triton::uint64 SymbolicStateWriter::addValue(const triton::uint512& value, triton::uint32& flags, triton::uint32 inlineFlag) {
+        if (value > 0xffffffffffffffff)
+          return this->addConstant(value);
+
+        flags |= inlineFlag;
+        return value.convert_to<triton::uint64>();
+      }
+
+
+      triton::uint64 SymbolicStateWriter::addString(const std::string& value) {
+        triton::uint64 offset = this->strings.size();
+
+        if (value.empty())
+          return 0;
+
+        this->strings.append(value.c_str());
+        this->strings.push_back('\0');
+        return offset;
+      }
+
+
+      bool SymbolicStateWriter::isKeptReference(triton::ast::AbstractNode* node) const {
+        triton::ast::ReferenceNode* ref = reinterpret_cast<triton::ast::ReferenceNode*>(node);
+        return ref->getTarget() == nullptr || this->written.find(ref->getValue()) != this->written.end();
+      }
+
+
+      void SymbolicStateWriter::addNode(triton::ast::AbstractNode* node) {
+        triton::ast::AstChilds& childs = node->getChilds();
+        SerializedNode record;
+
+        record.kind           = node->getKind();
+        record.size           = node->getBitvectorSize();
+        record.numberOfChilds = 0;
+        record.flags          = 0;
+        record.firstChild     = this->childs.size();
+        record.value          = 0;
+
+        switch (node->getKind()) {
+          case triton::ast::BV_NODE:
+            record.value = this->addValue(reinterpret_cast<triton::ast::BvNode*>(node)->getValue(), record.flags, SERIALIZED_INLINE_VALUE);
+            break;
+
+          case triton::ast::DECIMAL_NODE:
+            record.value = this->addValue(reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue(), record.flags, SERIALIZED_INLINE_VALUE);
+            break;
+
+          case triton::ast::EXTRACT_NODE:
+            record.value = (static_cast<triton::uint64>(reinterpret_cast<triton::ast::ExtractNode*>(node)->getHigh()) << 32) | reinterpret_cast<triton::ast::ExtractNode*>(node)->getLow();
+            break;
+
+          case triton::ast::REFERENCE_NODE:
+            record.value = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+            break;
+
+          case triton::ast::STRING_NODE:
+            record.value = this->addString(reinterpret_cast<triton::ast::StringNode*>(node)->getValue());
+            break;
+
+          case triton::ast::SX_NODE:
+            record.value = reinterpret_cast<triton::ast::SxNode*>(node)->getSizeExt();
+            break;
+
+          case triton::ast::VARIABLE_NODE:
+            record.value = reinterpret_cast<triton::ast::VariableNode*>(node)->getSymVarId();
+            break;
+
+          case triton::ast::ZX_NODE:
+            record.value = reinterpret_cast<triton::ast::ZxNode*>(node)->getSizeExt();
+            break;
+
+          default:
+            break;
+        }
+
+        if (node->getKind() != triton::ast::REFERENCE_NODE) {
+          for (triton::uint32 index = 0; index < childs.size(); index++)
+            this->childs.push_back(this->indexes.at(childs[index]));
+          record.numberOfChilds = childs.size();
+        }
+
+        this->indexes[node] = this->nodes.size();
+        this->nodes.push_back(record);
+      }
+
+
+      triton::uint32 SymbolicStateWriter::addAst(triton::ast::AbstractNode* root) {
+        std::vector<std::pair<triton::ast::AbstractNode*, triton::uint32> > stack;
+        std::unordered_set<triton::ast::AbstractNode*> pending;
+
+        if (this->indexes.find(root) == this->indexes.end()) {
+          pending.insert(root);
+          stack.push_back(std::make_pair(root, 0));
+        }
+
+        while (!stack.empty()) {
+          triton::ast::AbstractNode* node = stack.back().first;
+          triton::ast::AbstractNode* dep  = nullptr;
+          triton::uint32& next            = stack.back().second;
+
+          /* Look for the next dependency not written yet. An unrolled reference depends on its target */
+          if (node->getKind() == triton::ast::REFERENCE_NODE) {
+            if (next == 0 && !this->isKeptReference(node)) {
+              next++;
+              dep = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getTarget();
+              if (this->indexes.find(dep) != this->indexes.end())
+                dep = nullptr;
+            }
+          }
+          else {
+            triton::ast::AstChilds& childs = node->getChilds();
+            while (dep == nullptr && next < childs.size()) {
+              if (this->indexes.find(childs[next]) == this->indexes.end())
+                dep = childs[next];
+              next++;
+            }
+          }
+
+          if (dep != nullptr) {
+            if (pending.find(dep) != pending.end())
+              throw std::runtime_error("SymbolicStateWriter::addAst(): The references of the AST are cyclic.");
+            pending.insert(dep);
+            stack.push_back(std::make_pair(dep, 0));
+            continue;
+          }
+
+          stack.pop_back();
+          pending.erase(node);
+
+          if (node->getKind() == triton::ast::REFERENCE_NODE && !this->isKeptReference(node))
+            this->indexes[node] = this->indexes.at(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getTarget());
+          else
+            this->addNode(node);
+        }
+
+        return this->indexes.at(root);
+      }
+
+
+      void SymbolicStateWriter::addExpression(const SymbolicExpression& expr) {
+        SerializedExpression record;
+
+        record.id                   = expr.getId();
+        record.root                 = this->addAst(expr.getAst());
+        record.address              = expr.getAddress();
+        record.comment              = this->addString(expr.getComment());
+        record.originMemoryAddress  = expr.getOriginMemory().getAddress();
+        record.originMemorySize     = expr.getOriginMemory().getSize();
+        record.originMemoryValue    = 0;
+        record.originRegister       = expr.getOriginRegister().getId();
+        record.originRegisterValue  = 0;
+        record.kind                 = expr.getKind();
+        record.flags                = (expr.isTainted ? SERIALIZED_TAINTED : 0) | (expr.hasAddress() ? SERIALIZED_ADDRESS : 0);
+
+        /* The concrete values are only written for an origin */
+        if (record.originMemorySize != 0)
+          record.originMemoryValue = this->addValue(expr.getOriginMemory().getConcreteValue(), record.flags, SERIALIZED_INLINE_MEMORY_VALUE);
+        else
+          record.flags |= SERIALIZED_INLINE_MEMORY_VALUE;
+
+        if (record.originRegister != triton::api.cpuInvalidRegister())
+          record.originRegisterValue = this->addValue(expr.getOriginRegister().getConcreteValue(), record.flags, SERIALIZED_INLINE_REGISTER_VALUE);
+        else
+          record.flags |= SERIALIZED_INLINE_REGISTER_VALUE;
+
+        this->expressions.push_back(record);
+        this->written.insert(expr.getId());
+      }
+
+
+      void SymbolicStateWriter::addVariable(const SymbolicVariable& symVar) {
+        SerializedVariable record;
+
+        record.id             = symVar.getSymVarId();
+        record.kindValue      = symVar.getSymVarKindValue();
+        record.comment        = this->addString(symVar.getSymVarComment());
+        record.concreteValue  = this->addConstant(symVar.getConcreteValue());
+        record.kind           = symVar.getSymVarKind();
+        record.size           = symVar.getSymVarSize();
+
+        this->variables.push_back(record);
+      }
+
+
+      void SymbolicStateWriter::addRegister(triton::uint32 regId, triton::__uint symExprId) {
+        SerializedReference record = {regId, symExprId};
+        this->registers.push_back(record);
+      }
+
+
+      void SymbolicStateWriter::addMemory(triton::__uint address, triton::__uint symExprId) {
+        SerializedReference record = {address, symExprId};
+        this->memory.push_back(record);
+      }
+
+
+      void SymbolicStateWriter::save(const std::string& filename) {
+        std::ofstream file(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        triton::uint64 offset = sizeof(SerializedHeader);
+        const char padding[8] = {0};
+
+        if (!file.is_open())
+          throw std::runtime_error("SymbolicStateWriter::save(): Cannot open the file.");
+
+        /* Lay out the sections */
+        struct { SerializedSection* section; const void* data; triton::uint64 count; triton::uint64 recordSize; } sections[] = {
+          {&this->header.nodes,       this->nodes.data(),       this->nodes.size(),       sizeof(SerializedNode)},
+          {&this->header.childs,      this->childs.data(),      this->childs.size(),      sizeof(triton::uint32)},
+          {&this->header.constants,   this->constants.data(),   this->constants.size(),   sizeof(SerializedConstant)},
+          {&this->header.strings,     this->strings.data(),     this->strings.size(),     sizeof(char)},
+          {&this->header.expressions, this->expressions.data(), this->expressions.size(), sizeof(SerializedExpression)},
+          {&this->header.variables,   this->variables.data(),   this->variables.size(),   sizeof(SerializedVariable)},
+          {&this->header.registers,   this->registers.data(),   this->registers.size(),   sizeof(SerializedReference)},
+          {&this->header.memory,      this->memory.data(),      this->memory.size(),      sizeof(SerializedReference)},
+        };
+
+        for (auto& s : sections) {
+          offset              = alignSection(offset);
+          s.section->offset   = offset;
+          s.section->count    = s.count;
+          offset             += s.count * s.recordSize;
+        }
+
+        /* Then write them */
+        file.write(reinterpret_cast<const char*>(&this->header), sizeof(this->header));
+        offset = sizeof(SerializedHeader);
+        for (auto& s : sections) {
+          file.write(padding, alignSection(offset) - offset);
+          file.write(reinterpret_cast<const char*>(s.data), s.count * s.recordSize);
+          offset = s.section->offset + s.count * s.recordSize;
+        }
+
+        if (!file.good())
+          throw std::runtime_error("SymbolicStateWriter::save(): Cannot write the file.");
+      }
+
+
+      SymbolicStateView::SymbolicStateView(const std::string& filename) {
+        this->data    = nullptr;
+        this->size    = 0;
+        this->mapped  = false;
+
+        #if defined(__unix__) || defined(__APPLE__)
+        int fd = open(filename.c_str(), O_RDONLY);
+        struct stat st;
+
+        if (fd < 0)
+          throw std::runtime_error("SymbolicStateView::SymbolicStateView(): Cannot open the file.");
+
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+          void* area = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+          if (area != MAP_FAILED) {
+            this->data    = reinterpret_cast<const triton::uint8*>(area);
+            this->size    = st.st_size;
+            this->mapped  = true;
+          }
+        }
+        close(fd);
+        #endif
+
+        /* Read the file if it cannot be mapped, the buffer is aligned for the records */
+        if (this->data == nullptr) {
+          std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+          if (!file.is_open())
+            throw std::runtime_error("SymbolicStateView::SymbolicStateView(): Cannot open the file.");
+
+          this->size = static_cast<std::size_t>(file.tellg());
+          triton::uint64* buffer = new triton::uint64[(this->size + 7) / 8 + 1];
+          file.seekg(0);
+          file.read(reinterpret_cast<char*>(buffer), this->size);
+          this->data = reinterpret_cast<const triton::uint8*>(buffer);
+
+          if (!file.good()) {
+            delete[] buffer;
+            throw std::runtime_error("SymbolicStateView::SymbolicStateView(): Cannot read the file.");
+          }
+        }
+
+        try {
+          this->check();
+        }
+        catch (...) {
+          this->release();
+          throw;
+        }
+      }
+
+
+      SymbolicStateView::~SymbolicStateView() {
+        this->release();
+      }
+
+
+      void SymbolicStateView::release(void) {
+        #if defined(__unix__) || defined(__APPLE__)
+        if (this->mapped)
+          munmap(const_cast<triton::uint8*>(this->data), this->size);
+        #endif
+        if (!this->mapped)
+          delete[] reinterpret_cast<const triton::uint64*>(this->data);
+        this->data = nullptr;
+      }
+
+
+      const void* SymbolicStateView::getSection(const SerializedSection& section, std::size_t recordSize) const {
+        if (section.offset % 8 || section.offset > this->size || section.count > (this->size - section.offset) / recordSize)
+          throw std::runtime_error("SymbolicStateView::getSection(): The section is out of the file.");
+        return this->data + section.offset;
+      }
+
+
+      void SymbolicStateView::check(void) const {
+        if (this->size < sizeof(SerializedHeader))
+          throw std::runtime_error("SymbolicStateView::check(): The file is too small.");
+
+        const SerializedHeader& header = this->getHeader();
+        if (std::memcmp(header.magic, SERIALIZED_MAGIC, sizeof(header.magic)) != 0)
+          throw std::runtime_error("SymbolicStateView::check(): The file is not a symbolic state.");
+
+        if (header.version != SERIALIZED_VERSION || header.byteOrder != SERIALIZED_BYTE_ORDER)
+          throw std::runtime_error("SymbolicStateView::check(): Unsupported version or byte order.");
+
+        const SerializedNode* nodes               = this->getNodes();
+        const triton::uint32* childs              = this->getChilds();
+        const SerializedExpression* expressions   = this->getExpressions();
+        const SerializedVariable* variables       = this->getVariables();
+        const char* strings                       = reinterpret_cast<const char*>(this->getSection(header.strings, sizeof(char)));
+
+        this->getSection(header.constants, sizeof(SerializedConstant));
+        this->getRegisters();
+        this->getMemory();
+
+        if (header.strings.count == 0 || strings[header.strings.count - 1] != '\0')
+          throw std::runtime_error("SymbolicStateView::check(): The strings are not terminated.");
+
+        /* The childs of a node are written before it, so the nodes may be rebuilt in order */
+        for (triton::uint64 index = 0; index < header.nodes.count; index++) {
+          const SerializedNode& node = nodes[index];
+
+          if (!isValidArity(node.kind, node.numberOfChilds))
+            throw std::runtime_error("SymbolicStateView::check(): Invalid kind or number of childs of a node.");
+
+          if (node.firstChild > header.childs.count || node.numberOfChilds > header.childs.count - node.firstChild)
+            throw std::runtime_error("SymbolicStateView::check(): The childs of a node are out of the file.");
+
+          for (triton::uint32 child = 0; child < node.numberOfChilds; child++) {
+            if (childs[node.firstChild + child] >= index)
+              throw std::runtime_error("SymbolicStateView::check(): A node is written before its childs.");
+          }
+
+          if (((node.kind == triton::ast::BV_NODE || node.kind == triton::ast::DECIMAL_NODE) && !(node.flags & SERIALIZED_INLINE_VALUE) && node.value >= header.constants.count) ||
+              (node.kind == triton::ast::STRING_NODE && node.value >= header.strings.count))
+            throw std::runtime_error("SymbolicStateView::check(): The value of a node is out of the file.");
+
+          /* A new expression would take the id a reference points to */
+          if (node.kind == triton::ast::REFERENCE_NODE && node.value >= header.uniqueSymExprId)
+            throw std::runtime_error("SymbolicStateView::check(): A reference is above the next symbolic expression id.");
+        }
+
+        /*
+         * The ids are checked against the next ids of the header, otherwise the engine
+         * would give the id of a loaded object to a new one and the tables would delete
+         * the loaded object. They are sorted so that each one is loaded once.
+         */
+        for (triton::uint64 index = 0; index < header.expressions.count; index++) {
+          const SerializedExpression& expr = expressions[index];
+          if (expr.root >= header.nodes.count || expr.comment >= header.strings.count ||
+              (!(expr.flags & SERIALIZED_INLINE_MEMORY_VALUE) && expr.originMemoryValue >= header.constants.count) ||
+              (!(expr.flags & SERIALIZED_INLINE_REGISTER_VALUE) && expr.originRegisterValue >= header.constants.count))
+            throw std::runtime_error("SymbolicStateView::check(): A symbolic expression is out of the file.");
+
+          if (expr.id >= header.uniqueSymExprId || (index > 0 && expr.id <= expressions[index - 1].id))
+            throw std::runtime_error("SymbolicStateView::check(): Invalid or unsorted symbolic expression id.");
+        }
+
+        for (triton::uint64 index = 0; index < header.variables.count; index++) {
+          const SerializedVariable& symVar = variables[index];
+          if (symVar.comment >= header.strings.count || symVar.concreteValue >= header.constants.count)
+            throw std::runtime_error("SymbolicStateView::check(): A symbolic variable is out of the file.");
+
+          if (symVar.id >= header.uniqueSymVarId || (index > 0 && symVar.id <= variables[index - 1].id))
+            throw std::runtime_error("SymbolicStateView::check(): Invalid or unsorted symbolic variable id.");
+        }
+
+        /* The registers and the memory are assigned to loaded expressions */
+        for (triton::uint64 index = 0; index < header.registers.count; index++) {
+          const SerializedReference& reg = this->getRegisters()[index];
+          if (reg.key >= header.numberOfRegisters || !hasExpressionId(expressions, header.expressions.count, reg.id))
+            throw std::runtime_error("SymbolicStateView::check(): A symbolic register is not assigned to a loaded expression.");
+        }
+
+        for (triton::uint64 index = 0; index < header.memory.count; index++) {
+          if (!hasExpressionId(expressions, header.expressions.count, this->getMemory()[index].id))
+            throw std::runtime_error("SymbolicStateView::check(): A symbolic memory cell is not assigned to a loaded expression.");
+        }
+      }
+
+
+      const SerializedHeader& SymbolicStateView::getHeader(void) const {
+        return *reinterpret_cast<const SerializedHeader*>(this->data);
+      }
+
+
+      const SerializedNode* SymbolicStateView::getNodes(void) const {
+        return reinterpret_cast<const SerializedNode*>(this->getSection(this->getHeader().nodes, sizeof(SerializedNode)));
+      }
+
+
+      const triton::uint32* SymbolicStateView::getChilds(void) const {
+        return reinterpret_cast<const triton::uint32*>(this->getSection(this->getHeader().childs, sizeof(triton::uint32)));
+      }
+
+
+      triton::uint512 SymbolicStateView::getConstant(triton::uint64 index) const {
+        const SerializedConstant* constants = reinterpret_cast<const SerializedConstant*>(this->getSection(this->getHeader().constants, sizeof(SerializedConstant)));
+        triton::uint512 value = 0;
+
+        if (index >= this->getHeader().constants.count)
+          throw std::runtime_error("SymbolicStateView::getConstant(): Invalid constant.");
+
+        for (triton::uint32 word = 8; word > 0; word--)
+          value = (value << 64) | constants[index].words[word - 1];
+
+        return value;
+      }
+
+
+      triton::uint512 SymbolicStateView::getValue(triton::uint64 value, bool isInline) const {
+        if (isInline)
+          return value;
+        return this->getConstant(value);
+      }
+
+
+      std::string SymbolicStateView::getString(triton::uint64 offset) const {
+        const char* strings = reinterpret_cast<const char*>(this->getSection(this->getHeader().strings, sizeof(char)));
+
+        if (offset >= this->getHeader().strings.count)
+          throw std::runtime_error("SymbolicStateView::getString(): Invalid string.");
+
+        return std::string(strings + offset);
+      }
+
+
+      const SerializedExpression* SymbolicStateView::getExpressions(void) const {
+        return reinterpret_cast<const SerializedExpression*>(this->getSection(this->getHeader().expressions, sizeof(SerializedExpression)));
+      }
+
+
+      const SerializedVariable* SymbolicStateView::getVariables(void) const {
+        return reinterpret_cast<const SerializedVariable*>(this->getSection(this->getHeader().variables, sizeof(SerializedVariable)));
+      }
+
+
+      const SerializedReference* SymbolicStateView::getRegisters(void) const {
+        return reinterpret_cast<const SerializedReference*>(this->getSection(this->getHeader().registers, sizeof(SerializedReference)));
+      }
+
+
+      const SerializedReference* SymbolicStateView::getMemory(void) const {
+        return reinterpret_cast<const SerializedReference*>(this->getSection(this->getHeader().memory, sizeof(SerializedReference)));
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
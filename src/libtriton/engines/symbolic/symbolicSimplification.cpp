@@ -116,6 +116,25 @@ if __name__ == "__main__":
     print 'Simp: ', c
 ~~~~~~~~~~~~~
 
+\subsection SMT_simplification_rewriting Simplification via the rewrite rules
+<hr>
+
+Callbacks, and above all Python callbacks, are slow when they are applied to every new expression. Triton also
+ships a native rewrite engine (triton::ast::AstRewriter) whose rules are patterns over the AST nodes. Its default
+rules cover the bitwise and arithmetic identities, the fusion of extractions, concatenations and extensions used
+by the sub-registers, and the `ite` of the x86 flags. The AST is rewritten bottom-up, once per unique sub-tree.
+Enable the `AST_REWRITING` optimization to rewrite every new symbolic expression, before the callbacks.
+
+~~~~~~~~~~~~~{.py}
+>>> enableSymbolicOptimization(OPTIMIZATION.AST_REWRITING, True)
+>>> recordRewriteRule("(bvand x (bvor x y))", "x")
+
+>>> a = variable(newSymbolicVariable(8))
+>>> b = variable(newSymbolicVariable(8))
+>>> print rewriteAst((a & (a | b)) ^ bv(0, 8))
+SymVar_0
+~~~~~~~~~~~~~
+
 \subsection SMT_simplification_z3 Simplification via Z3
 <hr>
 
@@ -212,6 +231,18 @@ namespace triton {
       #endif
 
 
+      void SymbolicSimplification::recordRewriteRule(const std::string& pattern, const std::string& replacement) {
+        this->rewriter.addRule(pattern + " -> " + replacement, pattern, replacement);
+      }
+
+
+      triton::ast::AbstractNode* SymbolicSimplification::rewriteAst(triton::ast::AbstractNode* node) const {
+        if (node == nullptr)
+          throw std::runtime_error("SymbolicSimplification::rewriteAst(): node cannot be null.");
+        return this->rewriter.rewrite(node);
+      }
+
+
       triton::ast::AbstractNode* SymbolicSimplification::processSimplification(triton::ast::AbstractNode* node, bool z3) const {
 
         if (node == nullptr)
@@ -0,0 +1,139 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#include <algorithm>
+#include <unordered_set>
+
+#include <symbolicSlicer.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* Sorts a list and removes its duplicates */
+      static void makeUnique(std::vector<triton::__uint>& values) {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+      }
+
+
+      SymbolicSlicer::SymbolicSlicer(const IdTable<SymbolicExpression*>& symbolicExpressions, triton::__uint maxId)
+        : symbolicExpressions(symbolicExpressions) {
+        this->stamps.resize(maxId, 0);
+        this->stamp = 0;
+      }
+
+
+      /* The shared sub-trees are walked once and the walk stops at the references */
+      void SymbolicSlicer::walk(triton::ast::AbstractNode* node, SymbolicDependencies& deps) {
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> worklist;
+
+        worklist.push_back(node);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          if (current == nullptr || !visited.insert(current).second)
+            continue;
+
+          switch (current->getKind()) {
+            case triton::ast::REFERENCE_NODE:
+              deps.expressions.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue());
+              continue;
+
+            case triton::ast::VARIABLE_NODE:
+              deps.variables.push_back(reinterpret_cast<triton::ast::VariableNode*>(current)->getSymVarId());
+              continue;
+
+            default:
+              break;
+          }
+
+          triton::ast::AstChilds& childs = current->getChilds();
+          for (triton::uint32 index = 0; index < childs.size(); index++)
+            worklist.push_back(childs[index]);
+        }
+
+        makeUnique(deps.expressions);
+        makeUnique(deps.variables);
+      }
+
+
+      const SymbolicDependencies& SymbolicSlicer::getDependencies(const SymbolicExpression* expr) {
+        std::unordered_map<triton::__uint, SymbolicDependencies>::iterator it = this->dependencies.find(expr->getId());
+
+        if (it == this->dependencies.end()) {
+          it = this->dependencies.insert(std::make_pair(expr->getId(), SymbolicDependencies())).first;
+          SymbolicSlicer::walk(expr->getAst(), it->second);
+        }
+
+        return it->second;
+      }
+
+
+      /* An expression is added once per slice, the ids of the removed expressions are skipped */
+      void SymbolicSlicer::expand(const SymbolicDependencies& deps, SymbolicSlice& slice) {
+        std::vector<triton::__uint> worklist = deps.expressions;
+
+        slice.variables = deps.variables;
+
+        while (!worklist.empty()) {
+          triton::__uint id = worklist.back();
+          worklist.pop_back();
+
+          if (id >= this->stamps.size() || this->stamps[id] == this->stamp)
+            continue;
+          this->stamps[id] = this->stamp;
+
+          const SymbolicExpression* expr = this->symbolicExpressions.get(id);
+          if (expr == nullptr)
+            continue;
+
+          slice.expressions.push_back(id);
+          if (expr->hasAddress())
+            slice.addresses.push_back(expr->getAddress());
+
+          const SymbolicDependencies& next = this->getDependencies(expr);
+          slice.variables.insert(slice.variables.end(), next.variables.begin(), next.variables.end());
+          worklist.insert(worklist.end(), next.expressions.begin(), next.expressions.end());
+        }
+
+        makeUnique(slice.expressions);
+        makeUnique(slice.addresses);
+        makeUnique(slice.variables);
+      }
+
+
+      SymbolicSlice SymbolicSlicer::slice(triton::__uint symExprId) {
+        SymbolicDependencies deps;
+        SymbolicSlice slice;
+
+        deps.expressions.push_back(symExprId);
+        this->stamp++;
+        this->expand(deps, slice);
+
+        return slice;
+      }
+
+
+      SymbolicSlice SymbolicSlicer::slice(triton::ast::AbstractNode* node) {
+        SymbolicDependencies deps;
+        SymbolicSlice slice;
+
+        SymbolicSlicer::walk(node, deps);
+        this->stamp++;
+        this->expand(deps, slice);
+
+        return slice;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
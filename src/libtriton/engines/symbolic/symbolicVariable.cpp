@@ -96,7 +96,7 @@ namespace triton {
 
         this->symVarConcreteValue = value;
         if (node)
-          node->init();
+          node->invalidate();
       }
 
 
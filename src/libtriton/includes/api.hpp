@@ -165,7 +165,7 @@ namespace triton {
         //! [**architecture api**] - Disassembles the instruction and setup operands. You must define an architecture before. \sa  processing().
         void disassembly(triton::arch::Instruction &inst) const;
 
-        //! [**architecture api**] - Builds the instruction semantics. You must define an architecture before. \sa processing().
+        //! [**architecture api**] - Builds the instruction semantics. You must define an architecture before. The AST nodes it built which are owned by nothing are freed when it returns. \sa processing().
         void buildSemantics(triton::arch::Instruction &inst);
 
 
@@ -191,12 +191,24 @@ namespace triton {
         //! [**AST garbage collector api**] - Raises an exception if the AST garbage collector interface is not initialized.
         void checkAstGarbageCollector(void) const;
 
-        //! [**AST garbage collector api**] - Go through every allocated nodes and free them.
+        //! [**AST garbage collector api**] - Adds an owner to a node.
+        void retainAstNode(triton::ast::AbstractNode* node);
+
+        //! [**AST garbage collector api**] - Removes an owner from a node. The node is freed when it has no owner anymore.
+        void releaseAstNode(triton::ast::AbstractNode* node);
+
+        //! [**AST garbage collector api**] - Go through every allocated nodes and free those which are not referenced anymore, including the nodes which never had an owner.
         void freeAllAstNodes(void);
 
-        //! [**AST garbage collector api**] - Frees a set of nodes and removes them from the global container.
+        //! [**AST garbage collector api**] - Frees the nodes of a set which are not referenced anymore and clears the set.
         void freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes);
 
+        //! [**AST garbage collector api**] - Returns a region mark. Every node recorded after this call belongs to the region.
+        triton::__uint markAstRegion(void) const;
+
+        //! [**AST garbage collector api**] - Frees all nodes recorded since the region mark which are not referenced anymore.
+        void freeAstRegion(triton::__uint mark);
+
         //! [**AST garbage collector api**] - Extracts all unique nodes from a partial AST into the uniqueNodes set.
         void extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const;
 
@@ -207,7 +219,10 @@ namespace triton {
         void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
 
         //! [**AST garbage collector api**] - Returns all allocated nodes.
-        const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
+        std::set<triton::ast::AbstractNode*> getAllocatedAstNodes(void) const;
+
+        //! [**AST garbage collector api**] - Returns the number of allocated nodes.
+        triton::__uint getNumberOfAllocatedAstNodes(void) const;
 
         //! [**AST garbage collector api**] - Returns all variable nodes recorded.
         const std::map<std::string, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
@@ -247,7 +262,7 @@ namespace triton {
         //! [**symbolic api**] - Returns the instance of the symbolic engine.
         triton::engines::symbolic::SymbolicEngine* getSymbolicEngine(void);
 
-        //! [**symbolic api**] - Applies a backup of the symbolic engine.
+        //! [**symbolic api**] - Applies a backup of the symbolic engine. The backup shares the tables of the engine until one of them writes into them.
         void backupSymbolicEngine(void);
 
         //! [**symbolic api**] - Restores the last taken backup of the symbolic engine.
@@ -331,6 +346,33 @@ namespace triton {
         //! [**symbolic api**] - Removes the symbolic expression corresponding to the id.
         void removeSymbolicExpression(triton::__uint symExprId);
 
+        //! [**symbolic api**] - Returns the backward slice of a symbolic expression: the expressions, instruction addresses and symbolic variables it depends on, itself included.
+        triton::engines::symbolic::SymbolicSlice getBackwardSlice(triton::__uint symExprId) const;
+
+        //! [**symbolic api**] - Returns the backward slice of an AST: the expressions, instruction addresses and symbolic variables it depends on.
+        triton::engines::symbolic::SymbolicSlice getBackwardSlice(triton::ast::AbstractNode* node) const;
+
+        //! [**symbolic api**] - Returns the backward slices of the taken branches of the path constraints, in the order of the path constraints.
+        std::vector<triton::engines::symbolic::SymbolicSlice> getPathConstraintsBackwardSlices(void) const;
+
+        //! [**symbolic api**] - Removes the symbolic expressions which cannot be reached from the symbolic state and the `roots` anymore and returns their number. The instructions which hold them keep them alive.
+        triton::__uint collectSymbolicExpressions(const std::vector<triton::engines::symbolic::SymbolicExpression*>& roots=std::vector<triton::engines::symbolic::SymbolicExpression*>());
+
+        //! [**symbolic api**] - Returns true if there are enough symbolic expressions for an automatic collection.
+        bool isSymbolicGarbageCollectionNeeded(void) const;
+
+        //! [**symbolic api**] - Sets the number of symbolic expressions from which a collection is done automatically after an instruction. 0 disables it.
+        void setSymbolicGarbageCollectionThreshold(triton::__uint threshold);
+
+        //! [**symbolic api**] - Returns the number of symbolic expressions from which a collection is done automatically, 0 if disabled.
+        triton::__uint getSymbolicGarbageCollectionThreshold(void) const;
+
+        //! [**symbolic api**] - Keeps a symbolic expression alive through the collections.
+        void pinSymbolicExpression(triton::__uint symExprId);
+
+        //! [**symbolic api**] - Lets a pinned symbolic expression be collected.
+        void unpinSymbolicExpression(triton::__uint symExprId);
+
         //! [**symbolic api**] - Returns the new symbolic abstract expression and links this expression to the instruction.
         triton::engines::symbolic::SymbolicExpression* createSymbolicExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::OperandWrapper& dst, const std::string& comment="");
 
@@ -371,9 +413,27 @@ namespace triton {
         //! [**symbolic api**] - Browses AST Dictionaries if the optimization `AST_DICTIONARIES` is enabled.
         triton::ast::AbstractNode* browseAstDictionaries(triton::ast::AbstractNode* node);
 
+        //! [**symbolic api**] - Returns the unique node of this kind with these childs and inline parameters if the optimization `AST_DICTIONARIES` is enabled and the node exists, nullptr otherwise.
+        triton::ast::AbstractNode* lookupAstDictionaries(triton::uint32 kind, triton::ast::AbstractNode* const* childs, triton::uint32 size, triton::uint64 params=0);
+
+        //! [**symbolic api**] - Returns the unique decimal, reference or bit-vector node (of `size` bits) holding this value if the optimization `AST_DICTIONARIES` is enabled and the node exists, nullptr otherwise.
+        triton::ast::AbstractNode* lookupAstDictionaries(triton::uint32 kind, const triton::uint512& value, triton::uint32 size=0);
+
+        //! [**symbolic api**] - Returns the unique string or variable node holding this name if the optimization `AST_DICTIONARIES` is enabled and the node exists, nullptr otherwise.
+        triton::ast::AbstractNode* lookupAstDictionaries(triton::uint32 kind, const std::string& value);
+
+        //! [**symbolic api**] - Removes a node from the AST Dictionaries. Does nothing if the node is not shared.
+        void removeAstDictionaries(triton::ast::AbstractNode* node);
+
         //! [**symbolic api**] - Returns all stats about AST Dictionaries.
         std::map<std::string, triton::uint32> getAstDictionariesStats(void);
 
+        //! [**symbolic api**] - Records a rewrite rule, e.g. `(bvxor x x)` -> `0`. See triton::ast::AstRewriter for the syntax.
+        void recordRewriteRule(const std::string& pattern, const std::string& replacement);
+
+        //! [**symbolic api**] - Rewrites an AST with the default and the recorded rewrite rules. Returns the rewritten node.
+        triton::ast::AbstractNode* rewriteAst(triton::ast::AbstractNode* node) const;
+
         //! [**symbolic api**] - Processes all recorded simplifications. Returns the simplified node.
         triton::ast::AbstractNode* processSimplification(triton::ast::AbstractNode* node, bool z3=false) const;
 
@@ -386,6 +446,9 @@ namespace triton {
         //! [**symbolic api**] - Returns the symbolic variable corresponding to the symbolic variable name.
         triton::engines::symbolic::SymbolicVariable* getSymbolicVariableFromName(const std::string& symVarName) const;
 
+        //! [**symbolic api**] - Returns the last symbolic variable created for a register id (REG) or a memory address (MEM), nullptr if there is none.
+        triton::engines::symbolic::SymbolicVariable* getSymbolicVariableFromOrigin(triton::engines::symbolic::symkind_e kind, triton::__uint kindValue) const;
+
         //! [**symbolic api**] - Returns the logical conjunction vector of path constraints.
         const std::vector<triton::engines::symbolic::PathConstraint>& getPathConstraints(void) const;
 
@@ -448,7 +511,7 @@ namespace triton {
         //! [**symbolic api**] - Returns the partial AST from a symbolic expression id.
         triton::ast::AbstractNode* getAstFromId(triton::__uint symExprId);
 
-        //! [**symbolic api**] - Returns the full AST of a root node.
+        //! [**symbolic api**] - Returns the full AST of a root node. The given AST is not modified.
         triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node);
 
         //! [**symbolic api**] - Returns the full AST from a symbolic expression id.
@@ -457,11 +520,26 @@ namespace triton {
         //! [**symbolic api**] - Returns the list of the tainted symbolic expressions.
         std::list<triton::engines::symbolic::SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
 
-        //! [**symbolic api**] - Returns all symbolic expressions as a map of <SymExprId : SymExpr>
-        const std::map<triton::__uint, triton::engines::symbolic::SymbolicExpression*>& getSymbolicExpressions(void) const;
+        //! [**symbolic api**] - Returns all symbolic expressions as a table of <SymExprId : SymExpr>
+        const triton::engines::symbolic::IdTable<triton::engines::symbolic::SymbolicExpression*>& getSymbolicExpressions(void) const;
+
+        //! [**symbolic api**] - Returns the shape of an AST: unique and expanded node counts, depth, kinds, bytes and symbolic variables. References are unrolled.
+        triton::ast::AstStats getAstStats(triton::ast::AbstractNode* node) const;
+
+        //! [**symbolic api**] - Returns the shape of the ASTs of all symbolic expressions taken together.
+        triton::ast::AstStats getAstStats(void) const;
+
+        //! [**symbolic api**] - Returns the `n` symbolic expressions with the biggest tree size, the biggest first.
+        std::vector<triton::engines::symbolic::SymbolicExpression*> getLargestSymbolicExpressions(triton::uint32 n) const;
+
+        //! [**symbolic api**] - Saves the symbolic expressions, variables, registers and memory into a binary file.
+        void saveSymbolicState(const std::string& filename) const;
+
+        //! [**symbolic api**] - Replaces the symbolic state by the one saved into a file. The path constraints are cleared.
+        void loadSymbolicState(const std::string& filename);
 
-        //! [**symbolic api**] - Returns all symbolic variables as a map of <SymVarId : SymVar>
-        const std::map<triton::__uint, triton::engines::symbolic::SymbolicVariable*>& getSymbolicVariables(void) const;
+        //! [**symbolic api**] - Returns all symbolic variables as a table of <SymVarId : SymVar>
+        const triton::engines::symbolic::IdTable<triton::engines::symbolic::SymbolicVariable*>& getSymbolicVariables(void) const;
 
         //! [**symbolic api**] - Returns all variable declarations representation.
         std::string getVariablesDeclaration(void) const;
@@ -16,7 +16,9 @@
 #include <string>
 #include <vector>
 
+#include "astArena.hpp"
 #include "astEnums.hpp"
+#include "astSmallVector.hpp"
 #include "astVisitor.hpp"
 #include "symbolicVariable.hpp"
 #include "tritonTypes.hpp"
@@ -38,27 +40,97 @@ namespace triton {
    *  @{
    */
 
+    /* Forward declarations */
+    class AbstractNode;
+    class AstGarbageCollector;
+
+    //! The childs of a node. Up to three childs are stored inside the node.
+    typedef SmallVector<AbstractNode*, 3> AstChilds;
+
+    //! The parents of a node. Up to two parents are stored inside the node.
+    typedef SmallVector<AbstractNode*, 2> AstParents;
+
     //! Abstract node
     class AbstractNode {
+      //! The garbage collector maintains the allocation links and the reference counts.
+      friend class AstGarbageCollector;
+
+      private:
+        //! The previous node in the allocation order of the garbage collector.
+        AbstractNode* prevAllocated;
+
+        //! The next node in the allocation order of the garbage collector.
+        AbstractNode* nextAllocated;
+
+        //! The allocation serial of the node. 0 if the node is not recorded by the garbage collector.
+        triton::__uint allocSerial;
+
       protected:
         //! The kind of the node.
         enum kind_e kind;
 
+        //! The size of the node.
+        triton::uint32 size;
+
         //! The childs of the node.
-        std::vector<AbstractNode*> childs;
+        AstChilds childs;
 
-        //! The parents of the node. Empty if there is still no parent.
-        std::set<AbstractNode*> parents;
+        /*!
+         * \brief The parents of the node. Empty if there is still no parent.
+         * \description A node is listed once per edge, so a parent using the node twice (e.g. `(bvadd x x)`) is listed twice.
+         */
+        AstParents parents;
 
-        //! The size of the node.
-        triton::uint32 size;
+        /*!
+         * \brief The value of the tree from this root node.
+         * \description For nodes wider than 64 bits, this field holds the low 64 bits and the full value lives in `evalWide`.
+         */
+        triton::uint64 eval;
+
+        //! The value of the tree from this root node when the node is wider than 64 bits, nullptr otherwise.
+        triton::uint512* evalWide;
 
-        //! The value of the tree from this root node.
-        triton::uint512 eval;
+        //! The structural hash of the tree from this root node, computed from the cached hashes of the childs.
+        triton::uint64 hashValue;
 
         //! This value is set to true if the tree contains a symbolic variable.
         bool symbolized;
 
+        //! This value is set to true if the node must be re-evaluated before its next read.
+        bool dirty;
+
+        //! This value is set to true once the node is registered as parent of its childs.
+        bool linked;
+
+        /*!
+         * \brief The number of owners of the node.
+         * \description Each parent holds one reference per edge. Symbolic expressions, path constraints,
+         * instruction accesses and Python objects hold one reference each. The node is freed when the
+         * count drops to zero, see AstGarbageCollector::releaseAstNode().
+         */
+        triton::uint32 references;
+
+        //! Computes the structural hash of the node. The childs must be up to date.
+        void initHash(void);
+
+        //! Registers the node as parent of its childs. Does nothing if it is already done.
+        void initParents(void);
+
+        //! Re-evaluates the out of date nodes of the tree, from the leaves up to this node.
+        void refresh(void);
+
+        //! Sets the value of the node. The size of the node must be set and must be at most 64 bits.
+        void setEval(triton::uint64 value);
+
+        //! Sets the value of the node. The value is stored according to the size of the node which must be set.
+        void setEval(const triton::uint512& value);
+
+        //! Copies the value of another node of the same size.
+        void setEval(const AbstractNode* node);
+
+        //! Computes the value of the node with `Op` in the narrowest native domain able to hold `width` bits. `args` are forwarded to `Op`.
+        template <template <typename> class Op, typename... Args> void evaluateIn(triton::uint32 width, Args... args);
+
       public:
         //! Constructor.
         AbstractNode(enum kind_e kind);
@@ -72,6 +144,12 @@ namespace triton {
         //! Destructor.
         virtual ~AbstractNode();
 
+        //! Allocates a node from the AST arena.
+        static void* operator new(std::size_t size);
+
+        //! Gives a node back to the AST arena.
+        static void operator delete(void* ptr, std::size_t size);
+
         //! Returns the kind of the node.
         enum kind_e getKind(void) const;
 
@@ -90,23 +168,29 @@ namespace triton {
         //! Evaluates the tree.
         triton::uint512 evaluate(void) const;
 
+        //! Evaluates the tree and returns the low 64 bits. This is the fast path for nodes up to 64 bits.
+        triton::uint64 evaluate64(void) const;
+
+        //! Evaluates the tree and returns the low 128 bits.
+        triton::uint128 evaluate128(void) const;
+
         //! Returns the childs of the node.
-        std::vector<AbstractNode*>& getChilds(void);
+        AstChilds& getChilds(void);
 
         /*!
          * \brief Returns the parents of node or an empty set if there is still no parent defined.
          * \brief Note that if there is the `AST_DICTIONARIES` optimization enabled, this feature will probably not represent the real tree of your expression.
          */
-        std::set<AbstractNode*>& getParents(void);
+        AstParents& getParents(void);
 
-        //! Removes a parent node.
+        //! Removes a parent node (one edge).
         void removeParent(AbstractNode* p);
 
-        //! Sets a parent node.
+        //! Adds a parent node (one edge). A parent which is already listed is listed once more.
         void setParent(AbstractNode* p);
 
-        //! Sets the parent nodes.
-        void setParent(std::set<AbstractNode*>& p);
+        //! Adds the parent nodes (one edge each).
+        void setParent(AstParents& p);
 
         //! Sets the size of the node.
         void setBitvectorSize(triton::uint32 size);
@@ -117,14 +201,21 @@ namespace triton {
         //! Sets a child at an index.
         void setChild(triton::uint32 index, AbstractNode* child);
 
-        //! Init stuffs like size and eval.
+        //! Marks the node and all its ancestors as out of date. They will be re-evaluated on their next read.
+        void invalidate(void);
+
+        //! Init stuffs like size and eval. Parents are not updated, see invalidate().
         virtual void init(void) = 0;
 
         //! Entry point for a visitor.
         virtual void accept(AstVisitor& v) = 0;
 
-        //! Returns the has of the tree. The hash is computed recursively on the whole tree.
-        virtual triton::uint512 hash(triton::uint32 deep) = 0;
+        //! Returns the structural hash of the tree. The hash is cached in the node, two trees with the same structure have the same hash.
+        triton::uint64 hash(void) const;
+
+        //! Returns the number of owners of the node.
+        triton::uint32 getReferenceCount(void) const;
+
     };
 
 
@@ -136,7 +227,6 @@ namespace triton {
         ~AssertNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -148,7 +238,6 @@ namespace triton {
         ~BvaddNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -160,7 +249,6 @@ namespace triton {
         ~BvandNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -172,7 +260,6 @@ namespace triton {
         ~BvashrNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -184,7 +271,6 @@ namespace triton {
         ~BvdeclNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -196,7 +282,6 @@ namespace triton {
         ~BvlshrNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -208,7 +293,6 @@ namespace triton {
         ~BvmulNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -220,7 +304,6 @@ namespace triton {
         ~BvnandNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -232,7 +315,6 @@ namespace triton {
         ~BvnegNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -244,7 +326,6 @@ namespace triton {
         ~BvnorNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -256,7 +337,6 @@ namespace triton {
         ~BvnotNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -268,7 +348,6 @@ namespace triton {
         ~BvorNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -281,7 +360,6 @@ namespace triton {
         ~BvrolNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -294,7 +372,6 @@ namespace triton {
         ~BvrorNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -306,7 +383,6 @@ namespace triton {
         ~BvsdivNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -318,7 +394,6 @@ namespace triton {
         ~BvsgeNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -330,7 +405,6 @@ namespace triton {
         ~BvsgtNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -342,7 +416,6 @@ namespace triton {
         ~BvshlNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -354,7 +427,6 @@ namespace triton {
         ~BvsleNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -366,7 +438,6 @@ namespace triton {
         ~BvsltNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -378,7 +449,6 @@ namespace triton {
         ~BvsmodNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -390,7 +460,6 @@ namespace triton {
         ~BvsremNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -402,7 +471,6 @@ namespace triton {
         ~BvsubNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -414,7 +482,6 @@ namespace triton {
         ~BvudivNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -426,7 +493,6 @@ namespace triton {
         ~BvugeNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -438,7 +504,6 @@ namespace triton {
         ~BvugtNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -450,7 +515,6 @@ namespace triton {
         ~BvuleNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -462,7 +526,6 @@ namespace triton {
         ~BvultNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -474,7 +537,6 @@ namespace triton {
         ~BvuremNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -486,7 +548,6 @@ namespace triton {
         ~BvxnorNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -498,7 +559,6 @@ namespace triton {
         ~BvxorNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -510,7 +570,9 @@ namespace triton {
         ~BvNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
+
+        //! Returns the value of the bit-vector. The value and the size are stored inline, a bit-vector has no child.
+        triton::uint512 getValue(void);
     };
 
 
@@ -522,7 +584,6 @@ namespace triton {
         ~CompoundNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -536,14 +597,17 @@ namespace triton {
         ~ConcatNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
     //! Decimal node
     class DecimalNode : public AbstractNode {
       protected:
-        triton::uint512 value;
+        //! The value if it fits in 64 bits, its low 64 bits otherwise.
+        triton::uint64 value;
+
+        //! The value if it does not fit in 64 bits, nullptr otherwise.
+        triton::uint512* valueWide;
 
       public:
         DecimalNode(triton::uint512 value);
@@ -551,7 +615,6 @@ namespace triton {
         ~DecimalNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
 
         triton::uint512 getValue(void);
     };
@@ -565,7 +628,6 @@ namespace triton {
         ~DeclareFunctionNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -577,7 +639,6 @@ namespace triton {
         ~DistinctNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -589,19 +650,27 @@ namespace triton {
         ~EqualNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
     //! ((_ extract <high> <low>) <expr>) node
     class ExtractNode : public AbstractNode {
+      protected:
+        //! The highest extracted bit.
+        triton::uint32 high;
+
+        //! The lowest extracted bit.
+        triton::uint32 low;
+
       public:
         ExtractNode(triton::uint32 high, triton::uint32 low, AbstractNode* expr);
         ExtractNode(const ExtractNode& copy);
         ~ExtractNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
+
+        triton::uint32 getHigh(void);
+        triton::uint32 getLow(void);
     };
 
 
@@ -613,7 +682,6 @@ namespace triton {
         ~IteNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -625,7 +693,6 @@ namespace triton {
         ~LandNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -637,7 +704,6 @@ namespace triton {
         ~LetNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -649,7 +715,6 @@ namespace triton {
         ~LnotNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -661,24 +726,34 @@ namespace triton {
         ~LorNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
     //! Reference node
     class ReferenceNode : public AbstractNode {
+      //! The garbage collector releases the target of the reference.
+      friend class AstGarbageCollector;
+
       protected:
         triton::__uint value;
 
+        //! The AST of the referenced expression. The node holds a reference on it and is one of its parents.
+        AbstractNode* target;
+
       public:
         ReferenceNode(triton::__uint value);
         ReferenceNode(const ReferenceNode& copy);
         ~ReferenceNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
 
         triton::__uint getValue(void);
+
+        //! Returns the AST of the referenced expression, nullptr if the expression did not exist when the node was built.
+        AbstractNode* getTarget(void);
+
+        //! Moves the reference to another AST. Used when the AST of the referenced expression is replaced.
+        void setTarget(AbstractNode* ast);
     };
 
 
@@ -693,7 +768,6 @@ namespace triton {
         ~StringNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
 
         std::string getValue(void);
     };
@@ -701,13 +775,18 @@ namespace triton {
 
     //! ((_ sign_extend sizeExt) <expr>) node
     class SxNode : public AbstractNode {
+      protected:
+        //! The number of bits added to the expression.
+        triton::uint32 sizeExt;
+
       public:
         SxNode(triton::uint32 sizeExt, AbstractNode* expr);
         SxNode(const SxNode& copy);
         ~SxNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
+
+        triton::uint32 getSizeExt(void);
     };
 
 
@@ -716,27 +795,37 @@ namespace triton {
       protected:
         std::string value;
 
+        //! The id of the symbolic variable.
+        triton::__uint symVarId;
+
       public:
         VariableNode(triton::engines::symbolic::SymbolicVariable& symVar);
         VariableNode(const VariableNode& copy);
         ~VariableNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
 
         std::string getValue(void);
+
+        //! Returns the id of the symbolic variable, so the variable is found without its name.
+        triton::__uint getSymVarId(void);
     };
 
 
     //! ((_ zero_extend sizeExt) <expr>) node
     class ZxNode : public AbstractNode {
+      protected:
+        //! The number of bits added to the expression.
+        triton::uint32 sizeExt;
+
       public:
         ZxNode(triton::uint32 sizeExt, AbstractNode* expr);
         ZxNode(const ZxNode& copy);
         ~ZxNode();
         virtual void init(void);
         virtual void accept(AstVisitor& v);
-        virtual triton::uint512 hash(triton::uint32 deep);
+
+        triton::uint32 getSizeExt(void);
     };
 
 
@@ -916,15 +1005,27 @@ namespace triton {
     //! ast C++ api - Duplicates the AST
     AbstractNode* newInstance(AbstractNode* node);
 
-    //! Custom pow function for hash routine.
-    triton::uint512 pow(triton::uint512 hash, triton::uint32 n);
+    //! ast C++ api - Builds a node of the same kind and with the same parameters as `node` but with other childs. The childs of `node` are not copied.
+    AbstractNode* newInstance(AbstractNode* node, const std::vector<AbstractNode*>& childs);
 
-    //! Custom rotate left function for hash routine.
-    triton::uint512 rotl(triton::uint512 value, triton::uint32 shift);
+    //! ast C++ api - Builds a node of `kind` with these childs. `param1` and `param2` are the high and low bits of extract, `param1` is the extension size of sx and zx.
+    AbstractNode* newInstance(enum kind_e kind, const std::vector<AbstractNode*>& childs, triton::uint32 param1=0, triton::uint32 param2=0);
 
     //! Custom modular sign extend for bitwise operation.
     triton::sint512 modularSignExtend(AbstractNode* node);
 
+    //! Mixes the bits of a 64-bit value (splitmix64 finalizer).
+    triton::uint64 hashMix(triton::uint64 value);
+
+    //! Combines a value into a hash seed. The result depends on the order of the combinations.
+    triton::uint64 hashCombine(triton::uint64 seed, triton::uint64 value);
+
+    //! Hashes a string (FNV-1a).
+    triton::uint64 hashString(const std::string& value);
+
+    //! Hashes a 512-bit value, 64 bits at a time.
+    triton::uint64 hashUint512(triton::uint512 value);
+
   /*! @} End of ast namespace */
   };
 /*! @} End of triton namespace */
@@ -0,0 +1,109 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#ifndef TRITON_ASTARENA_H
+#define TRITON_ASTARENA_H
+
+#include <cstddef>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! \module The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! \module The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! The size of an arena chunk.
+    const triton::uint32 ARENA_CHUNK_SIZE = 0x10000;
+
+    //! The granularity of the arena size classes.
+    const triton::uint32 ARENA_ALIGNMENT = 16;
+
+    //! The number of size classes. Bigger allocations are forwarded to the system allocator.
+    const triton::uint32 ARENA_SIZE_CLASSES = 32;
+
+    //! \class AstArena
+    /*! \brief The AST arena class
+     *
+     * \description
+     * All AST nodes are allocated through this arena. Memory is bumped out of 64 KiB chunks
+     * and released slots are kept in one free list per size class. As every kind of node has
+     * its own fixed size, each free list is shared by a handful of node kinds and a released
+     * slot is reused by the next node of the same shape without going through the system allocator.
+     * When the last node is released, all chunks but one are given back to the system.
+     */
+    class AstArena {
+      protected:
+        //! A released slot, chained into its size class free list.
+        struct FreeSlot {
+          FreeSlot* next;
+        };
+
+        //! The chunks allocated so far. The last one is the current bump chunk.
+        std::vector<triton::uint8*> chunks;
+
+        //! The free lists, one per size class.
+        FreeSlot* freeLists[ARENA_SIZE_CLASSES];
+
+        //! The next free byte inside the current chunk.
+        triton::uint8* cursor;
+
+        //! The end of the current chunk.
+        triton::uint8* limit;
+
+        //! The number of live allocations.
+        triton::__uint liveObjects;
+
+        //! Allocates a new chunk and makes it the current bump chunk.
+        void newChunk(void);
+
+        //! Releases all chunks but the first one.
+        void reset(void);
+
+      public:
+        //! Constructor.
+        AstArena();
+
+        //! Destructor.
+        ~AstArena();
+
+        //! Allocates `size` bytes.
+        void* allocate(std::size_t size);
+
+        //! Releases `size` bytes previously returned by allocate().
+        void release(void* ptr, std::size_t size);
+
+        //! Returns the number of live allocations.
+        triton::__uint getLiveObjects(void) const;
+
+        //! Returns the number of bytes reserved by the arena.
+        triton::__uint getReservedBytes(void) const;
+
+        //! Returns the arena used by all AST nodes.
+        static AstArena& instance(void);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTARENA_H */
+
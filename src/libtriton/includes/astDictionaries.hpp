@@ -8,7 +8,9 @@
 #ifndef TRITON_ASTDICTIONARIES_H
 #define TRITON_ASTDICTIONARIES_H
 
-#include <list>
+#include <map>
+#include <string>
+#include <vector>
 
 #include "ast.hpp"
 #include "tritonTypes.hpp"
@@ -30,166 +32,78 @@ namespace triton {
    *  @{
    */
 
+    //! The initial capacity of the AST dictionaries table.
+    const triton::uint32 AST_DICTIONARIES_INITIAL_CAPACITY = 1024;
+
     //! \class AstDictionaries
-    /*! \brief The AST dictionaries class */
+    /*! \brief The AST dictionaries class
+     *
+     * \description
+     * When the `AST_DICTIONARIES` optimization is enabled, node builders look for an existing node
+     * before allocating a new one, so a node is never allocated twice. All unique nodes live in one
+     * open-addressing table with linear probing. A node is keyed on its kind and on its childs, which
+     * are unique nodes themselves, or on its value for leaves (decimal, reference, string and variable
+     * nodes, and bit-vectors whose value and size are part of the key). The integer parameters stored inline in a node (the bounds of an extract, the size of
+     * an extension) are part of the key as well, the other parameters are decimal childs.
+     * The table does not own the nodes. A node leaves the table when the garbage collector frees
+     * it or when one of its childs is replaced.
+     */
     class AstDictionaries {
 
       protected:
-        //! Total of allocated nodes.
-        triton::uint32 allocatedNodes;
-
-        //! Total of allocated dictionaries.
-        triton::uint32 allocatedDictionaries;
-
-        //! Assert Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> assertDictionary;
-
-        //! Bvadd Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvaddDictionary;
-
-        //! Bvand Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvandDictionary;
-
-        //! Bvashr Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvashrDictionary;
-
-        //! Bvdecl Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvdeclDictionary;
-
-        //! Bvlshr Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvlshrDictionary;
-
-        //! Bvmul Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvmulDictionary;
-
-        //! Bvnand Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvnandDictionary;
-
-        //! Bvneg Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvnegDictionary;
-
-        //! Bvnor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvnorDictionary;
-
-        //! Bvnot Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvnotDictionary;
-
-        //! Bvor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvorDictionary;
-
-        //! Bvrol Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvrolDictionary;
-
-        //! Bvror Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvrorDictionary;
-
-        //! Bvsdiv Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsdivDictionary;
-
-        //! Bvsge Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsgeDictionary;
-
-        //! Bvsgt Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsgtDictionary;
-
-        //! Bvshl Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvshlDictionary;
+        //! A slot of the table. A free slot has a null node.
+        struct Slot {
+          //! The hash of the key.
+          triton::uint64 hash;
 
-        //! Bvsle Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsleDictionary;
+          //! The unique node.
+          triton::ast::AbstractNode* node;
+        };
 
-        //! Bvslt Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsltDictionary;
+        //! The table. Its capacity is zero or a power of two.
+        std::vector<Slot> table;
 
-        //! Bvsmod Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsmodDictionary;
+        //! The number of unique nodes in the table.
+        triton::__uint entries;
 
-        //! Bvsrem Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsremDictionary;
+        //! The number of lookups which found an existing node.
+        triton::__uint hits;
 
-        //! Bvsub Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsubDictionary;
+        //! The number of lookups which did not find an existing node.
+        triton::__uint misses;
 
-        //! Bvudiv Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvudivDictionary;
+        //! Returns the integer parameters stored inline in a node, zero if the node has none.
+        static triton::uint64 parametersOf(triton::ast::AbstractNode* node);
 
-        //! Bvuge Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvugeDictionary;
+        //! Returns the hash of a key made of a kind, childs and inline parameters.
+        static triton::uint64 hashKey(triton::uint32 kind, triton::ast::AbstractNode* const* childs, triton::uint32 size, triton::uint64 params);
 
-        //! Bvugt Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvugtDictionary;
+        //! Returns the hash of a key made of a kind, a value and a size (zero but for bit-vectors).
+        static triton::uint64 hashKey(triton::uint32 kind, const triton::uint512& value, triton::uint32 size);
 
-        //! Bvule Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvuleDictionary;
+        //! Returns the hash of a key made of a kind and a name.
+        static triton::uint64 hashKey(triton::uint32 kind, const std::string& value);
 
-        //! Bvult Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvultDictionary;
+        //! Returns the hash of the key of a node.
+        static triton::uint64 hashKey(triton::ast::AbstractNode* node);
 
-        //! Bvurem Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvuremDictionary;
+        //! Returns true if the node matches a key made of a kind, childs and inline parameters.
+        static bool match(triton::ast::AbstractNode* node, triton::uint32 kind, triton::ast::AbstractNode* const* childs, triton::uint32 size, triton::uint64 params);
 
-        //! Bvxnor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvxnorDictionary;
+        //! Returns true if the node matches a key made of a kind, a value and a size (zero but for bit-vectors).
+        static bool match(triton::ast::AbstractNode* node, triton::uint32 kind, const triton::uint512& value, triton::uint32 size);
 
-        //! Bvxor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvxorDictionary;
+        //! Returns true if the node matches a key made of a kind and a name.
+        static bool match(triton::ast::AbstractNode* node, triton::uint32 kind, const std::string& value);
 
-        //! Bv Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvDictionary;
+        //! Returns true if both nodes have the same key.
+        static bool match(triton::ast::AbstractNode* node, triton::ast::AbstractNode* other);
 
-        //! Compound Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> compoundDictionary;
+        //! Inserts a node into a free slot. The node must not be in the table.
+        void insert(triton::uint64 hash, triton::ast::AbstractNode* node);
 
-        //! Concat Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> concatDictionary;
-
-        //! Decimal Dictionary
-        std::map<triton::uint512, triton::ast::AbstractNode*> decimalDictionary;
-
-        //! Declare Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> declareFunctionDictionary;
-
-        //! Distinct Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> distinctDictionary;
-
-        //! Equal Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> equalDictionary;
-
-        //! Extract Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> extractDictionary;
-
-        //! Ite Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> iteDictionary;
-
-        //! Land Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> landDictionary;
-
-        //! Let Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> letDictionary;
-
-        //! Lnot Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> lnotDictionary;
-
-        //! Lor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> lorDictionary;
-
-        //! Reference Dictionary
-        std::map<triton::uint512, triton::ast::AbstractNode*> referenceDictionary;
-
-        //! String Dictionary
-        std::map<std::string, triton::ast::AbstractNode*> stringDictionary;
-
-        //! Sx Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> sxDictionary;
-
-        //! Variable Dictionary
-        std::map<std::string, triton::ast::AbstractNode*> variableDictionary;
-
-        //! Zx Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> zxDictionary;
-
-        //! Dictionaries
-        std::map<triton::uint32, void*> dictionaries;
+        //! Doubles the capacity of the table.
+        void grow(void);
 
     public:
         //! Constructor.
@@ -198,9 +112,21 @@ namespace triton {
         //! Destructor.
         ~AstDictionaries();
 
-        //! Browses into dictionaries.
+        //! Returns the unique node of this kind with these childs and inline parameters or nullptr if it does not exist yet.
+        triton::ast::AbstractNode* lookupAstDictionaries(triton::uint32 kind, triton::ast::AbstractNode* const* childs, triton::uint32 size, triton::uint64 params=0);
+
+        //! Returns the unique decimal, reference or bit-vector node (of `size` bits) holding this value or nullptr if it does not exist yet.
+        triton::ast::AbstractNode* lookupAstDictionaries(triton::uint32 kind, const triton::uint512& value, triton::uint32 size=0);
+
+        //! Returns the unique string or variable node holding this name or nullptr if it does not exist yet.
+        triton::ast::AbstractNode* lookupAstDictionaries(triton::uint32 kind, const std::string& value);
+
+        //! Records a new node. If the same node already exists, the new one is deleted and the existing one is returned, otherwise returns nullptr.
         triton::ast::AbstractNode* browseAstDictionaries(triton::ast::AbstractNode* node);
 
+        //! Removes a node from the table. Does nothing if the node is not in the table.
+        void removeAstDictionaries(triton::ast::AbstractNode* node);
+
         //! Returns stats about dictionaries.
         std::map<std::string, triton::uint32> getAstDictionariesStats(void);
     };
@@ -8,8 +8,10 @@
 #ifndef TRITON_ASTGARBAGECOLLECTOR_H
 #define TRITON_ASTGARBAGECOLLECTOR_H
 
+#include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "ast.hpp"
 #include "symbolicEnums.hpp"
@@ -33,15 +35,56 @@ namespace triton {
    */
 
     //! \class AstGarbageCollector
-    /*! \brief The AST garbage collector class */
+    /*! \brief The AST garbage collector class
+     *
+     * \description
+     * Nodes are allocated from the AST arena and recorded into an intrusive list kept in
+     * allocation order, so recording or forgetting a node is O(1). A region mark is the serial
+     * of the next recorded node and freeing a region releases every node recorded since the mark.
+     *
+     * Every node counts its owners: its parents, and the symbolic expressions, path constraints,
+     * instructions, memory operands and Python objects which hold it. When the count of a node drops to zero, the
+     * node is freed at once, and so are its childs which are not owned by anything else. The free
+     * methods below only free nodes which are not referenced anymore, a node still in use is never
+     * freed under its owners.
+     *
+     * A node which never had an owner has a count of zero but is not freed on its own, as nothing
+     * releases it: e.g. the intermediate nodes dropped by the builders (the inputs of the constant
+     * folding) or the unrolled copies of getFullAst(). These nodes are exactly the ones the free
+     * methods reclaim, so a raw pointer on a node which is not owned is invalid after any of them.
+     * Retain the node to keep it across a collection. The semantics of an instruction and the
+     * queries of the solver free the region of the nodes they built when they return, so the
+     * number of nodes follows the live state instead of the length of the trace.
+     */
     class AstGarbageCollector {
       protected:
-        //! This container contains all allocated nodes.
-        std::set<triton::ast::AbstractNode*> allocatedNodes;
+        //! The first recorded node (the oldest one).
+        triton::ast::AbstractNode* firstAllocated;
+
+        //! The last recorded node (the youngest one).
+        triton::ast::AbstractNode* lastAllocated;
+
+        //! The number of recorded nodes.
+        triton::__uint numberOfAllocatedNodes;
+
+        //! The serial of the next recorded node.
+        triton::__uint nextSerial;
 
         //! This map maintains a link between symbolic variables and their nodes.
         std::map<std::string, triton::ast::AbstractNode*> variableNodes;
 
+        //! Links a node at the end of the allocation list.
+        void linkAstNode(triton::ast::AbstractNode* node);
+
+        //! Unlinks a node from the allocation list.
+        void unlinkAstNode(triton::ast::AbstractNode* node);
+
+        //! Removes a node from the allocation list, the variables map and the dictionaries.
+        void forgetAstNode(triton::ast::AbstractNode* node);
+
+        //! Frees the nodes of the worklist and the childs which are not referenced anymore.
+        void deleteAstNodes(std::vector<triton::ast::AbstractNode*>& worklist);
+
 
       public:
         //! Constructor.
@@ -50,12 +93,24 @@ namespace triton {
         //! Destructor.
         ~AstGarbageCollector();
 
-        //! Go through every allocated nodes and free them.
+        //! Adds an owner to a node.
+        void retainAstNode(triton::ast::AbstractNode* node);
+
+        //! Removes an owner from a node. The node is freed when it has no owner anymore.
+        void releaseAstNode(triton::ast::AbstractNode* node);
+
+        //! Go through every allocated nodes and free those which are not referenced anymore, including the nodes which never had an owner.
         void freeAllAstNodes(void);
 
-        //! Frees a set of nodes and removes them from the global container.
+        //! Frees the nodes of a set which are not referenced anymore and clears the set.
         void freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes);
 
+        //! Returns a region mark. Every node recorded after this call belongs to the region.
+        triton::__uint markAstRegion(void) const;
+
+        //! Frees all nodes recorded since the region mark which are not referenced anymore.
+        void freeAstRegion(triton::__uint mark);
+
         //! Extracts all unique nodes from a partial AST into the uniqueNodes set.
         void extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const;
 
@@ -66,7 +121,10 @@ namespace triton {
         void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
 
         //! Returns all allocated nodes.
-        const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
+        std::set<triton::ast::AbstractNode*> getAllocatedAstNodes(void) const;
+
+        //! Returns the number of allocated nodes.
+        triton::__uint getNumberOfAllocatedAstNodes(void) const;
 
         //! Returns all variable nodes recorded.
         const std::map<std::string, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
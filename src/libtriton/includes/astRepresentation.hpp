@@ -9,6 +9,10 @@
 #define TRITON_ASTREPRESENTATION_H
 
 #include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "astPythonRepresentation.hpp"
 #include "astRepresentationInterface.hpp"
 #include "astSmtRepresentation.hpp"
@@ -43,11 +47,21 @@ namespace triton {
       enum mode_e {
         SMT_REPRESENTATION,     /*!< SMT representation */
         PYTHON_REPRESENTATION,  /*!< Python representation */
+        SMT_DAG_REPRESENTATION, /*!< SMT representation, the shared sub-trees are printed once */
         LAST_REPRESENTATION
       };
 
 
-      //! Pseudo code of SMT AST.
+      /*! \brief Pseudo code of SMT AST.
+       *
+       * \description
+       * In the SMT_DAG_REPRESENTATION mode, the sub-trees used several times by the printed
+       * AST are printed once and then named, so the text is linear in the number of unique
+       * nodes instead of the size of the expanded tree. If the root is an `assert`, the shared
+       * sub-trees are declared by `define-fun` commands before it, which is the form used to
+       * export a query. Otherwise they are bound by nested `let` and the text is still a term.
+       * References are printed as references, use getFullAst() to share through them.
+       */
       class AstRepresentation {
         protected:
           //! The representation mode.
@@ -56,6 +70,39 @@ namespace triton {
           //! AstRepresentation interface.
           triton::ast::representations::AstRepresentationInterface* representations[triton::ast::representations::LAST_REPRESENTATION];
 
+          //! A node being printed. Its text has a hole at the offset of each child.
+          struct Frame {
+            //! The text of the node alone, without its childs.
+            std::string text;
+
+            //! The offset of the text not yet written.
+            std::size_t position;
+
+            //! The childs, in the order of their holes.
+            std::vector<AbstractNode*> childs;
+
+            //! The offsets of the holes in the text, one per child.
+            std::vector<std::size_t> holes;
+
+            //! The next child to print.
+            std::size_t next;
+          };
+
+          //! The frame of the running render, nullptr outside of a render.
+          Frame* rendering;
+
+          //! The names of the shared sub-trees already printed by the running DAG print. Their next uses print the name.
+          std::unordered_map<AbstractNode*, std::string> names;
+
+          //! Renders a node alone into `frame`. Its childs are left as holes.
+          void render(Frame& frame, AbstractNode* node);
+
+          //! Prints a tree, the childs which are named are printed by their name.
+          std::ostream& printTree(std::ostream& stream, AbstractNode* node);
+
+          //! Prints a tree whose shared sub-trees are printed once. See the SMT_DAG_REPRESENTATION mode.
+          std::ostream& printDag(std::ostream& stream, AbstractNode* node);
+
 
         public:
           //! Constructor.
@@ -70,7 +117,7 @@ namespace triton {
           //! Sets the representation mode.
           void setMode(triton::uint32 mode);
 
-          //! Displays the node according to the representation mode.
+          //! Displays the node according to the representation mode. Deep ASTs are printed without recursion.
           std::ostream& print(std::ostream& stream, AbstractNode* node);
       };
 
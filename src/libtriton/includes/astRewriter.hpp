@@ -0,0 +1,179 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#ifndef TRITON_ASTREWRITER_H
+#define TRITON_ASTREWRITER_H
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! \module The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! \module The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! The number of pattern variables (`a` to `z`) and of pattern parameters (`A` to `Z`).
+    const triton::uint32 REWRITE_VARIABLES = 26;
+
+    //! The maximum number of rules applied on the same node before moving to its parents.
+    const triton::uint32 REWRITE_MAX_STEPS = 16;
+
+
+    //! The bindings of a matched pattern.
+    struct AstRewriteBindings {
+      //! The nodes bound to the variables `a` to `z`, nullptr if not bound.
+      AbstractNode* nodes[REWRITE_VARIABLES];
+
+      //! The values bound to the parameters `A` to `Z`.
+      triton::uint32 params[REWRITE_VARIABLES];
+
+      //! The bound parameters, one bit per parameter.
+      triton::uint32 boundParams;
+    };
+
+
+    //! A rewrite computed by a function. Returns the new node, or nullptr if the rule does not apply.
+    typedef AbstractNode* (*AstRewriteFunction)(AbstractNode* node, const AstRewriteBindings& bindings);
+
+
+    //! A term of a pattern or of a replacement.
+    struct AstPatternTerm {
+      //! The type of the term.
+      enum type_e {
+        TERM_NODE,       //!< An operation, matches a node of `kind` whose childs match `childs`.
+        TERM_VARIABLE,   //!< Matches any node. A variable used twice matches the same node twice.
+        TERM_CONSTANT,   //!< Matches the constant bit-vector `value`.
+        TERM_MASK,       //!< Matches the constant bit-vector with all bits set (`-1`).
+        TERM_PARAMETER,  //!< Matches any rotation, extracted bit or extension size.
+        TERM_NUMBER,     //!< Matches the rotation, extracted bit or extension size `value`.
+      } type;
+
+      //! The kind of the node. TERM_NODE only.
+      enum kind_e kind;
+
+      //! The value of the constant or of the number.
+      triton::uint512 value;
+
+      //! The index of the variable or of the parameter.
+      triton::uint32 index;
+
+      //! The operands of the node. The rotation of bvrol/bvror, the bits of extract and the size of sx/zx come first.
+      std::vector<AstPatternTerm> childs;
+
+      //! True if the node may have more operands than `childs` (`...`). Patterns only.
+      bool variadic;
+    };
+
+
+    //! The rewritten trees. hash -> (tree, rewritten tree).
+    typedef std::unordered_map<triton::uint64, std::pair<AbstractNode*, AbstractNode*> > AstRewriteCache;
+
+
+    //! A rewrite rule.
+    struct AstRewriteRule {
+      //! The name of the rule.
+      std::string name;
+
+      //! The pattern matched by the rule. Its root is always a TERM_NODE.
+      AstPatternTerm pattern;
+
+      //! The replacement of the matched node, if `function` is nullptr.
+      AstPatternTerm replacement;
+
+      //! The function computing the replacement, nullptr if the rule uses `replacement`.
+      AstRewriteFunction function;
+    };
+
+
+    //! \class AstRewriter
+    /*! \brief A table-driven rewrite engine over Triton's ASTs.
+     *
+     * \description
+     * Rules are written as SMT-like patterns over the node kinds, e.g. `(bvxor x x)` -> `0` or
+     * `(ite (not c) a b)` -> `(ite c b a)`. Lowercase letters are variables which match any node,
+     * a variable used twice must match the same node (with the AST_DICTIONARIES mode, structurally
+     * equal trees are the same node). Numbers match constant bit-vectors of any size and `-1`
+     * matches the constant with all bits set. The bits of extract, the size of sx/zx and the
+     * rotation of bvrol/bvror are written first, e.g. `(extract H L x)`, where uppercase letters
+     * match any value. Commutative operations match both orders of their operands, and `...`
+     * matches the remaining operands of a variadic node such as concat. The constants of a
+     * replacement take the size of the rewritten node. Rules which need some arithmetic on the
+     * parameters (extract/concat fusion...) are functions.
+     *
+     * The AST is rewritten bottom-up with an explicit stack: the childs of a node are rewritten
+     * before the node itself, then the rules of its kind are applied, and the result is rewritten
+     * again, at most REWRITE_MAX_STEPS times. Operations over constant bit-vectors only are
+     * evaluated. The results are cached per node, so shared sub-trees are rewritten once. A rule
+     * never changes the size or the sort (Bool or bit-vector) of a node, a rewrite which would is
+     * ignored. References are not unrolled.
+     */
+    class AstRewriter {
+      protected:
+        //! The rules.
+        std::vector<AstRewriteRule> rules;
+
+        //! The indexes of the rules by the kind of their root node.
+        std::vector<std::vector<triton::uint32> > rulesByKind;
+
+        //! Builds the node of a replacement. The constants take `size` bits.
+        AbstractNode* build(const AstPatternTerm& term, const AstRewriteBindings& bindings, triton::uint32 size) const;
+
+        //! Applies the first matching rule on the node. Returns nullptr if no rule matches.
+        AbstractNode* apply(AbstractNode* node) const;
+
+        //! Records a rule.
+        void addRule(const AstRewriteRule& rule);
+
+        //! Rewrites the trees which are not in the cache yet. `depth` is the number of rules applied on the top of the tree so far.
+        AbstractNode* rewrite(AbstractNode* node, AstRewriteCache& cache, triton::uint32 depth) const;
+
+      public:
+        //! Constructor. Loads the default rules.
+        AstRewriter();
+
+        //! Destructor.
+        ~AstRewriter();
+
+        //! Records a rule whose replacement is a pattern. Throws if a pattern is malformed or if the replacement uses an unbound variable.
+        void addRule(const std::string& name, const std::string& pattern, const std::string& replacement);
+
+        //! Records a rule whose replacement is computed by a function.
+        void addRule(const std::string& name, const std::string& pattern, AstRewriteFunction function);
+
+        //! Removes all rules.
+        void clearRules(void);
+
+        //! Returns the names of the rules, in their order of application.
+        std::vector<std::string> getRules(void) const;
+
+        //! Rewrites the AST. Returns the rewritten root, `node` itself if no rule applies.
+        AbstractNode* rewrite(AbstractNode* node) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTREWRITER_H */
@@ -0,0 +1,223 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#ifndef TRITON_ASTSMALLVECTOR_H
+#define TRITON_ASTSMALLVECTOR_H
+
+#include <cstring>
+#include <stdexcept>
+
+#include "tritonTypes.hpp"
+
+
+
+//! \module The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! \module The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class SmallVector
+    /*! \brief A vector of pointers with inline storage.
+     *
+     * \description
+     * Up to `N` elements are stored inside the object itself. The storage moves to the heap
+     * only when the vector grows beyond `N` elements. AST nodes use it for their childs and
+     * their parents, which are almost always less than three, so most nodes do not allocate
+     * anything besides themselves. `T` must be a pointer type.
+     */
+    template <typename T, triton::uint32 N>
+    class SmallVector {
+      protected:
+        //! The elements. `inlineData` is used while `capacity` is `N`, `heapData` otherwise.
+        union {
+          T inlineData[N];
+          T* heapData;
+        };
+
+        //! The number of elements.
+        triton::uint32 count;
+
+        //! The number of elements which can be stored without growing.
+        triton::uint32 capacity;
+
+        //! Grows the storage to hold at least `needed` elements.
+        void grow(triton::uint32 needed) {
+          triton::uint32 newCapacity = this->capacity * 2;
+          if (newCapacity < needed)
+            newCapacity = needed;
+
+          T* newData = new T[newCapacity];
+          std::memcpy(newData, this->data(), this->count * sizeof(T));
+
+          if (this->capacity > N)
+            delete[] this->heapData;
+
+          this->heapData = newData;
+          this->capacity = newCapacity;
+        }
+
+      public:
+        //! Iterator.
+        typedef T* iterator;
+
+        //! Const iterator.
+        typedef const T* const_iterator;
+
+        //! Constructor.
+        SmallVector() {
+          this->count    = 0;
+          this->capacity = N;
+        }
+
+        //! Constructor by copy.
+        SmallVector(const SmallVector& copy) {
+          this->count    = 0;
+          this->capacity = N;
+          *this = copy;
+        }
+
+        //! Destructor.
+        ~SmallVector() {
+          if (this->capacity > N)
+            delete[] this->heapData;
+        }
+
+        //! Copies another vector.
+        SmallVector& operator=(const SmallVector& other) {
+          if (this == &other)
+            return *this;
+          this->count = 0;
+          if (other.count > this->capacity)
+            this->grow(other.count);
+          std::memcpy(this->data(), other.data(), other.count * sizeof(T));
+          this->count = other.count;
+          return *this;
+        }
+
+        //! Returns a pointer to the first element.
+        T* data(void) {
+          return (this->capacity > N) ? this->heapData : this->inlineData;
+        }
+
+        //! Returns a pointer to the first element.
+        const T* data(void) const {
+          return (this->capacity > N) ? this->heapData : this->inlineData;
+        }
+
+        //! Returns the number of elements.
+        triton::uint32 size(void) const {
+          return this->count;
+        }
+
+        //! Returns true if there is no element.
+        bool empty(void) const {
+          return this->count == 0;
+        }
+
+        //! Returns the number of bytes allocated on the heap, 0 while the elements are stored inline.
+        triton::uint32 getHeapSize(void) const {
+          return (this->capacity > N) ? (this->capacity * sizeof(T)) : 0;
+        }
+
+        //! Returns the element at `index`. Not checked.
+        T& operator[](triton::uint32 index) {
+          return this->data()[index];
+        }
+
+        //! Returns the element at `index`. Not checked.
+        const T& operator[](triton::uint32 index) const {
+          return this->data()[index];
+        }
+
+        //! Returns the element at `index`.
+        T& at(triton::uint32 index) {
+          if (index >= this->count)
+            throw std::out_of_range("SmallVector::at(): Invalid index.");
+          return this->data()[index];
+        }
+
+        //! Returns the last element. The vector must not be empty.
+        T& back(void) {
+          return this->data()[this->count - 1];
+        }
+
+        //! Returns an iterator on the first element.
+        iterator begin(void) {
+          return this->data();
+        }
+
+        //! Returns an iterator past the last element.
+        iterator end(void) {
+          return this->data() + this->count;
+        }
+
+        //! Returns an iterator on the first element.
+        const_iterator begin(void) const {
+          return this->data();
+        }
+
+        //! Returns an iterator past the last element.
+        const_iterator end(void) const {
+          return this->data() + this->count;
+        }
+
+        //! Appends an element.
+        void push_back(T value) {
+          if (this->count == this->capacity)
+            this->grow(this->count + 1);
+          this->data()[this->count++] = value;
+        }
+
+        //! Removes the last element. The vector must not be empty.
+        void pop_back(void) {
+          this->count--;
+        }
+
+        //! Returns true if the vector contains `value`.
+        bool contains(T value) const {
+          for (const_iterator it = this->begin(); it != this->end(); it++) {
+            if (*it == value)
+              return true;
+          }
+          return false;
+        }
+
+        //! Removes the last occurrence of `value`. The order of the other elements is not kept. Returns false if `value` is not found.
+        bool removeOne(T value) {
+          T* values = this->data();
+          for (triton::uint32 index = this->count; index > 0; index--) {
+            if (values[index - 1] == value) {
+              values[index - 1] = values[this->count - 1];
+              this->count--;
+              return true;
+            }
+          }
+          return false;
+        }
+
+        //! Removes all elements. The storage is kept.
+        void clear(void) {
+          this->count = 0;
+        }
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTSMALLVECTOR_H */
@@ -0,0 +1,89 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#ifndef TRITON_ASTSTATS_H
+#define TRITON_ASTSTATS_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! \module The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! \module The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! The shape of one or several ASTs.
+    struct AstStats {
+      //! The number of unique nodes reached.
+      triton::uint64 uniqueNodes;
+
+      //! The number of nodes once the shared sub-trees are expanded. Saturates at the maximum of a triton::uint64.
+      triton::uint64 treeNodes;
+
+      //! The number of nodes on the longest path from a root to a leaf.
+      triton::uint32 depth;
+
+      //! The memory used by the unique nodes, in bytes.
+      triton::uint64 bytes;
+
+      //! The number of different symbolic variables reached.
+      triton::uint32 variables;
+
+      //! The number of unique nodes of each kind. kind name -> count.
+      std::map<std::string, triton::uint64> kinds;
+    };
+
+
+    //! Returns the name of a kind of node, as used by the statistics.
+    std::string getKindName(enum kind_e kind);
+
+    /*!
+     * \brief Returns the shape of an AST.
+     *
+     * \description
+     * Each unique node is visited once with an explicit stack. When `unroll` is true, a
+     * reference is expanded into the AST of its symbolic expression: the reference node is
+     * counted as a unique node but it does not add to `treeNodes` nor to `depth`.
+     */
+    AstStats getAstStats(AbstractNode* node, bool unroll=true);
+
+    //! Returns the shape of several ASTs taken together. The nodes shared by several roots are counted once, `treeNodes` is the sum over the roots and `depth` their maximum.
+    AstStats getAstStats(const std::vector<AbstractNode*>& roots, bool unroll=true);
+
+    /*!
+     * \brief Returns the number of nodes of an AST once its references are unrolled and its shared sub-trees expanded.
+     *
+     * \description
+     * Only the nodes of the AST itself are visited: a reference counts for the tree size
+     * of its symbolic expression, see SymbolicExpression::getTreeSize(). Once the sizes of the
+     * referenced expressions are known, the cost is bounded by the AST itself, whatever the
+     * length of the trace behind it. Saturates at the maximum of a triton::uint64.
+     */
+    triton::uint64 getAstTreeSize(AbstractNode* node);
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTSTATS_H */
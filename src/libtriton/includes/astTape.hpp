@@ -0,0 +1,188 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#ifndef TRITON_ASTTAPE_H
+#define TRITON_ASTTAPE_H
+
+#include <map>
+#include <vector>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! \module The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! \module The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! The number of models evaluated at once by a batch evaluation.
+    const triton::uint32 TAPE_LANES = 64;
+
+
+    //! An operand of a tape instruction.
+    struct TapeOperand {
+      //! The register which holds the value.
+      triton::uint32 reg;
+
+      //! The size of the value in bits. Values up to 64 bits live in the narrow registers, the others in the wide registers.
+      triton::uint32 size;
+    };
+
+
+    //! An instruction of a tape, the evaluation of one AST node.
+    struct TapeInstruction {
+      //! The kind of the evaluated node.
+      triton::uint32 kind;
+
+      //! The size of the result in bits.
+      triton::uint32 size;
+
+      //! The biggest size among the result and the operands. Up to 64 bits, the instruction runs on native integers.
+      triton::uint32 width;
+
+      //! The destination register.
+      triton::uint32 dst;
+
+      //! The index of the first operand in the operands of the tape.
+      triton::uint32 first;
+
+      //! The number of operands.
+      triton::uint32 count;
+
+      //! The rotation of bvrol/bvror and the low bit of extract.
+      triton::uint32 param;
+    };
+
+
+    //! \class AstTape
+    /*! \brief An AST compiled into a linear evaluation tape.
+     *
+     * \description
+     * The AST is flattened once, childs first, into a list of instructions over two register
+     * files: native 64-bits registers and uint512 registers for the wider values. Sub-trees
+     * which do not depend on a symbolic variable are folded into constant registers and
+     * references are unrolled. Evaluating the tape for new values of the symbolic variables is
+     * then a single loop over the instructions, the nodes are neither read nor modified. The
+     * tape gives the same result as AbstractNode::evaluate() would give for the same values.
+     *
+     * A batch of models is evaluated TAPE_LANES models at a time. Each narrow register then
+     * holds one value per model, contiguously, in lanes of 8, 16, 32 or 64 bits depending on
+     * the widest narrow register of the tape, and each instruction runs one loop over the
+     * lanes. Tapes with wide registers evaluate a batch model by model.
+     */
+    class AstTape {
+      protected:
+        //! The registers which hold values up to 64 bits.
+        std::vector<triton::uint64> narrow;
+
+        //! The registers which hold values wider than 64 bits.
+        std::vector<triton::uint512> wide;
+
+        //! The instructions, in evaluation order.
+        std::vector<TapeInstruction> instructions;
+
+        //! The operands of all instructions.
+        std::vector<TapeOperand> operands;
+
+        //! The registers of the symbolic variables. symVarId -> register.
+        std::map<triton::__uint, TapeOperand> variables;
+
+        //! The register of the root node.
+        TapeOperand root;
+
+        //! The biggest size of the narrow registers, which selects the lanes of a batch evaluation.
+        triton::uint32 narrowWidth;
+
+        //! The lanes of the narrow registers during a batch evaluation of values up to 8 bits, TAPE_LANES values per register.
+        std::vector<triton::uint8> lanes8;
+
+        //! The lanes of the narrow registers during a batch evaluation of values up to 16 bits.
+        std::vector<triton::uint16> lanes16;
+
+        //! The lanes of the narrow registers during a batch evaluation of values up to 32 bits.
+        std::vector<triton::uint32> lanes32;
+
+        //! The lanes of the narrow registers during a batch evaluation of values up to 64 bits.
+        std::vector<triton::uint64> lanes64;
+
+        //! Returns a new register able to hold `size` bits.
+        TapeOperand newRegister(triton::uint32 size);
+
+        //! Returns the value of a register.
+        triton::uint512 getRegister(const TapeOperand& reg) const;
+
+        //! Sets the value of a register.
+        void setRegister(const TapeOperand& reg, const triton::uint512& value);
+
+        //! Loads an operand in the 64-bits domain.
+        void load(triton::uint64& value, triton::uint32 operand) const;
+
+        //! Loads an operand in the 512-bits domain.
+        void load(triton::uint512& value, triton::uint32 operand) const;
+
+        //! Stores the result of an instruction from the 64-bits domain.
+        void store(const TapeInstruction& insn, const triton::uint64& value);
+
+        //! Stores the result of an instruction from the 512-bits domain.
+        void store(const TapeInstruction& insn, const triton::uint512& value);
+
+        //! Executes an instruction in the T domain.
+        template <typename T> void execute(const TapeInstruction& insn);
+
+        //! Returns the lanes of type T.
+        template <typename T> std::vector<T>& getLanes(void);
+
+        //! Executes a narrow instruction over all lanes of type T.
+        template <typename T> void executeLanes(const TapeInstruction& insn);
+
+        //! Evaluates a batch of models TAPE_LANES at a time in the lanes of type T and appends the results.
+        template <typename T> void evaluateLanes(const std::vector<std::map<triton::__uint, triton::uint512> >& models, std::vector<triton::uint512>& results);
+
+      public:
+        //! Constructor. Compiles the AST of `node`.
+        AstTape(AbstractNode* node);
+
+        //! Destructor.
+        ~AstTape();
+
+        //! Returns the ids of the symbolic variables the AST depends on.
+        std::vector<triton::__uint> getVariables(void) const;
+
+        //! Returns the number of instructions.
+        triton::uint32 getNumberOfInstructions(void) const;
+
+        //! Sets the value of a symbolic variable for the next evaluations. Returns false if the AST does not depend on this variable.
+        bool setVariable(triton::__uint symVarId, const triton::uint512& value);
+
+        //! Evaluates the tape with the current values of the variables. The values are the concrete values of the variables at compile time until they are set.
+        triton::uint512 evaluate(void);
+
+        //! Sets the values of some variables, then evaluates the tape. symVarId -> value.
+        triton::uint512 evaluate(const std::map<triton::__uint, triton::uint512>& model);
+
+        //! Evaluates the tape for each model of a batch. A model is a map of symVarId -> value, the other variables keep their current values.
+        std::vector<triton::uint512> evaluate(const std::vector<std::map<triton::__uint, triton::uint512> >& models);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTTAPE_H */
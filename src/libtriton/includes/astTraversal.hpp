@@ -0,0 +1,56 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#ifndef TRITON_ASTTRAVERSAL_H
+#define TRITON_ASTTRAVERSAL_H
+
+#include <vector>
+
+#include "ast.hpp"
+
+
+
+//! \module The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! \module The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! Returns true if the traversal must walk the childs of the node.
+    typedef bool (*AstTraversalFilter)(AbstractNode* node);
+
+    /*!
+     * \brief Returns the unique nodes of a tree, childs first.
+     *
+     * \description
+     * The walk uses an explicit stack, so its depth is only bounded by the heap, and each
+     * unique node is listed once even if it is shared by several parents. Every node comes
+     * after its childs, so a visitor may compute the result of a node from the results of
+     * its childs without recursion. When `unroll` is true, a reference node depends on the
+     * AST of its symbolic expression, which is listed before the reference. The childs of
+     * the nodes rejected by `descend` are not walked, the nodes themselves are listed.
+     */
+    std::vector<AbstractNode*> postOrderTraversal(AbstractNode* root, bool unroll=false, AstTraversalFilter descend=nullptr);
+
+    //! Returns the unique nodes of a tree, parents first. Every node comes before its childs (reverse post-order).
+    std::vector<AbstractNode*> preOrderTraversal(AbstractNode* root, bool unroll=false, AstTraversalFilter descend=nullptr);
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTTRAVERSAL_H */
@@ -106,7 +106,7 @@ namespace triton {
         //! A list of operands
         std::vector<triton::arch::OperandWrapper> operands;
 
-        //! The semantics set of the instruction.
+        //! The semantics set of the instruction. The instruction is one of the owners of each expression, they stay valid once removed from the symbolic engine.
         std::vector<triton::engines::symbolic::SymbolicExpression*> symbolicExpressions;
 
         //! Constructor.
@@ -208,9 +208,12 @@ namespace triton {
         //! Records an instruction context for a register state.
         void updateContext(RegisterOperand reg);
 
-        //! Adds a symbolic expression
+        //! Adds a symbolic expression and records the address of the instruction as its origin. The instruction becomes one of its owners.
         void addSymbolicExpression(triton::engines::symbolic::SymbolicExpression* expr);
 
+        //! Replaces the symbolic expressions of the instruction. The expressions which are not kept are released.
+        void setSymbolicExpressions(const std::vector<triton::engines::symbolic::SymbolicExpression*>& exprs);
+
         //! Returns true if this instruction is a branch
         bool isBranch(void) const;
 
@@ -65,7 +65,7 @@ namespace triton {
         //! LEA - If the operand has a scale, this attribute is filled.
         ImmediateOperand scale;
 
-        //! The AST of the memory access.
+        //! The AST of the memory access. The operand is one of its owners.
         triton::ast::AbstractNode* ast;
 
         //! Copy a MemoryOperand.
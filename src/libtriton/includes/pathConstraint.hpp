@@ -49,6 +49,12 @@ namespace triton {
            */
           std::vector<std::tuple<bool, triton::__uint, triton::ast::AbstractNode*>> branches;
 
+          //! Adds an owner to the pc of each branch.
+          void retainBranches(void);
+
+          //! Removes an owner from the pc of each branch.
+          void releaseBranches(void);
+
 
         public:
           //! Constructor.
@@ -60,6 +66,9 @@ namespace triton {
           //! Destructore.
           ~PathConstraint();
 
+          //! Copies a path constraint.
+          PathConstraint& operator=(const PathConstraint &other);
+
           //! Adds a branch to the path constraint.
           void addBranchConstraint(bool taken, triton::__uint bbAddr, triton::ast::AbstractNode* pc);
 
@@ -8,6 +8,7 @@
 #ifndef TRITON_PATHMANAGER_H
 #define TRITON_PATHMANAGER_H
 
+#include <memory>
 #include <vector>
 
 #include "pathConstraint.hpp"
@@ -43,8 +44,16 @@ namespace triton {
           \brief The path manager class. */
       class PathManager {
         protected:
-          //! \brief The logical conjunction vector of path constraints.
-          std::vector<triton::engines::symbolic::PathConstraint> pathConstraints;
+          /*! \brief The logical conjunction vector of path constraints.
+           *
+           * \description
+           * The vector is shared with the copies of the path manager, and copied the first time
+           * one of them adds a path constraint, so backing up the symbolic engine does not copy it.
+           */
+          std::shared_ptr<std::vector<triton::engines::symbolic::PathConstraint> > pathConstraints;
+
+          //! Returns the path constraints to be modified, copied first if they are shared.
+          std::vector<triton::engines::symbolic::PathConstraint>& getWritablePathConstraints(void);
 
 
         public:
@@ -56,7 +56,7 @@ namespace triton {
            */
           std::map<triton::uint32, SolverModel> getModel(triton::ast::AbstractNode *node) const;
 
-          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. The unrolled copy of the constraint is freed once printed.
           /*! \brief list of map of symbolic variable id -> model
            *
            * \description
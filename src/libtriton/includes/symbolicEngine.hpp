@@ -10,17 +10,25 @@
 
 #include <list>
 #include <map>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "ast.hpp"
 #include "astDictionaries.hpp"
+#include "astStats.hpp"
 #include "memoryOperand.hpp"
 #include "pathManager.hpp"
 #include "registerOperand.hpp"
 #include "symbolicEnums.hpp"
 #include "symbolicExpression.hpp"
+#include "symbolicIdTable.hpp"
+#include "symbolicLocations.hpp"
+#include "symbolicMemoryTable.hpp"
 #include "symbolicOptimization.hpp"
 #include "symbolicSimplification.hpp"
+#include "symbolicSlicer.hpp"
 #include "symbolicVariable.hpp"
 #include "tritonTypes.hpp"
 
@@ -79,29 +87,29 @@ namespace triton {
           //! Symbolic variables id.
           triton::__uint uniqueSymVarId;
 
-          /*! \brief The map of symbolic variables
+          /*! \brief The table of symbolic variables
            *
            * \description
            * **item1**: variable id<br>
            * **item2**: symbolic variable
            */
-          std::map<triton::__uint, SymbolicVariable*> symbolicVariables;
+          IdTable<SymbolicVariable*> symbolicVariables;
 
-          /*! \brief The map of symbolic expressions
+          /*! \brief The table of symbolic expressions
            *
            * \description
            * **item1**: symbolic reference id<br>
            * **item2**: symbolic expression
            */
-          std::map<triton::__uint, SymbolicExpression*> symbolicExpressions;
+          IdTable<SymbolicExpression*> symbolicExpressions;
 
-          /*! \brief map of address -> symbolic expression
+          /*! \brief table of address -> symbolic expression
            *
            * \description
            * **item1**: memory address<br>
            * **item2**: symbolic reference id
            */
-          std::map<triton::__uint, triton::__uint> memoryReference;
+          MemoryReferenceTable memoryReference;
 
           /*! \brief map of <address:size> -> symbolic expression.
            *
@@ -109,7 +117,59 @@ namespace triton {
            * **item1**: <addr:size><br>
            * **item2**: symbolic reference id
            */
-          std::map<std::pair<triton::__uint, triton::uint32>, triton::ast::AbstractNode*> alignedMemoryReference;
+          AlignedMemoryTable alignedMemoryReference;
+
+          //! The last symbolic variable created for each register id.
+          std::unordered_map<triton::__uint, SymbolicVariable*> registerVariables;
+
+          //! The last symbolic variable created for each memory address.
+          std::unordered_map<triton::__uint, SymbolicVariable*> memoryVariables;
+
+          //! Records a symbolic variable in the tables of variables.
+          void addSymbolicVariable(SymbolicVariable* symVar);
+
+          //! The registers and memory bytes each symbolic expression was assigned to.
+          SymbolicLocationIndex locations;
+
+          //! Returns true if the location still refers to the symbolic expression.
+          bool isLocationOf(triton::__uint symExprId, const SymbolicLocation& location) const;
+
+          //! Records that a register (REG) or a memory byte (MEM) refers to the symbolic expression.
+          void addLocation(triton::__uint symExprId, symkind_e kind, triton::__uint value);
+
+          //! The ids of the symbolic expressions kept alive by the user.
+          std::set<triton::__uint> pinnedExpressions;
+
+          //! The number of symbolic expressions from which a collection is done automatically, 0 if disabled.
+          triton::__uint collectionThreshold;
+
+          //! The number of symbolic expressions from which the next automatic collection is done.
+          triton::__uint nextCollection;
+
+          /*! \brief The tree sizes and ids of the largest symbolic expressions, a heap whose first entry is the smallest one.
+           *
+           * \description
+           * It holds at most `largestCapacity` entries and is updated when an expression is created,
+           * once getLargestSymbolicExpressions() was called. It is rebuilt when one of its expressions
+           * was removed or when any AST was replaced, as every expression which refers to the
+           * replaced one may have changed its size.
+           */
+          std::vector<std::pair<triton::uint64, triton::__uint>> largestExpressions;
+
+          //! The number of expressions kept in `largestExpressions`, 0 while they are not tracked.
+          triton::uint32 largestCapacity;
+
+          //! The tree size generation of `largestExpressions`. \sa SymbolicExpression::getTreeSizeGeneration()
+          triton::uint64 largestGeneration;
+
+          //! Records a new symbolic expression in the largest ones if they are tracked.
+          void addLargestSymbolicExpression(const SymbolicExpression* expr);
+
+          //! Marks a symbolic expression as live and queues its AST to be walked.
+          void markSymbolicExpression(triton::__uint symExprId, std::vector<bool>& marked, std::vector<triton::ast::AbstractNode*>& worklist) const;
+
+          //! Returns the node of contiguous bytes read from the memory: the bits `high` to `low` of `source`, or the concrete `value` of `bits` bits if `source` is nullptr.
+          triton::ast::AbstractNode* buildSymbolicMemoryChunk(triton::ast::AbstractNode* source, triton::uint32 high, triton::uint32 low, const triton::uint512& value, triton::uint32 bits);
 
         public:
 
@@ -122,8 +182,34 @@ namespace triton {
           //! Removes the symbolic expression corresponding to the id.
           void removeSymbolicExpression(triton::__uint symExprId);
 
-          //! Removes aligned entry.
-          void removeAlignedMemory(triton::__uint addr);
+          /*! \brief Removes the symbolic expressions which cannot be reached from the symbolic state anymore and returns their number.
+           *
+           * \description
+           * The live expressions are the ones assigned to the registers and the memory, the ASTs
+           * of the aligned memory and of the path constraints, the pinned ones, the `roots` and
+           * all the expressions they refer to. The other expressions are removed from this engine
+           * only: the copies of the engine, the instructions and the Python objects which hold them
+           * keep them alive. The other pointers to them become invalid once nothing holds them.
+           */
+          triton::__uint collectSymbolicExpressions(const std::vector<SymbolicExpression*>& roots=std::vector<SymbolicExpression*>());
+
+          //! Returns true if there are enough symbolic expressions for an automatic collection.
+          bool isSymbolicGarbageCollectionNeeded(void) const;
+
+          //! Sets the number of symbolic expressions from which a collection is done automatically after an instruction. 0 disables it.
+          void setSymbolicGarbageCollectionThreshold(triton::__uint threshold);
+
+          //! Returns the number of symbolic expressions from which a collection is done automatically, 0 if disabled.
+          triton::__uint getSymbolicGarbageCollectionThreshold(void) const;
+
+          //! Keeps a symbolic expression alive through the collections.
+          void pinSymbolicExpression(triton::__uint symExprId);
+
+          //! Lets a pinned symbolic expression be collected.
+          void unpinSymbolicExpression(triton::__uint symExprId);
+
+          //! Removes the aligned entries overlapping `size` bytes from `addr`.
+          void removeAlignedMemory(triton::__uint addr, triton::uint32 size=1);
 
           //! Adds a symbolic variable.
           SymbolicVariable* newSymbolicVariable(symkind_e kind, triton::__uint kindValue, triton::uint32 size, const std::string& comment="");
@@ -143,6 +229,9 @@ namespace triton {
           //! Returns the symbolic variable corresponding to the symbolic variable name.
           SymbolicVariable* getSymbolicVariableFromName(const std::string& symVarName) const;
 
+          //! Returns the last symbolic variable created for a register id (REG) or a memory address (MEM), nullptr if there is none.
+          SymbolicVariable* getSymbolicVariableFromOrigin(symkind_e kind, triton::__uint kindValue) const;
+
           //! Returns the symbolic expression id corresponding to the memory address.
           triton::__uint getSymbolicMemoryId(triton::__uint addr) const;
 
@@ -212,17 +301,38 @@ namespace triton {
           //! Assigns a symbolic expression to a memory.
           void assignSymbolicExpressionToMemory(SymbolicExpression *se, const triton::arch::MemoryOperand& mem);
 
-          //! Returns the full AST of a root node.
+          //! Returns the full AST of a root node. The given AST is not modified, the unrolled nodes share the subtrees without references.
           triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node);
 
           //! Returns the list of the tainted symbolic expressions.
           std::list<SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
 
           //! Returns all symbolic expressions.
-          const std::map<triton::__uint, SymbolicExpression*>& getSymbolicExpressions(void) const;
+          const IdTable<SymbolicExpression*>& getSymbolicExpressions(void) const;
+
+          //! Returns the shape of the ASTs of all symbolic expressions taken together.
+          triton::ast::AstStats getAstStats(void) const;
+
+          //! Returns the `n` symbolic expressions with the biggest tree size, the biggest first. \sa SymbolicExpression::getTreeSize()
+          std::vector<SymbolicExpression*> getLargestSymbolicExpressions(triton::uint32 n);
+
+          //! Returns the backward slice of a symbolic expression: the expressions, instruction addresses and symbolic variables it depends on, itself included.
+          SymbolicSlice getBackwardSlice(triton::__uint symExprId) const;
+
+          //! Returns the backward slice of an AST: the expressions, instruction addresses and symbolic variables it depends on.
+          SymbolicSlice getBackwardSlice(triton::ast::AbstractNode* node) const;
+
+          //! Returns the backward slices of the taken branches of the path constraints, in the order of the path constraints. The ASTs are walked once for all slices.
+          std::vector<SymbolicSlice> getPathConstraintsBackwardSlices(void) const;
+
+          //! Saves the symbolic expressions, variables, registers and memory into a file. \sa triton::engines::symbolic::SerializedHeader
+          void saveSymbolicState(const std::string& filename) const;
+
+          //! Replaces the symbolic expressions, variables, registers and memory by the ones saved in a file. The path constraints are cleared. Throws and keeps the current state if the file is invalid.
+          void loadSymbolicState(const std::string& filename);
 
           //! Returns all symbolic variables.
-          const std::map<triton::__uint, SymbolicVariable*>& getSymbolicVariables(void) const;
+          const IdTable<SymbolicVariable*>& getSymbolicVariables(void) const;
 
           //! Returns all variable declarations representation.
           std::string getVariablesDeclaration(void) const;
@@ -265,10 +375,10 @@ namespace triton {
           //! Returns true if the symbolic expression ID exists.
           bool isSymbolicExpressionIdExists(triton::__uint symExprId) const;
 
-          //! Initializes a SymbolicEngine.
+          //! Initializes a SymbolicEngine. The tables of expressions, variables, memory references and path constraints are shared with `other` until one of the engines writes into them.
           void init(const SymbolicEngine& other);
 
-          //! Copies a SymbolicEngine.
+          //! Copies a SymbolicEngine. \sa init()
           void operator=(const SymbolicEngine& other);
 
           //! Constructor.
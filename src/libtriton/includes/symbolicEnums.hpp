@@ -55,6 +55,8 @@ namespace triton {
       enum optimization_e {
         ALIGNED_MEMORY,        //!< Keep a map of aligned memory.
         AST_DICTIONARIES,      //!< Abstract Syntax Tree dictionaries.
+        AST_REWRITING,         //!< Rewrite the new symbolic expressions with the rules of the AST rewriter.
+        CONSTANT_FOLDING,      //!< Fold constant operands and trivial identities when the AST nodes are built.
         ONLY_ON_SYMBOLIZED,    //!< Perform symbolic execution only on symbolized expressions.
         ONLY_ON_TAINTED,       //!< Perform symbolic execution only on tainted instructions.
         PC_TRACKING_SYMBOLIC,  //!< Track path constraints only if they are symbolized.
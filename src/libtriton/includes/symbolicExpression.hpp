@@ -14,6 +14,7 @@
 #include "memoryOperand.hpp"
 #include "registerOperand.hpp"
 #include "symbolicEnums.hpp"
+#include "symbolicIdTable.hpp"
 #include "tritonTypes.hpp"
 
 
@@ -43,7 +44,7 @@ namespace triton {
 
       //! \class SymbolicExpression
       /*! \brief The symbolic expression class */
-      class SymbolicExpression {
+      class SymbolicExpression : public IdTableEntry {
 
         protected:
           //! The kind of the symbolic expression.
@@ -64,6 +65,24 @@ namespace triton {
           //! The origin register if `kind` is equal to `triton::engines::symbolic::REG`, `REG_INVALID` otherwise.
           triton::arch::RegisterOperand originRegister;
 
+          //! The address of the instruction which created the symbolic expression, 0 if it was not created by an instruction.
+          triton::__uint address;
+
+          //! True if the symbolic expression was created by an instruction, then `address` is defined.
+          bool addressFlag;
+
+          //! The number of nodes of the AST once its references are unrolled and its shared sub-trees expanded, 0 until it is computed. \sa triton::ast::getAstTreeSize()
+          mutable triton::uint64 treeSize;
+
+          //! The value of `treeSizeGeneration` when `treeSize` was computed.
+          mutable triton::uint64 treeSizeVersion;
+
+          //! Incremented each time an AST is replaced. The tree sizes computed before are stale, as they may include the replaced AST through a reference.
+          static triton::uint64 treeSizeGeneration;
+
+          //! Returns true if `treeSize` is computed and not stale.
+          bool isTreeSizeValid(void) const;
+
         public:
           //! True if the symbolic expression is tainted.
           bool isTainted;
@@ -101,9 +120,27 @@ namespace triton {
           //! Returns the origin register if `kind` is equal to `triton::engines::symbolic::REG`, `REG_INVALID` otherwise.
           const triton::arch::RegisterOperand& getOriginRegister(void) const;
 
+          //! Returns the address of the instruction which created the symbolic expression, 0 if it was not created by an instruction. \sa hasAddress()
+          triton::__uint getAddress(void) const;
+
+          //! Returns true if the symbolic expression was created by an instruction, whatever its address.
+          bool hasAddress(void) const;
+
+          //! Returns the number of nodes of the AST once its references are unrolled and its shared sub-trees expanded. Computed on the first call after an AST is replaced, saturates at the maximum of a triton::uint64.
+          triton::uint64 getTreeSize(void) const;
+
+          //! Returns the number of ASTs replaced so far. The tree sizes are recomputed when it changes.
+          static triton::uint64 getTreeSizeGeneration(void);
+
+          //! Marks all the tree sizes as stale.
+          static void invalidateTreeSizes(void);
+
           //! Sets a root node.
           void setAst(triton::ast::AbstractNode* node);
 
+          //! Sets the address of the instruction which created the symbolic expression. Then hasAddress() is true.
+          void setAddress(triton::__uint addr);
+
           //! Sets the kind of the symbolic expression.
           void setKind(symkind_e k);
 
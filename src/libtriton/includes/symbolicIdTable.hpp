@@ -0,0 +1,365 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#ifndef TRITON_SYMBOLICIDTABLE_H
+#define TRITON_SYMBOLICIDTABLE_H
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! \module The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! \module The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! \module The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! \class IdTableEntry
+      /*! \brief The base of the objects of an IdTable: the number of owners of the object.
+       *
+       * \description
+       * The owners are the chunks of the tables which hold the object and the other holders of a
+       * pointer on it, such as the instructions which created an expression or the Python objects.
+       * An object removed from the tables stays alive while one of them holds it.
+       */
+      class IdTableEntry {
+        template <typename T> friend void retainIdTableEntry(T* object);
+        template <typename T> friend void releaseIdTableEntry(T* object);
+
+        protected:
+          //! The number of owners of the object. The object is deleted when it drops to 0.
+          triton::uint32 tableReferences;
+
+        public:
+          //! Constructor.
+          IdTableEntry() {
+            this->tableReferences = 0;
+          }
+
+          //! Constructor by copy. The copy is held by no chunk.
+          IdTableEntry(const IdTableEntry& copy) {
+            this->tableReferences = 0;
+          }
+
+          //! Copies another object. The number of owners of this one is kept.
+          IdTableEntry& operator=(const IdTableEntry& other) {
+            return *this;
+          }
+      };
+
+
+      //! Adds an owner to an object of the tables.
+      template <typename T>
+      void retainIdTableEntry(T* object) {
+        if (object != nullptr)
+          object->tableReferences++;
+      }
+
+
+      //! Removes an owner from an object of the tables. It is deleted if it has no owner anymore.
+      template <typename T>
+      void releaseIdTableEntry(T* object) {
+        if (object != nullptr && --object->tableReferences == 0)
+          delete object;
+      }
+
+
+      //! \class IdTable
+      /*! \brief A table of pointers indexed by id.
+       *
+       * \description
+       * The symbolic expression and variable ids come from increasing counters, so the table
+       * stores the pointers in chunks of `2^CHUNK_BITS` slots indexed directly by id. A lookup is
+       * two array accesses and a trace with millions of ids does not copy the table when it grows.
+       * A removed id leaves an empty slot, which the iteration skips. `T` must be a pointer type.
+       *
+       * The table owns the pointers. A copy of the table shares its chunks with the original, so
+       * taking it is O(1): a chunk is copied the first time one of the tables writes into it, and
+       * a pointer is deleted once nothing owns it anymore. A backup of the symbolic engine
+       * therefore costs the chunks written since it was taken, and it keeps the objects removed
+       * from the engine alive for a restore. The owners of an object are counted in the object
+       * itself, which derives from IdTableEntry, so a slot is a plain pointer. The count is not
+       * atomic: the copies of a table must be used from one thread.
+       */
+      template <typename T>
+      class IdTable {
+        protected:
+          //! The number of bits of the index of a slot in its chunk.
+          static const triton::uint32 CHUNK_BITS = 12;
+
+          //! The number of slots of a chunk.
+          static const triton::__uint CHUNK_SIZE = static_cast<triton::__uint>(1) << CHUNK_BITS;
+
+          //! Holds an object in one more chunk.
+          static void retain(T value) {
+            retainIdTableEntry(value);
+          }
+
+          //! Holds an object in one less chunk. It is deleted if it has no owner anymore.
+          static void release(T value) {
+            releaseIdTableEntry(value);
+          }
+
+          //! The slots of `CHUNK_SIZE` consecutive ids.
+          struct Chunk {
+            //! The objects, nullptr for an id not set.
+            T slots[CHUNK_SIZE];
+
+            //! Constructor. All the slots are empty.
+            Chunk() {
+              std::fill(this->slots, this->slots + CHUNK_SIZE, nullptr);
+            }
+
+            //! Constructor by copy. The objects are held by both chunks.
+            Chunk(const Chunk& copy) {
+              for (triton::__uint index = 0; index < CHUNK_SIZE; index++) {
+                this->slots[index] = copy.slots[index];
+                retain(this->slots[index]);
+              }
+            }
+
+            //! Destructor. Releases the objects.
+            ~Chunk() {
+              for (triton::__uint index = 0; index < CHUNK_SIZE; index++)
+                release(this->slots[index]);
+            }
+
+            //! A chunk is only copied by construction.
+            Chunk& operator=(const Chunk& other) = delete;
+          };
+
+          //! The chunks by chunk number. A chunk is allocated the first time one of its ids is set.
+          typedef std::vector<std::shared_ptr<Chunk> > Directory;
+
+          //! The chunks, shared with the copies of the table until one of them writes.
+          std::shared_ptr<Directory> chunks;
+
+          //! The number of ids set.
+          triton::__uint count;
+
+          //! Returns the number of chunks.
+          triton::__uint getNumberOfChunks(void) const {
+            return this->chunks ? this->chunks->size() : 0;
+          }
+
+          //! Returns the slot of an id, nullptr if its chunk is not allocated.
+          const T* getSlot(triton::__uint id) const {
+            triton::__uint chunk = id >> CHUNK_BITS;
+            if (chunk >= this->getNumberOfChunks() || (*this->chunks)[chunk] == nullptr)
+              return nullptr;
+            return &(*this->chunks)[chunk]->slots[id & (CHUNK_SIZE - 1)];
+          }
+
+          //! Returns the slot of an id to be written. The directory and the chunk are copied first if they are shared.
+          T& getWritableSlot(triton::__uint id) {
+            triton::__uint chunk = id >> CHUNK_BITS;
+
+            if (!this->chunks)
+              this->chunks = std::make_shared<Directory>();
+            else if (this->chunks.use_count() > 1)
+              this->chunks = std::make_shared<Directory>(*this->chunks);
+
+            if (chunk >= this->chunks->size())
+              this->chunks->resize(chunk + 1);
+
+            std::shared_ptr<Chunk>& slots = (*this->chunks)[chunk];
+            if (slots == nullptr)
+              slots = std::make_shared<Chunk>();
+            else if (slots.use_count() > 1)
+              slots = std::make_shared<Chunk>(*slots);
+
+            return slots->slots[id & (CHUNK_SIZE - 1)];
+          }
+
+        public:
+          //! \class const_iterator
+          /*! \brief Iterates over the ids set by increasing id, as a map does. */
+          class const_iterator {
+            protected:
+              //! The table.
+              const IdTable* table;
+
+              //! The current id, the capacity of the table at the end.
+              triton::__uint id;
+
+              //! The current <id : pointer>.
+              std::pair<triton::__uint, T> current;
+
+              //! Moves to the first id set from the current one.
+              void skip(void) {
+                triton::__uint capacity = this->table->getNumberOfChunks() << CHUNK_BITS;
+                while (this->id < capacity) {
+                  const std::shared_ptr<Chunk>& chunk = (*this->table->chunks)[this->id >> CHUNK_BITS];
+                  if (chunk == nullptr) {
+                    this->id = ((this->id >> CHUNK_BITS) + 1) << CHUNK_BITS;
+                    continue;
+                  }
+                  if (chunk->slots[this->id & (CHUNK_SIZE - 1)] != nullptr) {
+                    this->current = std::make_pair(this->id, chunk->slots[this->id & (CHUNK_SIZE - 1)]);
+                    return;
+                  }
+                  this->id++;
+                }
+                this->id = capacity;
+              }
+
+            public:
+              //! Constructor. The iterator must be assigned before it is used.
+              const_iterator() {
+                this->table = nullptr;
+                this->id    = 0;
+              }
+
+              //! Constructor. Starts at the first id set from `id`.
+              const_iterator(const IdTable* table, triton::__uint id) {
+                this->table = table;
+                this->id    = id;
+                this->skip();
+              }
+
+              //! Returns the current <id : pointer>.
+              const std::pair<triton::__uint, T>& operator*(void) const {
+                return this->current;
+              }
+
+              //! Returns the current <id : pointer>.
+              const std::pair<triton::__uint, T>* operator->(void) const {
+                return &this->current;
+              }
+
+              //! Moves to the next id set.
+              const_iterator& operator++(void) {
+                this->id++;
+                this->skip();
+                return *this;
+              }
+
+              //! Moves to the next id set.
+              const_iterator operator++(int) {
+                const_iterator copy = *this;
+                ++(*this);
+                return copy;
+              }
+
+              //! Returns true if both iterators are on the same id.
+              bool operator==(const const_iterator& other) const {
+                return this->id == other.id;
+              }
+
+              //! Returns true if the iterators are on different ids.
+              bool operator!=(const const_iterator& other) const {
+                return this->id != other.id;
+              }
+          };
+
+          //! Constructor.
+          IdTable() {
+            this->count = 0;
+          }
+
+          //! Constructor by copy. The chunks are shared.
+          IdTable(const IdTable& copy) {
+            this->chunks = copy.chunks;
+            this->count  = copy.count;
+          }
+
+          //! Copies another table. The chunks are shared.
+          IdTable& operator=(const IdTable& other) {
+            this->chunks = other.chunks;
+            this->count  = other.count;
+            return *this;
+          }
+
+          //! Returns the pointer of an id, nullptr if the id is not set.
+          T get(triton::__uint id) const {
+            const T* slot = this->getSlot(id);
+            return (slot != nullptr) ? *slot : nullptr;
+          }
+
+          //! Returns true if the id is set.
+          bool exists(triton::__uint id) const {
+            return this->get(id) != nullptr;
+          }
+
+          //! Sets the pointer of an id, the table takes its ownership. `value` must not be nullptr.
+          void set(triton::__uint id, T value) {
+            T& slot = this->getWritableSlot(id);
+            if (slot == nullptr)
+              this->count++;
+            retain(value);
+            release(slot);
+            slot = value;
+          }
+
+          //! Unsets an id. Its pointer is deleted if nothing else owns it. Returns false if the id is not set.
+          bool remove(triton::__uint id) {
+            if (!this->exists(id))
+              return false;
+            T& slot = this->getWritableSlot(id);
+            release(slot);
+            slot = nullptr;
+            this->count--;
+            return true;
+          }
+
+          //! Returns the number of ids set.
+          triton::__uint size(void) const {
+            return this->count;
+          }
+
+          //! Returns true if no id is set.
+          bool empty(void) const {
+            return this->count == 0;
+          }
+
+          //! Unsets all ids. The pointers are deleted if nothing else owns them.
+          void clear(void) {
+            this->chunks.reset();
+            this->count = 0;
+          }
+
+          //! Returns an iterator on the smallest id set.
+          const_iterator begin(void) const {
+            return const_iterator(this, 0);
+          }
+
+          //! Returns an iterator past the biggest id set.
+          const_iterator end(void) const {
+            return const_iterator(this, this->getNumberOfChunks() << CHUNK_BITS);
+          }
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICIDTABLE_H */
@@ -0,0 +1,115 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#ifndef TRITON_SYMBOLICLOCATIONS_H
+#define TRITON_SYMBOLICLOCATIONS_H
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "symbolicEnums.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! \module The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! \module The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! \module The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! A register or a memory byte backed by a symbolic expression.
+      struct SymbolicLocation {
+        //! The register id or the address.
+        triton::__uint value;
+
+        //! REG, MEM, or UNDEF for no location.
+        symkind_e kind;
+      };
+
+
+      //! \class SymbolicLocationIndex
+      /*! \brief The reverse index of symbolic expression id -> locations it was assigned to.
+       *
+       * \description
+       * Almost every expression backs one location, so the first location of an id is stored in
+       * a vector indexed by id and the next ones in a multimap. The index is not updated when a
+       * location is overwritten or concretized: its user checks that a location still refers to
+       * the id before using it, and may replace the first location of an id once it is stale.
+       *
+       * The first locations are stored by chunks of `2^CHUNK_BITS` ids. A copy of the index shares
+       * the chunks and the multimap with the original until one of them writes into them.
+       */
+      class SymbolicLocationIndex {
+        protected:
+          //! The number of bits of the index of an id in its chunk.
+          static const triton::uint32 CHUNK_BITS = 12;
+
+          //! The number of ids of a chunk.
+          static const triton::__uint CHUNK_SIZE = static_cast<triton::__uint>(1) << CHUNK_BITS;
+
+          //! The first locations of `CHUNK_SIZE` consecutive ids.
+          struct Chunk {
+            //! The first location of each id, of kind UNDEF if there is none.
+            SymbolicLocation first[CHUNK_SIZE];
+          };
+
+          //! The chunks of the first locations, shared with the copies of the index until one of them writes.
+          std::shared_ptr<std::vector<std::shared_ptr<Chunk> > > first;
+
+          //! The other locations of the ids backing several locations, shared like the chunks.
+          std::shared_ptr<std::unordered_multimap<triton::__uint, SymbolicLocation> > others;
+
+          //! Returns the first location of an id to be written. The chunk is allocated, or copied if it is shared.
+          SymbolicLocation& getWritableFirst(triton::__uint id);
+
+          //! Returns the other locations to be written, copied first if they are shared.
+          std::unordered_multimap<triton::__uint, SymbolicLocation>& getWritableOthers(void);
+
+        public:
+          //! Constructor.
+          SymbolicLocationIndex();
+
+          //! Returns the first location of an id, a location of kind UNDEF if there is none.
+          SymbolicLocation getFirst(triton::__uint id) const;
+
+          //! Adds a location to an id. If `replaceFirst` is true, it replaces the first location.
+          void add(triton::__uint id, const SymbolicLocation& location, bool replaceFirst);
+
+          //! Removes the locations of an id and returns them.
+          std::vector<SymbolicLocation> take(triton::__uint id);
+
+          //! Removes all locations.
+          void clear(void);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICLOCATIONS_H */
@@ -0,0 +1,281 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#ifndef TRITON_SYMBOLICMEMORYTABLE_H
+#define TRITON_SYMBOLICMEMORYTABLE_H
+
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "ast.hpp"
+#include "symbolicEnums.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! \module The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! \module The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! \module The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! The number of bits of the offset of an address in its page.
+      const triton::uint32 MEMORY_PAGE_BITS = 12;
+
+      //! The number of bytes of a page.
+      const triton::__uint MEMORY_PAGE_SIZE = static_cast<triton::__uint>(1) << MEMORY_PAGE_BITS;
+
+
+      //! A page of a MemoryReferenceTable: the symbolic expression ids of `MEMORY_PAGE_SIZE` bytes.
+      struct MemoryReferencePage {
+        //! The ids, UNSET for a concrete byte.
+        triton::__uint ids[MEMORY_PAGE_SIZE];
+
+        //! The number of ids which are not UNSET.
+        triton::uint32 count;
+      };
+
+
+      //! \class MemoryReferenceTable
+      /*! \brief The table of address -> symbolic expression id of the symbolic memory.
+       *
+       * \description
+       * The ids are stored by pages of 4 KiB, allocated on the first write into the page and
+       * freed when its last byte is concretized. The page of the last lookup is cached, so the
+       * bytes of a load or a store, which are almost always on the same page, are found without
+       * searching the pages. The ranges are handled a page at a time, and a page never written
+       * is skipped at once.
+       *
+       * A copy of the table shares its pages with the original: the map of pages is copied the
+       * first time one of the tables writes, and a page the first time one of them writes into it.
+       */
+      class MemoryReferenceTable {
+        protected:
+          //! The pages by page number.
+          typedef std::map<triton::__uint, std::shared_ptr<MemoryReferencePage> > PageMap;
+
+          //! The pages, shared with the copies of the table until one of them writes.
+          std::shared_ptr<PageMap> pages;
+
+          //! The number of bytes referenced.
+          triton::__uint count;
+
+          //! The page number of the last lookup.
+          mutable triton::__uint lastPageNumber;
+
+          //! The page of the last lookup, nullptr if it is not allocated.
+          mutable MemoryReferencePage* lastPage;
+
+          //! Returns the page of an address, nullptr if it is not allocated.
+          MemoryReferencePage* findPage(triton::__uint addr) const;
+
+          //! Returns the pages to be modified, copied first if they are shared.
+          PageMap& getWritablePages(void);
+
+          //! Returns the page of an iterator to be modified, copied first if it is shared.
+          MemoryReferencePage* getWritablePage(PageMap::iterator it);
+
+          //! Frees a page and forgets it.
+          void removePage(PageMap::iterator it);
+
+        public:
+          //! \class const_iterator
+          /*! \brief Iterates over the referenced bytes by increasing address, as a map does. */
+          class const_iterator {
+            protected:
+              //! The current page.
+              PageMap::const_iterator page;
+
+              //! The end of the pages.
+              PageMap::const_iterator last;
+
+              //! The offset of the current byte in its page.
+              triton::__uint offset;
+
+              //! The current <address : id>.
+              std::pair<triton::__uint, triton::__uint> current;
+
+              //! Moves to the first referenced byte from the current one.
+              void skip(void);
+
+            public:
+              //! Constructor. The iterator must be assigned before it is used.
+              const_iterator();
+
+              //! Constructor. Starts at the first referenced byte of `page`.
+              const_iterator(PageMap::const_iterator page, PageMap::const_iterator last);
+
+              //! Returns the current <address : id>.
+              const std::pair<triton::__uint, triton::__uint>& operator*(void) const;
+
+              //! Returns the current <address : id>.
+              const std::pair<triton::__uint, triton::__uint>* operator->(void) const;
+
+              //! Moves to the next referenced byte.
+              const_iterator& operator++(void);
+
+              //! Moves to the next referenced byte.
+              const_iterator operator++(int);
+
+              //! Returns true if both iterators are on the same byte.
+              bool operator==(const const_iterator& other) const;
+
+              //! Returns true if the iterators are on different bytes.
+              bool operator!=(const const_iterator& other) const;
+          };
+
+          //! Constructor.
+          MemoryReferenceTable();
+
+          //! Constructor by copy. The pages are shared.
+          MemoryReferenceTable(const MemoryReferenceTable& copy);
+
+          //! Copies another table. The pages are shared.
+          MemoryReferenceTable& operator=(const MemoryReferenceTable& other);
+
+          //! Returns the id of a byte, UNSET if the byte is concrete.
+          triton::__uint get(triton::__uint addr) const;
+
+          //! Returns the ids of the page of an address, indexed by offset in the page. nullptr if no byte of the page is referenced.
+          const triton::__uint* getPage(triton::__uint addr) const;
+
+          //! Sets the id of a byte.
+          void set(triton::__uint addr, triton::__uint id);
+
+          //! Concretizes a byte.
+          void erase(triton::__uint addr);
+
+          //! Concretizes `size` bytes from `addr`.
+          void erase(triton::__uint addr, triton::__uint size);
+
+          //! Concretizes all bytes and frees the pages.
+          void clear(void);
+
+          //! Returns the number of bytes referenced.
+          triton::__uint size(void) const;
+
+          //! Returns the number of pages allocated.
+          triton::__uint getNumberOfPages(void) const;
+
+          //! Returns an iterator on the lowest address referenced.
+          const_iterator begin(void) const;
+
+          //! Returns an iterator past the highest address referenced.
+          const_iterator end(void) const;
+      };
+
+
+      //! \class AlignedMemoryEntry
+      /*! \brief An entry of an AlignedMemoryTable: the AST of a store and the number of bytes it covers.
+       *
+       * \description
+       * An entry owns a reference on its AST, taken when it is created or copied and released when
+       * it is destroyed. A table and the copies which share its entries keep the AST alive, whatever
+       * else drops it.
+       */
+      class AlignedMemoryEntry {
+        protected:
+          //! The number of bytes covered.
+          triton::uint32 size;
+
+          //! The AST of the store.
+          triton::ast::AbstractNode* node;
+
+        public:
+          //! Constructor.
+          AlignedMemoryEntry(triton::uint32 size, triton::ast::AbstractNode* node);
+
+          //! Constructor by copy.
+          AlignedMemoryEntry(const AlignedMemoryEntry& copy);
+
+          //! Destructor.
+          ~AlignedMemoryEntry();
+
+          //! Copies another entry.
+          AlignedMemoryEntry& operator=(const AlignedMemoryEntry& other);
+
+          //! Returns the number of bytes covered.
+          triton::uint32 getSize(void) const;
+
+          //! Returns the AST of the store.
+          triton::ast::AbstractNode* getAst(void) const;
+      };
+
+
+      //! \class AlignedMemoryTable
+      /*! \brief The table of the ASTs stored in the memory, for the `ALIGNED_MEMORY` optimization.
+       *
+       * \description
+       * An entry is the AST of a store, keyed by the address range it covers. A store first
+       * removes the entries it overlaps, so the ranges of the table never overlap and the entries
+       * are sorted by start address. The entries overlapping a range are then the one starting
+       * before it, if it reaches the range, and the ones starting inside it: an invalidation is
+       * one search and a walk over the `k` entries removed, whatever the sizes. The entries are
+       * shared with the copies of the table until one of them modifies them, and each entry holds
+       * a reference on its AST (see AlignedMemoryEntry).
+       */
+      class AlignedMemoryTable {
+        public:
+          //! The entries by start address.
+          typedef std::map<triton::__uint, AlignedMemoryEntry> EntryMap;
+
+        protected:
+          //! The entries, shared with the copies of the table until one of them writes.
+          std::shared_ptr<EntryMap> entries;
+
+          //! Returns the entries to be modified, copied first if they are shared.
+          EntryMap& getWritableEntries(void);
+
+        public:
+          //! Constructor.
+          AlignedMemoryTable();
+
+          //! Returns the AST stored at `addr` on `size` bytes, nullptr if there is no such entry.
+          triton::ast::AbstractNode* get(triton::__uint addr, triton::uint32 size) const;
+
+          //! Records the AST stored at `addr` on `size` bytes. The entries it overlaps are removed.
+          void set(triton::__uint addr, triton::uint32 size, triton::ast::AbstractNode* node);
+
+          //! Removes the entries overlapping `size` bytes from `addr`.
+          void erase(triton::__uint addr, triton::uint32 size);
+
+          //! Removes all entries.
+          void clear(void);
+
+          //! Returns the number of entries.
+          triton::__uint size(void) const;
+
+          //! Returns the entries by start address.
+          const EntryMap& getEntries(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICMEMORYTABLE_H */
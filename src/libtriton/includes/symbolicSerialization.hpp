@@ -0,0 +1,394 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#ifndef TRITON_SYMBOLICSERIALIZATION_H
+#define TRITON_SYMBOLICSERIALIZATION_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ast.hpp"
+#include "symbolicExpression.hpp"
+#include "symbolicVariable.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! \module The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! \module The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! \module The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! The magic number of a serialized symbolic state.
+      const char SERIALIZED_MAGIC[8] = {'T', 'R', 'I', 'T', 'O', 'N', 'S', 'S'};
+
+      //! The version of the format of a serialized symbolic state.
+      const triton::uint32 SERIALIZED_VERSION = 4;
+
+      //! Written in the header to detect a file written with another byte order.
+      const triton::uint32 SERIALIZED_BYTE_ORDER = 0x01020304;
+
+      //! The flags of the serialized nodes and expressions.
+      enum serialized_flags_e {
+        SERIALIZED_INLINE_VALUE           = 1 << 0, //!< The value of a decimal or a bit-vector node is the value itself, not the index of a constant.
+        SERIALIZED_TAINTED                = 1 << 1, //!< The expression is tainted.
+        SERIALIZED_INLINE_MEMORY_VALUE    = 1 << 2, //!< The concrete value of the origin memory is the value itself, not the index of a constant.
+        SERIALIZED_INLINE_REGISTER_VALUE  = 1 << 3, //!< The concrete value of the origin register is the value itself, not the index of a constant.
+        SERIALIZED_ADDRESS                = 1 << 4, //!< The expression was created by an instruction, its address is defined.
+      };
+
+
+      //! A section of a serialized symbolic state: an array of records.
+      struct SerializedSection {
+        //! The offset of the first record from the start of the file. Always a multiple of 8.
+        triton::uint64 offset;
+
+        //! The number of records. For the strings, the number of bytes.
+        triton::uint64 count;
+      };
+
+
+      //! The header of a serialized symbolic state, at offset 0.
+      struct SerializedHeader {
+        //! SERIALIZED_MAGIC.
+        char magic[8];
+
+        //! SERIALIZED_VERSION.
+        triton::uint32 version;
+
+        //! SERIALIZED_BYTE_ORDER, as written by the host.
+        triton::uint32 byteOrder;
+
+        //! The architecture of the state. \sa triton::arch::architectures_e
+        triton::uint32 architecture;
+
+        //! The number of registers of the architecture.
+        triton::uint32 numberOfRegisters;
+
+        //! The next symbolic expression id.
+        triton::uint64 uniqueSymExprId;
+
+        //! The next symbolic variable id.
+        triton::uint64 uniqueSymVarId;
+
+        //! The AST nodes, SerializedNode records. A node comes after its childs.
+        SerializedSection nodes;
+
+        //! The childs of the nodes, triton::uint32 node indexes.
+        SerializedSection childs;
+
+        //! The big integers, SerializedConstant records.
+        SerializedSection constants;
+
+        //! The strings, NUL-terminated. A string is given by its offset in this section, 0 is the empty string.
+        SerializedSection strings;
+
+        //! The symbolic expressions, SerializedExpression records sorted by id.
+        SerializedSection expressions;
+
+        //! The symbolic variables, SerializedVariable records sorted by id.
+        SerializedSection variables;
+
+        //! The symbolic registers, SerializedReference records of register id -> expression id.
+        SerializedSection registers;
+
+        //! The symbolic memory, SerializedReference records of address -> expression id.
+        SerializedSection memory;
+      };
+
+
+      //! An AST node.
+      struct SerializedNode {
+        //! The kind of the node. \sa triton::ast::kind_e
+        triton::uint32 kind;
+
+        //! The size of the node in bits.
+        triton::uint32 size;
+
+        //! The number of childs.
+        triton::uint32 numberOfChilds;
+
+        //! SERIALIZED_INLINE_VALUE or 0.
+        triton::uint32 flags;
+
+        //! The index of the first child in the childs section.
+        triton::uint64 firstChild;
+
+        /*!
+         * \brief The payload of the leaves and of the nodes with parameters.
+         * \description The value of a decimal or a bit-vector if it fits in 64 bits, the index of its constant
+         * otherwise, the string of a string, the variable id of a variable, the expression id of a
+         * reference, `(high << 32) | low` for an extract and the extension size for sx and zx. 0
+         * otherwise.
+         */
+        triton::uint64 value;
+      };
+
+
+      //! A big integer, least significant word first.
+      struct SerializedConstant {
+        //! The 64-bits words of the value.
+        triton::uint64 words[8];
+      };
+
+
+      //! A symbolic expression.
+      struct SerializedExpression {
+        //! The id of the expression.
+        triton::uint64 id;
+
+        //! The index of the root node.
+        triton::uint64 root;
+
+        //! The address of the instruction which created the expression if SERIALIZED_ADDRESS is set, 0 otherwise.
+        triton::uint64 address;
+
+        //! The comment, a string.
+        triton::uint64 comment;
+
+        //! The address of the origin memory.
+        triton::uint64 originMemoryAddress;
+
+        //! The concrete value of the origin memory, inline if it fits in 64 bits, a constant otherwise. 0 without origin memory.
+        triton::uint64 originMemoryValue;
+
+        //! The concrete value of the origin register, inline if it fits in 64 bits, a constant otherwise. 0 without origin register.
+        triton::uint64 originRegisterValue;
+
+        //! The size of the origin memory in bytes.
+        triton::uint32 originMemorySize;
+
+        //! The id of the origin register.
+        triton::uint32 originRegister;
+
+        //! The kind of the expression. \sa triton::engines::symbolic::symkind_e
+        triton::uint32 kind;
+
+        //! SERIALIZED_TAINTED, SERIALIZED_ADDRESS, SERIALIZED_INLINE_MEMORY_VALUE and SERIALIZED_INLINE_REGISTER_VALUE.
+        triton::uint32 flags;
+      };
+
+
+      //! A symbolic variable.
+      struct SerializedVariable {
+        //! The id of the variable.
+        triton::uint64 id;
+
+        //! The kind value: the register id or the memory address.
+        triton::uint64 kindValue;
+
+        //! The comment, a string.
+        triton::uint64 comment;
+
+        //! The concrete value, a constant.
+        triton::uint64 concreteValue;
+
+        //! The kind of the variable. \sa triton::engines::symbolic::symkind_e
+        triton::uint32 kind;
+
+        //! The size of the variable in bits.
+        triton::uint32 size;
+      };
+
+
+      //! A register or memory reference.
+      struct SerializedReference {
+        //! The register id or the address.
+        triton::uint64 key;
+
+        //! The symbolic expression id.
+        triton::uint64 id;
+      };
+
+
+      //! \class SymbolicStateWriter
+      /*! \brief Builds the sections of a serialized symbolic state.
+       *
+       * \description
+       * The ASTs of the expressions are flattened into one table of unique nodes with an explicit
+       * stack, childs first, so the nodes shared by several expressions are written once. A
+       * reference is kept if its expression is written before the expression using it, otherwise
+       * the AST of its target is written in place. The values which fit in 64 bits are written in
+       * their record, the others once each in the constants.
+       */
+      class SymbolicStateWriter {
+        protected:
+          //! The header.
+          SerializedHeader header;
+
+          //! The nodes.
+          std::vector<SerializedNode> nodes;
+
+          //! The childs of the nodes.
+          std::vector<triton::uint32> childs;
+
+          //! The constants.
+          std::vector<SerializedConstant> constants;
+
+          //! The index of each constant written.
+          std::map<triton::uint512, triton::uint64> constantIndexes;
+
+          //! The strings.
+          std::string strings;
+
+          //! The expressions.
+          std::vector<SerializedExpression> expressions;
+
+          //! The variables.
+          std::vector<SerializedVariable> variables;
+
+          //! The register references.
+          std::vector<SerializedReference> registers;
+
+          //! The memory references.
+          std::vector<SerializedReference> memory;
+
+          //! The index of each node written. The references unrolled have the index of their target.
+          std::unordered_map<triton::ast::AbstractNode*, triton::uint32> indexes;
+
+          //! The ids of the expressions written so far.
+          std::unordered_set<triton::__uint> written;
+
+          //! Returns true if a reference is written as a reference rather than as its target.
+          bool isKeptReference(triton::ast::AbstractNode* node) const;
+
+          //! Appends a node whose childs are written.
+          void addNode(triton::ast::AbstractNode* node);
+
+        public:
+          //! Constructor.
+          SymbolicStateWriter(triton::uint32 architecture, triton::uint32 numberOfRegisters, triton::__uint uniqueSymExprId, triton::__uint uniqueSymVarId);
+
+          //! Destructor.
+          ~SymbolicStateWriter();
+
+          //! Returns the index of a constant. A value is written once.
+          triton::uint64 addConstant(const triton::uint512& value);
+
+          //! Returns a value to write in a record: the value itself if it fits in 64 bits, then `inlineFlag` is set in `flags`, the index of its constant otherwise.
+          triton::uint64 addValue(const triton::uint512& value, triton::uint32& flags, triton::uint32 inlineFlag);
+
+          //! Returns the offset of a string.
+          triton::uint64 addString(const std::string& value);
+
+          //! Writes an AST and returns the index of its root.
+          triton::uint32 addAst(triton::ast::AbstractNode* node);
+
+          //! Writes a symbolic expression with its AST. The expressions must be added by increasing id.
+          void addExpression(const SymbolicExpression& expr);
+
+          //! Writes a symbolic variable.
+          void addVariable(const SymbolicVariable& symVar);
+
+          //! Writes a register reference.
+          void addRegister(triton::uint32 regId, triton::__uint symExprId);
+
+          //! Writes a memory reference.
+          void addMemory(triton::__uint address, triton::__uint symExprId);
+
+          //! Writes the file.
+          void save(const std::string& filename);
+      };
+
+
+      //! \class SymbolicStateView
+      /*! \brief A read-only view over a serialized symbolic state.
+       *
+       * \description
+       * The file is mapped in memory when the system allows it, read otherwise. The records are
+       * used in place: checking the file only reads the header and the node table once, a node is
+       * then a pointer into the mapping and no node is decoded until it is rebuilt. The kind and
+       * the number of childs of each node are checked against each other.
+       */
+      class SymbolicStateView {
+        protected:
+          //! The start of the file.
+          const triton::uint8* data;
+
+          //! The size of the file.
+          std::size_t size;
+
+          //! True if `data` is mapped, false if it is allocated.
+          bool mapped;
+
+          //! Returns the records of a section. Throws if the section is out of the file.
+          const void* getSection(const SerializedSection& section, std::size_t recordSize) const;
+
+          //! Checks the header and the records: the offsets, the arities and the ids against the next ids of the header.
+          void check(void) const;
+
+          //! Unmaps or frees the file.
+          void release(void);
+
+        public:
+          //! Constructor. Maps the file and checks it, throws if it is not a valid symbolic state.
+          SymbolicStateView(const std::string& filename);
+
+          //! Destructor. Unmaps the file.
+          ~SymbolicStateView();
+
+          //! Returns the header.
+          const SerializedHeader& getHeader(void) const;
+
+          //! Returns the nodes.
+          const SerializedNode* getNodes(void) const;
+
+          //! Returns the childs of the nodes.
+          const triton::uint32* getChilds(void) const;
+
+          //! Returns a constant.
+          triton::uint512 getConstant(triton::uint64 index) const;
+
+          //! Returns a value written by SymbolicStateWriter::addValue(): `value` itself if `isInline`, its constant otherwise.
+          triton::uint512 getValue(triton::uint64 value, bool isInline) const;
+
+          //! Returns a string.
+          std::string getString(triton::uint64 offset) const;
+
+          //! Returns the expressions.
+          const SerializedExpression* getExpressions(void) const;
+
+          //! Returns the variables.
+          const SerializedVariable* getVariables(void) const;
+
+          //! Returns the register references.
+          const SerializedReference* getRegisters(void) const;
+
+          //! Returns the memory references.
+          const SerializedReference* getMemory(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICSERIALIZATION_H */
@@ -9,8 +9,10 @@
 #define TRITON_SYMBOLICSIMPLIFICATION_H
 
 #include <list>
+#include <string>
 
 #include "ast.hpp"
+#include "astRewriter.hpp"
 #include "tritonTypes.hpp"
 
 #ifdef TRITON_PYTHON_BINDINGS
@@ -55,6 +57,9 @@ namespace triton {
           //! List of simplification callbacks. These callbacks will be called before assigning a symbolic expression to a register or part of memory.
           std::list<triton::engines::symbolic::sfp> simplificationCallbacks;
 
+          //! The rewrite engine applied when the `AST_REWRITING` optimization is enabled.
+          triton::ast::AstRewriter rewriter;
+
           #ifdef TRITON_PYTHON_BINDINGS
           //! List of simplification callbacks python. These callbacks will be called before assigning a symbolic expression to a register or part of memory.
           std::list<PyObject*> pySimplificationCallbacks;
@@ -89,6 +94,12 @@ namespace triton {
           void removeSimplificationCallback(PyObject* cb);
           #endif
 
+          //! Records a rewrite rule. The rule is applied after the default rules.
+          void recordRewriteRule(const std::string& pattern, const std::string& replacement);
+
+          //! Rewrites an AST with the rules of the rewriter. Returns the rewritten node.
+          triton::ast::AbstractNode* rewriteAst(triton::ast::AbstractNode* node) const;
+
           //! Processes all recorded simplifications. Returns the simplified node.
           triton::ast::AbstractNode* processSimplification(triton::ast::AbstractNode* node, bool z3=false) const;
       };
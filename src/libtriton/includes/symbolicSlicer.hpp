@@ -0,0 +1,118 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the LGPLv3 License.
+*/
+
+#ifndef TRITON_SYMBOLICSLICER_H
+#define TRITON_SYMBOLICSLICER_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "ast.hpp"
+#include "symbolicExpression.hpp"
+#include "symbolicIdTable.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! \module The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! \module The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! \module The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! The backward slice of a value: what contributes to it. Each list is sorted and without duplicates.
+      struct SymbolicSlice {
+        //! The ids of the symbolic expressions.
+        std::vector<triton::__uint> expressions;
+
+        //! The addresses of the instructions which created the expressions. The expressions created by no instruction have no address.
+        std::vector<triton::__uint> addresses;
+
+        //! The ids of the symbolic variables.
+        std::vector<triton::__uint> variables;
+      };
+
+
+      //! The expressions and the variables an AST refers to directly.
+      struct SymbolicDependencies {
+        //! The ids of the symbolic expressions referenced.
+        std::vector<triton::__uint> expressions;
+
+        //! The ids of the symbolic variables.
+        std::vector<triton::__uint> variables;
+      };
+
+
+      //! \class SymbolicSlicer
+      /*! \brief Computes the backward slices over the graph of the symbolic expressions.
+       *
+       * \description
+       * The AST of an expression is walked once, up to its references, and its direct
+       * dependencies are kept. A slice is then a walk over the expressions only, where an
+       * expression is met once thanks to a stamp by id. The dependencies are shared by the
+       * slices of a same slicer, so slicing all the path constraints of a trace walks each
+       * AST once. The expressions must not change while the slicer is used.
+       */
+      class SymbolicSlicer {
+        protected:
+          //! The symbolic expressions by id.
+          const IdTable<SymbolicExpression*>& symbolicExpressions;
+
+          //! The direct dependencies of the expressions already walked.
+          std::unordered_map<triton::__uint, SymbolicDependencies> dependencies;
+
+          //! The number of the last slice which reached each expression id.
+          std::vector<triton::uint32> stamps;
+
+          //! The number of the current slice.
+          triton::uint32 stamp;
+
+          //! Walks an AST up to its references and returns its direct dependencies.
+          static void walk(triton::ast::AbstractNode* node, SymbolicDependencies& deps);
+
+          //! Returns the direct dependencies of an expression, walking its AST the first time.
+          const SymbolicDependencies& getDependencies(const SymbolicExpression* expr);
+
+          //! Adds the expressions reachable from `deps` to the slice.
+          void expand(const SymbolicDependencies& deps, SymbolicSlice& slice);
+
+        public:
+          //! Constructor. `maxId` is the number of expression ids given so far.
+          SymbolicSlicer(const IdTable<SymbolicExpression*>& symbolicExpressions, triton::__uint maxId);
+
+          //! Returns the slice of a symbolic expression, the expression included.
+          SymbolicSlice slice(triton::__uint symExprId);
+
+          //! Returns the slice of an AST.
+          SymbolicSlice slice(triton::ast::AbstractNode* node);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICSLICER_H */
@@ -11,6 +11,7 @@
 #include <string>
 
 #include "symbolicEnums.hpp"
+#include "symbolicIdTable.hpp"
 #include "tritonTypes.hpp"
 
 
@@ -40,7 +41,7 @@ namespace triton {
 
       /*! \class SymbolicVariable
           \brief The symbolic variable class. */
-      class SymbolicVariable {
+      class SymbolicVariable : public IdTableEntry {
 
         protected:
 
@@ -8,6 +8,10 @@
 #ifndef TRITON_TRITONTOZ3AST_H
 #define TRITON_TRITONTOZ3AST_H
 
+#include <map>
+#include <string>
+#include <unordered_map>
+
 #include <z3++.h>
 
 #include "ast.hpp"
@@ -43,6 +47,12 @@ namespace triton {
         //! The map of symbols. E.g: (let (symbols expr1) expr2)
         std::map<std::string, triton::ast::AbstractNode*> symbols;
 
+        //! The nodes already converted during the current conversion.
+        std::unordered_map<triton::ast::AbstractNode*, z3::expr> exprs;
+
+        //! True while a conversion is running.
+        bool converting;
+
       protected:
         //! The result.
         Z3Result result;
@@ -8,6 +8,8 @@
 #ifndef TRITON_Z3TOTRITONAST_H
 #define TRITON_Z3TOTRITONAST_H
 
+#include <unordered_map>
+
 #include <z3++.h>
 #include "ast.hpp"
 #include "tritonTypes.hpp"
@@ -39,6 +41,9 @@ namespace triton {
         //! The Z3's expression which must be converted to a Triton's expression.
         z3::expr expr;
 
+        //! The Z3's nodes already converted during the current conversion, keyed by their Z3's id.
+        std::unordered_map<triton::uint32, triton::ast::AbstractNode*> nodes;
+
 
       private:
         //! Vists and converts
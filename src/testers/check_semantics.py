@@ -3,7 +3,9 @@ from triton  import *
 from ast import *
 from pintool import *
 
+import os
 import sys
+import tempfile
 import time
 
 BLUE  = "\033[94m"
@@ -102,11 +104,30 @@ def cafter(instruction):
     return
 
 
+def fini():
+    # Round trip of the symbolic state left by the test suite
+    exprs    = dict((i, str(getFullAst(e.getAst()))) for i, e in getSymbolicExpressions().items())
+    filename = tempfile.mktemp()
+
+    saveSymbolicState(filename)
+    resetEngines()
+    loadSymbolicState(filename)
+    os.remove(filename)
+
+    bad = [i for i, e in getSymbolicExpressions().items() if exprs.get(i) != str(getFullAst(e.getAst()))]
+    if bad or len(exprs) != len(getSymbolicExpressions()):
+        print "[%sKO%s] serialization (%s%d expression error(s)%s)" %(RED, ENDC, RED, len(bad), ENDC)
+    else:
+        print "[%sOK%s] serialization (%d expressions)" %(GREEN, ENDC, len(exprs))
+    return
+
+
 if __name__ == '__main__':
     setArchitecture(ARCH.X86_64)
     startAnalysisFromEntry()
     #startAnalysisFromSymbol('check')
     addCallback(cafter,  CALLBACK.AFTER)
     addCallback(sbefore, CALLBACK.BEFORE_SYMPROC)
+    addCallback(fini,    CALLBACK.FINI)
     runProgram()
 
@@ -1,7 +1,10 @@
 #!/usr/bin/env python2
 ## -*- coding: utf-8 -*-
 
+import os
+import struct
 import sys
+import tempfile
 
 from triton import *
 from ast    import *
@@ -688,6 +691,36 @@ def test_1():
         bvsrem(zx(32, bv(2147483648, 32)), sx(32, bv(4294967295, 32))),
         bvsrem(zx(64, bv(18446744073709318393, 64)), sx(64, bv(18446744073709551571, 64))),
         bvsrem(zx(64, bv(9223372036854775808, 64)), sx(64, bv(18446744073709551615, 64))),
+
+        bvsdiv(bv(0x8000000000000000, 64), bv(0xffffffffffffffff, 64)),
+        bvsrem(bv(0x8000000000000000, 64), bv(0xffffffffffffffff, 64)),
+        bvsmod(bv(0x8000000000000000, 64), bv(0xffffffffffffffff, 64)),
+        bvsmod(bv(0x8000000000000001, 64), bv(0x8000000000000000, 64)),
+        bvashr(bv(0x8000000000000000, 64), bv(63, 64)),
+        bvashr(bv(0x8000000000000000, 64), bv(64, 64)),
+        bvshl(bv(0x1, 64), bv(64, 64)),
+        bvlshr(bv(0x8000000000000000, 64), bv(64, 64)),
+        bvsgt(bv(0x7fffffffffffffff, 64), bv(0x8000000000000000, 64)),
+        bvslt(bv(0x80, 8), bv(0x7f, 8)),
+
+        bvadd(bv(0xffffffffffffffffffffffffffffffff, 128), bv(1, 128)),
+        bvsub(bv(0, 128), bv(1, 128)),
+        bvmul(bv(0xffffffffffffffff, 128), bv(0xffffffffffffffff, 128)),
+        bvshl(bv(0x1, 128), bv(100, 128)),
+        bvlshr(bv(0x80000000000000000000000000000000, 128), bv(127, 128)),
+        bvashr(bv(0x80000000000000000000000000000000, 128), bv(100, 128)),
+        bvsdiv(bv(0x80000000000000000000000000000000, 128), bv(3, 128)),
+        bvudiv(bv(0xffffffffffffffffffffffffffffffff, 128), bv(0x10000000000000000, 128)),
+        bvurem(bv(0xffffffffffffffffffffffffffffffff, 128), bv(0, 128)),
+        bvrol(3, bv(0x12345678123456781234567812345678, 128)),
+        bvror(3, bv(0x12345678123456781234567812345678, 128)),
+        extract(95, 32, bv(0x12345678123456781234567812345678, 128)),
+        concat([bv(0x1234567812345678, 64), bv(0x8765432187654321, 64)]),
+        sx(64, bv(0x8765432187654321, 64)),
+        zx(192, bv(0x8765432187654321, 64)),
+        bvadd(bv(0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff, 256), bv(1, 256)),
+        bvnot(bv(0x1234567812345678123456781234567812345678123456781234567812345678, 256)),
+        bvult(bv(0x1234567812345678123456781234567812345678, 256), bv(0x1234567812345678123456781234567812345679, 256)),
     ]
     count = 0
     for test in tests:
@@ -1539,6 +1572,1194 @@ def test_6():
     return count
 
 
+def test_7():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    a = bvadd(bv(1, 8), bv(2, 8))
+    b = bvmul(a, bv(3, 8))
+    c = bvxor(b, a)
+    if b.evaluate() != 9 or c.evaluate() != 10:
+        print '[KO] %s' %(c)
+        return -1
+    count += 1
+
+    # Replacing a leaf must update every ancestor on their next read
+    a.setChild(0, bv(10, 8))
+    if a.evaluate() != 12 or b.evaluate() != 36 or c.evaluate() != 40:
+        print '[KO] %s' %(c)
+        print '\tOutput   : %d' %(c.evaluate())
+        print '\tExpected : 40'
+        return -1
+    count += 1
+
+    return count
+
+
+def test_8():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    x = bv(0, 8)
+    y = bv(1, 8)
+    tests = [
+        (bvadd(x, y).getHash() == bvadd(y, x).getHash(),               True),
+        (bvsub(x, y).getHash() == bvsub(y, x).getHash(),               False),
+        (bvmul(x, bv(2, 8)).getHash() == bvmul(x, bv(3, 8)).getHash(), False),
+        (bvadd(x, y).getHash() == bvor(x, y).getHash(),                False),
+        (bv(1, 8).getHash() == bv(1, 16).getHash(),                    False),
+        (compound([x, y]).getHash() == compound([y, x]).getHash(),     False),
+    ]
+
+    for hit, expected in tests:
+        if hit != expected:
+            print '[KO] Hash comparison #%d' %(count)
+            return -1
+        count += 1
+
+    # The cached hash must follow the changes of the tree
+    a = bvsub(x, y)
+    h = a.getHash()
+    a.setChild(1, bv(2, 8))
+    if a.getHash() == h or a.getHash() != bvsub(bv(0, 8), bv(2, 8)).getHash():
+        print '[KO] %s' %(a)
+        return -1
+    count += 1
+
+    return count
+
+
+def test_9():
+    setArchitecture(ARCH.X86_64)
+    enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, True)
+    count = 0
+
+    a = bvadd(bv(1, 8), extract(7, 0, bv(2, 16)))
+    before = getAstDictionariesStats()
+    b = bvadd(bv(1, 8), extract(7, 0, bv(2, 16)))
+    after = getAstDictionariesStats()
+
+    # The second tree must not allocate a single node
+    if after['allocatedNodes'] != before['allocatedNodes'] or after['hits'] <= before['hits']:
+        print '[KO] %s' %(b)
+        print '\tBefore : %s' %(before)
+        print '\tAfter  : %s' %(after)
+        enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, False)
+        return -1
+    count += 1
+
+    if a.evaluate() != 3 or b.evaluate() != 3 or after['loadFactor'] > 70:
+        print '[KO] %s' %(b)
+        enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, False)
+        return -1
+    count += 1
+
+    enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, False)
+    return count
+
+
+def test_10():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    x = bv(0xf0, 8)
+    tests = [
+        (extract(7, 4, x),   '((_ extract 7 4) (_ bv240 8))',   0xf,   1),
+        (sx(8, x),           '((_ sign_extend 8) (_ bv240 8))', 0xfff0, 1),
+        (zx(8, x),           '((_ zero_extend 8) (_ bv240 8))', 0xf0,  1),
+        (bvadd(x, x),        '(bvadd (_ bv240 8) (_ bv240 8))', 0xe0,  2),
+        (x,                  '(_ bv240 8)',                     0xf0,  0),
+    ]
+
+    # The integer parameters are stored inline, not as decimal childs
+    for node, smt, value, childs in tests:
+        if str(node) != smt or node.evaluate() != value or len(node.getChilds()) != childs:
+            print '[KO] %s' %(node)
+            print '\tOutput   : %s = %#x (%d childs)' %(str(node), node.evaluate(), len(node.getChilds()))
+            print '\tExpected : %s = %#x (%d childs)' %(smt, value, childs)
+            return -1
+        count += 1
+
+    # A bit-vector keeps its value inline
+    if x.getValue() != 0xf0 or x.getBitvectorSize() != 8:
+        print '[KO] %s' %(x)
+        return -1
+    count += 1
+
+    # A node using the same child twice is listed once
+    if len(x.getParents()) != 4:
+        print '[KO] %s' %(x)
+        return -1
+    count += 1
+
+    return count
+
+
+def test_11():
+    setArchitecture(ARCH.X86_64)
+    enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, True)
+    count = 0
+
+    # A tree owned by nothing but a Python object is freed with the object
+    before = getAstDictionariesStats()['allocatedNodes']
+    a = bvadd(bv(0x11, 8), bv(0x22, 8))
+    if getAstDictionariesStats()['allocatedNodes'] <= before:
+        print '[KO] %s' %(a)
+        enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, False)
+        return -1
+    count += 1
+
+    del a
+    if getAstDictionariesStats()['allocatedNodes'] > before:
+        print '[KO] bvadd not freed: %d nodes instead of %d' %(getAstDictionariesStats()['allocatedNodes'], before)
+        enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, False)
+        return -1
+    count += 1
+
+    # A tree owned by a symbolic expression survives the Python object
+    expr = newSymbolicExpression(bvadd(bv(0x33, 8), bv(0x44, 8)))
+    if expr.getAst().evaluate() != 0x77 or str(expr.getAst()) != '(bvadd (_ bv51 8) (_ bv68 8))':
+        print '[KO] %s' %(expr)
+        enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, False)
+        return -1
+    count += 1
+
+    enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, False)
+    return count
+
+
+def test_12():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    e1 = newSymbolicExpression(bv(1, 8))
+    e2 = newSymbolicExpression(bvadd(reference(e1.getId()), bv(2, 8)))
+    e3 = newSymbolicExpression(bvmul(reference(e2.getId()), reference(e2.getId())))
+    partial = str(e3.getAst())
+
+    # The full AST can be asked several times, the partial AST is kept
+    for i in range(2):
+        full = getFullAstFromId(e3.getId())
+        if str(full) != '(bvmul (bvadd (_ bv1 8) (_ bv2 8)) (bvadd (_ bv1 8) (_ bv2 8)))' or full.evaluate() != 9:
+            print '[KO] %s' %(full)
+            return -1
+        if str(e3.getAst()) != partial or str(e2.getAst()).find('ref!') < 0:
+            print '[KO] %s' %(e3.getAst())
+            return -1
+        count += 1
+
+    # Both references are unrolled into the same tree
+    childs = full.getChilds()
+    if childs[0].getHash() != childs[1].getHash():
+        print '[KO] %s' %(full)
+        return -1
+    count += 1
+
+    return count
+
+
+def test_13():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+    depth = 100000
+
+    # A chain of expressions deeper than what a recursive walk can handle
+    expr = newSymbolicExpression(bv(0, 8))
+    for i in range(depth):
+        expr = newSymbolicExpression(bvadd(reference(expr.getId()), bv(1, 8)))
+
+    full = getFullAstFromId(expr.getId())
+    if full.evaluate() != depth % 256:
+        print '[KO] %d' %(full.evaluate())
+        return -1
+    count += 1
+
+    text = str(full)
+    if not text.startswith('(bvadd (bvadd') or text.count('bvadd') != depth:
+        print '[KO] %s...' %(text[:64])
+        return -1
+    count += 1
+
+    if full.getHash() == full.getChilds()[0].getHash():
+        print '[KO] %s...' %(text[:64])
+        return -1
+    count += 1
+
+    return count
+
+
+def test_14():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    x  = newSymbolicVariable(8)
+    y  = newSymbolicVariable(8)
+    w  = newSymbolicVariable(128)
+    vx = variable(x)
+    vy = variable(y)
+    vw = variable(w)
+
+    tests = [
+        (concat([bvadd(vx, vy), bvxor(vx, bv(0xff, 8))]), lambda a, b: (((a + b) & 0xff) << 8) | (a ^ 0xff)),
+        (ite(bvult(vx, vy), vx, vy),                       lambda a, b: min(a, b)),
+        (sx(8, bvsub(vx, vy)),                             lambda a, b: ((a - b) & 0xff) | (0xff00 if (a - b) & 0x80 else 0)),
+        (extract(71, 8, bvmul(vw, zx(120, vx))),           lambda a, b: ((((1 << 100) + b) * a) >> 8) & 0xffffffffffffffff),
+    ]
+
+    models = [{x.getId(): a, y.getId(): b, w.getId(): (1 << 100) + b} for a in (0, 1, 0x7f, 0x80, 0xff) for b in (0, 3, 0xfe)]
+
+    for node, expected in tests:
+        before  = node.evaluate()
+        results = evaluateAstForModels(node, models)
+        for model, result in zip(models, results):
+            if result != expected(model[x.getId()], model[y.getId()]):
+                print '[KO] %s' %(node)
+                print '\tOutput   : %d' %(result)
+                print '\tExpected : %d' %(expected(model[x.getId()], model[y.getId()]))
+                return -1
+            count += 1
+        # The AST itself is not modified and an empty model uses the concrete values
+        if node.evaluate() != before or evaluateAstForModels(node, [{}]) != [before]:
+            print '[KO] %s' %(node)
+            return -1
+        count += 1
+
+    return count
+
+
+def test_15():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    x  = newSymbolicVariable(8)
+    y  = newSymbolicVariable(32)
+    vx = variable(x)
+    vy = variable(y)
+
+    def sdiv(a, b):
+        a = a - (1 << 32) if a & 0x80000000 else a
+        b = b - (1 << 32) if b & 0x80000000 else b
+        if b == 0:
+            return 1 if a < 0 else 0xffffffff
+        q = abs(a) / abs(b)
+        return (q if (a < 0) == (b < 0) else -q) & 0xffffffff
+
+    tests = [
+        (land(bvugt(zx(24, vx), bvand(vy, bv(0xff, 32))), equal(extract(3, 0, vx), bv(5, 4))),
+            lambda a, b: int(a > (b & 0xff) and (a & 0xf) == 5)),
+        (bvashr(vy, zx(24, extract(4, 0, vx))),
+            lambda a, b: ((b - (1 << 32) if b & 0x80000000 else b) >> (a & 0x1f)) & 0xffffffff),
+        (bvrol(vy, 7),
+            lambda a, b: ((b << 7) | (b >> 25)) & 0xffffffff),
+        (bvsdiv(vy, sx(24, vx)),
+            lambda a, b: sdiv(b, a | (0xffffff00 if a & 0x80 else 0))),
+    ]
+
+    # More models than lanes, the last batch is not full
+    seed   = 1
+    models = []
+    for i in range(1000):
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff
+        models.append({x.getId(): seed & 0xff, y.getId(): (seed * 0x9e3779b1) & 0xffffffff})
+
+    for node, expected in tests:
+        results = evaluateAstForModels(node, models)
+        if len(results) != len(models):
+            print '[KO] %s' %(node)
+            return -1
+        for model, result in zip(models, results):
+            if result != expected(model[x.getId()], model[y.getId()]):
+                print '[KO] %s' %(node)
+                print '\tOutput   : %d' %(result)
+                print '\tExpected : %d' %(expected(model[x.getId()], model[y.getId()]))
+                return -1
+        count += 1
+
+    return count
+
+
+def test_16():
+    setArchitecture(ARCH.X86_64)
+    enableSymbolicOptimization(OPTIMIZATION.CONSTANT_FOLDING, True)
+    count = 0
+
+    x = variable(newSymbolicVariable(8))
+
+    # Constant operands are folded into a bit-vector
+    tests = [
+        (bvadd(bv(0xff, 8), bv(2, 8)),             1,      8),
+        (concat([bv(1, 8), bv(2, 8)]),             0x0102, 16),
+        (extract(11, 4, bv(0x1234, 16)),           0x23,   8),
+        (sx(8, bv(0x80, 8)),                       0xff80, 16),
+        (bvror(4, bv(0x12, 8)),                    0x21,   8),
+    ]
+    for node, value, size in tests:
+        if node.getKind() != AST_NODE.BV or node.evaluate() != value or node.getBitvectorSize() != size:
+            print '[KO] %s' %(node)
+            return -1
+        count += 1
+
+    # Trivial identities return an operand
+    tests = [
+        (bvadd(x, bv(0, 8)),                       x),
+        (bvor(bv(0, 8), x),                        x),
+        (bvand(x, bv(0xff, 8)),                    x),
+        (extract(7, 0, x),                         x),
+        (zx(0, x),                                 x),
+        (ite(bvtrue(), x, bv(1, 8)),               x),
+        (ite(equal(bv(1, 8), bv(2, 8)), bv(1, 8), x), x),
+        (bvxor(x, x),                              bv(0, 8)),
+        (bvmul(x, bv(0, 8)),                       bv(0, 8)),
+    ]
+    for node, expected in tests:
+        if str(node) != str(expected):
+            print '[KO] %s' %(node)
+            print '\tExpected : %s' %(expected)
+            return -1
+        count += 1
+
+    # Operations on symbolic operands are still built
+    if bvadd(x, bv(1, 8)).getKind() != AST_NODE.BVADD:
+        print '[KO] %s' %(bvadd(x, bv(1, 8)))
+        return -1
+    count += 1
+
+    # A fully concrete instruction does not build any operation node for its destination
+    inst = Instruction()
+    inst.setOpcodes("\x48\x01\xd8") # add rax, rbx
+    inst.updateContext(Register(REG.RAX, 0x1122334455667788))
+    inst.updateContext(Register(REG.RBX, 0x8877665544332211))
+    processing(inst)
+    expr = inst.getSymbolicExpressions()[0]
+    if expr.getAst().getKind() != AST_NODE.BV or expr.getAst().evaluate() != 0x9999999999999999:
+        print '[KO] %s' %(expr)
+        return -1
+    count += 1
+
+    return count
+
+
+
+def test_17():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    a = variable(newSymbolicVariable(8))
+    b = variable(newSymbolicVariable(8))
+    c = variable(newSymbolicVariable(32))
+
+    # The default rules
+    tests = [
+        (a ^ a,                                                     bv(0, 8)),
+        ((a ^ b) ^ a,                                               b),
+        (~~a,                                                       a),
+        ((a + b) - b,                                               a),
+        (a - (-b),                                                  a + b),
+        (a | bv(0xff, 8),                                           bv(0xff, 8)),
+        (a + (b - b),                                               a),
+        (bvadd(bv(1, 8), bv(2, 8)),                                 bv(3, 8)),
+        (ite(lnot(equal(a, b)), a, b),                              ite(equal(a, b), b, a)),
+        (equal(ite(bvult(a, b), bv(1, 1), bv(0, 1)), bv(1, 1)),     bvult(a, b)),
+        (equal(ite(bvult(a, b), bv(1, 1), bv(0, 1)), bv(0, 1)),     lnot(bvult(a, b))),
+        (extract(7, 0, extract(15, 8, c)),                          extract(15, 8, c)),
+        (extract(15, 8, concat([a, b, a, b])),                      a),
+        (extract(7, 0, zx(24, a)),                                  a),
+        (concat([extract(31, 16, c), extract(15, 0, c)]),           c),
+        (concat([bv(0, 24), a]),                                    zx(24, a)),
+    ]
+    for node, expected in tests:
+        if str(rewriteAst(node)) != str(expected):
+            print '[KO] %s' %(node)
+            print '\tOutput   : %s' %(rewriteAst(node))
+            print '\tExpected : %s' %(expected)
+            return -1
+        count += 1
+
+    # A recorded rule
+    node = a & (a | b)
+    if str(rewriteAst(node)) != str(node):
+        print '[KO] %s' %(node)
+        return -1
+    recordRewriteRule("(bvand x (bvor x y))", "x")
+    if str(rewriteAst(node)) != str(a):
+        print '[KO] %s' %(node)
+        return -1
+    count += 1
+
+    # The optimization rewrites the new expressions
+    enableSymbolicOptimization(OPTIMIZATION.AST_REWRITING, True)
+    convertRegisterToSymbolicVariable(REG.RAX)
+    inst = Instruction()
+    inst.setOpcodes("\x48\x31\xc0") # xor rax, rax
+    processing(inst)
+    expr = inst.getSymbolicExpressions()[0]
+    if expr.getAst().getKind() != AST_NODE.BV or expr.getAst().evaluate() != 0:
+        print '[KO] %s' %(expr)
+        return -1
+    count += 1
+
+    return count
+
+
+def test_18():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    setLastRegisterValue(Register(REG.RAX, 0x1122334455667788))
+    setLastRegisterValue(Register(REG.RSP, 0x1000))
+    convertRegisterToSymbolicVariable(REG.RAX)
+
+    inst = Instruction()
+    inst.setOpcodes("\x48\x89\x04\x24") # mov qword ptr [rsp], rax
+    processing(inst)
+    store = inst.getSymbolicExpressions()[-1].getId()
+
+    # The bytes of the same store are read back as one node over a reference to the store
+    tests = [
+        ("\x48\x8b\x1c\x24", 0x1122334455667788, AST_NODE.REFERENCE, 0), # mov rbx, qword ptr [rsp]
+        ("\x8b\x4c\x24\x02", 0x33445566,         AST_NODE.EXTRACT,   1), # mov ecx, dword ptr [rsp+2]
+        ("\x8b\x54\x24\x06", 0x1122,             AST_NODE.CONCAT,    2), # mov edx, dword ptr [rsp+6]
+    ]
+    for opcodes, value, kind, childs in tests:
+        inst = Instruction()
+        inst.setOpcodes(opcodes)
+        processing(inst)
+        node = inst.getLoadAccess()[0][1]
+        if node.evaluate() != value or node.getKind() != kind or len(node.getChilds()) != childs:
+            print '[KO] %s' %(node)
+            return -1
+        ref = node
+        while ref.getKind() != AST_NODE.REFERENCE:
+            ref = ref.getChilds()[0]
+        if ref.getValue() != store:
+            print '[KO] %s' %(node)
+            return -1
+        count += 1
+
+    return count
+
+
+def test_19():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    vx = variable(newSymbolicVariable(8))
+    vy = variable(newSymbolicVariable(8))
+
+    # A shared sub-tree is counted once as unique node and twice in the tree
+    a = bvmul(vx, vy)
+    stats = getAstStats(bvadd(a, a))
+    expected = {'uniqueNodes': 4, 'treeNodes': 7, 'depth': 3, 'variables': 2}
+    for key, value in expected.items():
+        if stats[key] != value:
+            print '[KO] %s: %d' %(key, stats[key])
+            return -1
+        count += 1
+
+    if stats['kinds'] != {'bvadd': 1, 'bvmul': 1, 'variable': 2} or stats['bytes'] <= 0:
+        print '[KO] %s' %(stats)
+        return -1
+    count += 1
+
+    # The tree sizes grow along a chain of references without walking it again
+    expr = newSymbolicExpression(bvadd(vx, vy))
+    for i in range(10):
+        expr = newSymbolicExpression(bvadd(reference(expr.getId()), vx))
+
+    largest = getLargestSymbolicExpressions(3)
+    if [e.getTreeSize() for e in largest] != [23, 21, 19] or largest[0].getId() != expr.getId():
+        print '[KO] %s' %([e.getTreeSize() for e in largest])
+        return -1
+    count += 1
+
+    # The largest expressions are then updated when an expression is created
+    expr = newSymbolicExpression(bvadd(reference(expr.getId()), vx))
+    largest = getLargestSymbolicExpressions(3)
+    if [e.getTreeSize() for e in largest] != [25, 23, 21] or largest[0].getId() != expr.getId():
+        print '[KO] %s' %([e.getTreeSize() for e in largest])
+        return -1
+    count += 1
+
+    stats = getAstStats(reference(expr.getId()))
+    if stats['treeNodes'] != 25 or stats['depth'] != 13 or stats['kinds']['reference'] != 12:
+        print '[KO] %s' %(stats)
+        return -1
+    count += 1
+
+    # Replacing an AST changes the size of the expressions which refer to it, even outside the heap
+    small = newSymbolicExpression(vx)
+    outer = newSymbolicExpression(bvadd(reference(small.getId()), vx))
+    if getLargestSymbolicExpressions(1)[0].getId() != expr.getId() or outer.getTreeSize() != 3:
+        print '[KO] %d' %(outer.getTreeSize())
+        return -1
+    count += 1
+
+    tree = vx
+    for i in range(20):
+        tree = bvadd(tree, vy)
+    small.setAst(tree)
+    largest = getLargestSymbolicExpressions(3)
+    if [e.getTreeSize() for e in largest] != [43, 41, 25] or [e.getId() for e in largest] != [outer.getId(), small.getId(), expr.getId()]:
+        print '[KO] %s' %([e.getTreeSize() for e in largest])
+        return -1
+    count += 1
+
+    stats = getAstStats()
+    if stats['treeNodes'] != sum([e.getTreeSize() for e in getSymbolicExpressions().values()]):
+        print '[KO] %s' %(stats)
+        return -1
+    count += 1
+
+    # The expressions know the instruction which created them
+    setLastRegisterValue(Register(REG.RBX, 0x1234))
+    convertRegisterToSymbolicVariable(REG.RBX)
+    inst = Instruction()
+    inst.setOpcodes("\x48\x89\xd8") # mov rax, rbx
+    inst.setAddress(0x40000)
+    processing(inst)
+    if inst.getSymbolicExpressions()[0].getAddress() != 0x40000:
+        print '[KO] %x' %(inst.getSymbolicExpressions()[0].getAddress())
+        return -1
+    count += 1
+
+    return count
+
+
+def test_20():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    vx = variable(newSymbolicVariable(8))
+    vy = variable(newSymbolicVariable(8))
+
+    setAstRepresentationMode(AST_REPRESENTATION.SMT_DAG)
+
+    a = bvadd(vx, vy)
+    if str(bvmul(a, a)) != '(let ((dag!0 (bvadd SymVar_0 SymVar_1))) (bvmul dag!0 dag!0))':
+        print '[KO] %s' %(bvmul(a, a))
+        return -1
+    count += 1
+
+    # The expanded tree has 2^40 leaves, the text stays linear
+    node = vx
+    for i in range(40):
+        node = bvadd(node, node)
+
+    text = str(node)
+    if text.count('(let ') != 39 or len(text) > 4096:
+        print '[KO] %s...' %(text[:64])
+        return -1
+    count += 1
+
+    query = assert_(equal(node, bv(0, 8)))
+    text = str(query)
+    if text.count('(define-fun ') != 39 or not text.endswith('(assert (= (bvadd dag!38 dag!38) (_ bv0 8)))'):
+        print '[KO] %s...' %(text[-64:])
+        return -1
+    count += 1
+
+    setAstRepresentationMode(AST_REPRESENTATION.SMT)
+
+    # The solver parses the shared form
+    if len(getModel(query)) != 1:
+        print '[KO] %s' %(getModel(query))
+        return -1
+    count += 1
+
+    return count
+
+
+def test_21():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    setLastRegisterValue(Register(REG.RAX, 0x1122334455667788))
+    setLastRegisterValue(Register(REG.RSP, 0x1000))
+    convertRegisterToSymbolicVariable(REG.RAX)
+    convertRegisterToSymbolicVariable(REG.RBX)
+
+    for opcodes in ["\x48\x01\xd8",     # add rax, rbx
+                    "\x48\x89\x04\x24", # mov qword ptr [rsp], rax
+                    "\x48\x8b\x0c\x24", # mov rcx, qword ptr [rsp]
+                    "\x48\x31\xc8",     # xor rax, rcx
+                    "\x48\xc1\xe1\x05"]: # shl rcx, 5
+        inst = Instruction()
+        inst.setOpcodes(opcodes)
+        processing(inst)
+
+    def state():
+        exprs = dict((i, (str(e.getAst()), e.getAst().evaluate(), e.getComment())) for i, e in getSymbolicExpressions().items())
+        regs  = dict((r.getName(), e.getId()) for r, e in getSymbolicRegisters().items())
+        mem   = dict((a, e.getId()) for a, e in getSymbolicMemory().items())
+        return exprs, regs, mem, len(getSymbolicVariables())
+
+    filename = tempfile.mktemp()
+    before = state()
+    saveSymbolicState(filename)
+
+    resetEngines()
+    if len(getSymbolicExpressions()) != 0:
+        print '[KO] resetEngines()'
+        return -1
+    count += 1
+
+    loadSymbolicState(filename)
+    after = state()
+    if before != after:
+        print '[KO] %s' %(str(after))
+        return -1
+    count += 1
+
+    # The ids continue after the loaded ones
+    if newSymbolicExpression(bv(1, 8)).getId() != max(before[0].keys()) + 1:
+        print '[KO] newSymbolicExpression()'
+        return -1
+    count += 1
+
+    # A bvadd with no childs is rejected by the check, one with a wrong size while it is rebuilt.
+    # The current state is kept in both cases.
+    current = state()
+    with open(filename, 'rb') as f:
+        saved = f.read()
+    for field, value in [(8, 0), (4, 7)]:
+        data = bytearray(saved)
+        offset, number = struct.unpack_from('<QQ', data, 40)
+        for index in range(number):
+            if struct.unpack_from('<I', data, offset + index * 32)[0] == AST_NODE.BVADD:
+                struct.pack_into('<I', data, offset + index * 32 + field, value)
+                break
+        with open(filename, 'wb') as f:
+            f.write(data)
+        try:
+            loadSymbolicState(filename)
+            print '[KO] loadSymbolicState()'
+            return -1
+        except TypeError:
+            pass
+        if state() != current:
+            print '[KO] %s' %(str(state()))
+            return -1
+        count += 1
+
+    # Ids from the next ids of the header, and registers or memory assigned to an expression
+    # which is not in the file, are rejected by the check as well
+    for section, field, value in [(24, None, 1),             # next expression id
+                                  (32, None, 0),             # next variable id
+                                  (136, 8, 0xffffffff),      # expression of the first register
+                                  (152, 8, 0xffffffff)]:     # expression of the first memory cell
+        data = bytearray(saved)
+        if field is None:
+            struct.pack_into('<Q', data, section, value)
+        else:
+            offset = struct.unpack_from('<Q', data, section)[0]
+            struct.pack_into('<Q', data, offset + field, value)
+        with open(filename, 'wb') as f:
+            f.write(data)
+        try:
+            loadSymbolicState(filename)
+            print '[KO] loadSymbolicState(): %d' %(section)
+            return -1
+        except TypeError:
+            pass
+        if state() != current:
+            print '[KO] %s' %(str(state()))
+            return -1
+        count += 1
+
+    with open(filename, 'r+b') as f:
+        f.write('XXXXXXXX')
+    try:
+        loadSymbolicState(filename)
+        print '[KO] loadSymbolicState()'
+        return -1
+    except TypeError:
+        count += 1
+    os.remove(filename)
+
+    return count
+
+
+def test_22():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    # More ids than one chunk of the id tables
+    for i in range(5000):
+        newSymbolicExpression(bv(i, 16))
+    newSymbolicVariable(8)
+
+    exprs = getSymbolicExpressions()
+    if len(exprs) != 5000 or sorted(exprs.keys()) != range(5000):
+        print '[KO] getSymbolicExpressions()'
+        return -1
+    count += 1
+
+    if getSymbolicExpressionFromId(4097).getAst().evaluate() != 4097 or not isSymbolicExpressionIdExists(4999) or isSymbolicExpressionIdExists(5000):
+        print '[KO] getSymbolicExpressionFromId()'
+        return -1
+    count += 1
+
+    try:
+        getSymbolicExpressionFromId(10000)
+        print '[KO] getSymbolicExpressionFromId(10000)'
+        return -1
+    except TypeError:
+        count += 1
+
+    if len(getSymbolicVariables()) != 1 or getSymbolicVariableFromId(0) is None:
+        print '[KO] getSymbolicVariables()'
+        return -1
+    count += 1
+
+    return count
+
+
+def test_23():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    # 16 bytes across the 0x10000 page boundary
+    setLastMemoryAreaValue(0xfff8, range(16))
+    convertMemoryToSymbolicVariable(Memory(0xfff8, 8, 0x0706050403020100))
+    convertMemoryToSymbolicVariable(Memory(0x10000, 8, 0x0f0e0d0c0b0a0908))
+
+    if sorted(getSymbolicMemory().keys()) != range(0xfff8, 0x10008):
+        print '[KO] getSymbolicMemory()'
+        return -1
+    count += 1
+
+    if getSymbolicMemoryValue(Memory(0xfffc, 8, 0)) != 0x0b0a090807060504:
+        print '[KO] getSymbolicMemoryValue()'
+        return -1
+    count += 1
+
+    concretizeMemory(Memory(0xfffc, 8, 0))
+    ids = [getSymbolicMemoryId(addr) != SYMEXPR.UNSET for addr in range(0xfff8, 0x10008)]
+    if ids != [True] * 4 + [False] * 8 + [True] * 4:
+        print '[KO] concretizeMemory() %s' %(ids)
+        return -1
+    count += 1
+
+    concretizeMemory(0x10004)
+    if len(getSymbolicMemory()) != 7 or getSymbolicMemoryId(0x20000) != SYMEXPR.UNSET:
+        print '[KO] concretizeMemory(0x10004)'
+        return -1
+    count += 1
+
+    return count
+
+
+def test_24():
+    setArchitecture(ARCH.X86_64)
+    enableSymbolicOptimization(OPTIMIZATION.ALIGNED_MEMORY, True)
+    count = 0
+
+    setLastRegisterValue(Register(REG.RAX, 0x1111111111111111))
+    setLastRegisterValue(Register(REG.RBX, 0x2222222222222222))
+    setLastRegisterValue(Register(REG.RSP, 0x1000))
+    convertRegisterToSymbolicVariable(REG.RAX)
+    convertRegisterToSymbolicVariable(REG.RBX)
+
+    # The second store overlaps the start of the first one
+    tests = [
+        ("\x48\x89\x04\x24",     None),               # mov qword ptr [rsp], rax
+        ("\x48\x89\x5c\x24\xfc", None),               # mov qword ptr [rsp-4], rbx
+        ("\x48\x8b\x0c\x24",     0x1111111122222222), # mov rcx, qword ptr [rsp]
+        ("\x48\x8b\x54\x24\xfc", 0x2222222222222222), # mov rdx, qword ptr [rsp-4]
+    ]
+    for opcodes, value in tests:
+        inst = Instruction()
+        inst.setOpcodes(opcodes)
+        processing(inst)
+        if value is None:
+            continue
+        node = inst.getLoadAccess()[0][1]
+        if node.evaluate() != value:
+            print '[KO] %s: %x' %(inst, node.evaluate())
+            enableSymbolicOptimization(OPTIMIZATION.ALIGNED_MEMORY, False)
+            return -1
+        count += 1
+
+    enableSymbolicOptimization(OPTIMIZATION.ALIGNED_MEMORY, False)
+    return count
+
+
+def test_25():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    setLastRegisterValue(Register(REG.RSP, 0x1000))
+    convertRegisterToSymbolicVariable(REG.RAX)
+
+    inst = Instruction()
+    inst.setOpcodes("\x48\x89\x04\x24") # mov qword ptr [rsp], rax
+    processing(inst)
+
+    # The expression of rax backs rax only, the bytes of the store are not touched
+    removeSymbolicExpression(getSymbolicRegisterId(REG.RAX))
+    if getSymbolicRegisterId(REG.RAX) != SYMEXPR.UNSET or len(getSymbolicMemory()) != 8:
+        print '[KO] removeSymbolicExpression(rax)'
+        return -1
+    count += 1
+
+    # Every byte is concretized, not only the first one found
+    for addr in range(0x1000, 0x1008):
+        removeSymbolicExpression(getSymbolicMemoryId(addr))
+    if len(getSymbolicMemory()) != 0:
+        print '[KO] removeSymbolicExpression(mem)'
+        return -1
+    count += 1
+
+    # An id whose location was overwritten does not concretize the new owner
+    convertRegisterToSymbolicVariable(REG.RBX)
+    old = getSymbolicRegisterId(REG.RBX)
+    convertRegisterToSymbolicVariable(REG.RCX)
+    inst = Instruction()
+    inst.setOpcodes("\x48\x89\xcb") # mov rbx, rcx
+    processing(inst)
+    removeSymbolicExpression(old)
+    if getSymbolicRegisterId(REG.RBX) == SYMEXPR.UNSET or isSymbolicExpressionIdExists(old):
+        print '[KO] removeSymbolicExpression(old)'
+        return -1
+    count += 1
+
+    return count
+
+
+def test_26():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    for i in range(1000):
+        newSymbolicVariable(8)
+
+    if getSymbolicVariableFromName('SymVar_777').getId() != 777:
+        print '[KO] getSymbolicVariableFromName(SymVar_777)'
+        return -1
+    count += 1
+
+    for name in ['SymVar_', 'SymVar_7x', 'SymVar_1000', 'symvar_7', 'foo']:
+        try:
+            getSymbolicVariableFromName(name)
+            print '[KO] getSymbolicVariableFromName(%s)' %(name)
+            return -1
+        except TypeError:
+            count += 1
+
+    # The variable nodes are converted by id
+    setLastRegisterValue(Register(REG.RAX, 0x1234))
+    symVar = convertRegisterToSymbolicVariable(REG.RAX)
+    node   = bvadd(extract(7, 0, variable(symVar)), variable(getSymbolicVariableFromId(777)))
+    if evaluateAstViaZ3(node) != node.evaluate():
+        print '[KO] evaluateAstViaZ3(%s)' %(node)
+        return -1
+    count += 1
+
+    return count
+
+
+def test_27():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    setLastRegisterValue(Register(REG.RAX, 0x10))
+    convertRegisterToSymbolicVariable(REG.RAX)
+
+    inst = Instruction()
+    inst.setOpcodes("\x48\x83\xc0\x01") # add rax, 1
+    processing(inst)
+    pinned = getSymbolicRegisterId(REG.ZF)
+    pinSymbolicExpression(pinned)
+
+    # The first instruction is kept, the Python objects of the expressions of the 6th one as well
+    first = inst
+    for i in range(20):
+        inst = Instruction()
+        inst.setOpcodes("\x48\x83\xc0\x01") # add rax, 1
+        processing(inst)
+        if i == 5:
+            held = inst.getSymbolicExpressions()
+
+    def semantics():
+        exprs = first.getSymbolicExpressions() + held
+        return [e.getId() for e in exprs], [(str(e.getAst()), e.getAst().evaluate()) for e in exprs]
+
+    # The overwritten flags are dead, rax and its chain of references are live
+    ids, asts = semantics()
+    before = len(getSymbolicExpressions())
+    if collectSymbolicExpressions() == 0 or len(getSymbolicExpressions()) >= before:
+        print '[KO] collectSymbolicExpressions()'
+        return -1
+    count += 1
+
+    # The collected expressions stay alive while an instruction or a Python object holds them
+    if semantics() != (ids, asts) or all([isSymbolicExpressionIdExists(i) for i in ids]):
+        print '[KO] Instruction.getSymbolicExpressions() after collectSymbolicExpressions()'
+        return -1
+    count += 1
+
+    rax = getFullAstFromId(getSymbolicRegisterId(REG.RAX))
+    if rax.evaluate() != 0x10 + 21 or not rax.isSymbolized():
+        print '[KO] getFullAstFromId(rax)'
+        return -1
+    count += 1
+
+    if not isSymbolicExpressionIdExists(pinned):
+        print '[KO] pinSymbolicExpression()'
+        return -1
+    count += 1
+
+    unpinSymbolicExpression(pinned)
+    collectSymbolicExpressions()
+    if isSymbolicExpressionIdExists(pinned):
+        print '[KO] unpinSymbolicExpression()'
+        return -1
+    count += 1
+
+    # The automatic collections bound the expressions by the live ones
+    setSymbolicGarbageCollectionThreshold(50)
+    for i in range(300):
+        inst = Instruction()
+        inst.setOpcodes("\x48\x83\xc0\x01") # add rax, 1
+        processing(inst)
+
+    if len(getSymbolicExpressions()) >= 1000:
+        print '[KO] setSymbolicGarbageCollectionThreshold()'
+        return -1
+    count += 1
+
+    for expr in inst.getSymbolicExpressions():
+        if not isSymbolicExpressionIdExists(expr.getId()):
+            print '[KO] processing(%s)' %(inst)
+            return -1
+    count += 1
+
+    if getFullAstFromId(getSymbolicRegisterId(REG.RAX)).evaluate() != 0x10 + 321:
+        print '[KO] getFullAstFromId(rax)'
+        return -1
+    count += 1
+
+    return count
+
+
+def test_28():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    rbx = convertRegisterToSymbolicVariable(REG.RBX)
+    rcx = convertRegisterToSymbolicVariable(REG.RCX)
+
+    code = [
+        (0x1000, "\x48\x89\xd8"),     # mov rax, rbx
+        (0x1003, "\x48\x83\xc0\x01"), # add rax, 1
+        (0x1007, "\x48\x89\xca"),     # mov rdx, rcx
+        (0x100a, "\x48\x83\xf8\x05"), # cmp rax, 5
+        (0x100e, "\x74\x00"),         # je 0x1010
+    ]
+    for addr, opcodes in code:
+        inst = Instruction()
+        inst.setAddress(addr)
+        inst.setOpcodes(opcodes)
+        processing(inst)
+
+    raxId = getSymbolicRegisterId(REG.RAX)
+    rax   = getBackwardSlice(raxId)
+    if rax['addresses'] != [0x1000, 0x1003] or rax['variables'] != [rbx.getId()] or raxId not in rax['expressions']:
+        print '[KO] getBackwardSlice(rax)'
+        return -1
+    count += 1
+
+    rdx = getBackwardSlice(getSymbolicRegisterId(REG.RDX))
+    if rdx['addresses'] != [0x1007] or rdx['variables'] != [rcx.getId()]:
+        print '[KO] getBackwardSlice(rdx)'
+        return -1
+    count += 1
+
+    # The slice of an AST does not hold the expression of the AST
+    node = getBackwardSlice(getAstFromId(raxId))
+    if node['expressions'] != [i for i in rax['expressions'] if i != raxId]:
+        print '[KO] getBackwardSlice(node)'
+        return -1
+    count += 1
+
+    slices = getPathConstraintsBackwardSlices()
+    if len(slices) != len(getPathConstraints()) or len(slices) == 0:
+        print '[KO] getPathConstraintsBackwardSlices()'
+        return -1
+    count += 1
+
+    pc = slices[-1]
+    if not set([0x1000, 0x1003, 0x100a]).issubset(pc['addresses']) or 0x1007 in pc['addresses'] or pc['variables'] != [rbx.getId()]:
+        print '[KO] getPathConstraintsBackwardSlices()[-1]'
+        return -1
+    count += 1
+
+    if pc != getBackwardSlice(getPathConstraints()[-1].getTakenPathConstraintAst()):
+        print '[KO] getBackwardSlice(pc)'
+        return -1
+    count += 1
+
+    # A load depends on the store, even from an instruction at address 0
+    setLastRegisterValue(Register(REG.RSP, 0x2000))
+    code = [
+        (0x0,    "\x48\x89\x1c\x24"), # mov qword ptr [rsp], rbx
+        (0x1010, "\x48\x8b\x34\x24"), # mov rsi, qword ptr [rsp]
+    ]
+    for addr, opcodes in code:
+        inst = Instruction()
+        inst.setAddress(addr)
+        inst.setOpcodes(opcodes)
+        processing(inst)
+
+    rsi = getBackwardSlice(getSymbolicRegisterId(REG.RSI))
+    if rsi['addresses'] != [0x0, 0x1010] or rsi['variables'] != [rbx.getId()]:
+        print '[KO] getBackwardSlice(rsi)'
+        return -1
+    count += 1
+
+    if newSymbolicExpression(bv(0, 8)).hasAddress() or not inst.getSymbolicExpressions()[0].hasAddress():
+        print '[KO] hasAddress()'
+        return -1
+    count += 1
+
+    return count
+
+
+def test_29():
+    setArchitecture(ARCH.X86_64)
+    count = 0
+
+    setLastRegisterValue(Register(REG.RAX, 0x10))
+    convertRegisterToSymbolicVariable(REG.RAX)
+
+    inst = Instruction()
+    inst.setOpcodes("\x48\x83\xc0\x01") # add rax, 1
+    processing(inst)
+
+    raxId = getSymbolicRegisterId(REG.RAX)
+    exprs = len(getSymbolicExpressions())
+
+    # Without the symbolic engine, the symbolic state is backed up and restored around each instruction
+    enableSymbolicEngine(False)
+    taintRegister(REG.RAX)
+    for i in range(10):
+        inst = Instruction()
+        inst.setOpcodes("\x48\x01\xc3") # add rbx, rax
+        processing(inst)
+
+    if getSymbolicRegisterId(REG.RAX) != raxId or getSymbolicRegisterId(REG.RBX) != SYMEXPR.UNSET or len(getSymbolicExpressions()) != exprs:
+        print '[KO] restoreSymbolicEngine()'
+        return -1
+    count += 1
+
+    if not isRegisterTainted(REG.RBX):
+        print '[KO] isRegisterTainted(rbx)'
+        return -1
+    count += 1
+
+    # The engine restored still owns its expressions
+    enableSymbolicEngine(True)
+    inst = Instruction()
+    inst.setOpcodes("\x48\x83\xc0\x01") # add rax, 1
+    processing(inst)
+    if getFullAstFromId(getSymbolicRegisterId(REG.RAX)).evaluate() != 0x12 or len(getSymbolicExpressions()) <= exprs:
+        print '[KO] getFullAstFromId(rax)'
+        return -1
+    count += 1
+
+    return count
+
+
+def test_30():
+    setArchitecture(ARCH.X86_64)
+    enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, True)
+    enableSymbolicOptimization(OPTIMIZATION.ALIGNED_MEMORY, True)
+    count = 0
+
+    setLastRegisterValue(Register(REG.RAX, 0x1122334455667788))
+    setLastRegisterValue(Register(REG.RSP, 0x1000))
+    convertRegisterToSymbolicVariable(REG.RAX)
+
+    freeAllAstNodes()
+    inst = Instruction()
+    inst.setOpcodes("\x48\x89\x04\x24") # mov qword ptr [rsp], rax
+    processing(inst)
+
+    # The nodes of the instruction owned by nothing are freed by processing(), the address AST is owned by its operand
+    before = getNumberOfAllocatedAstNodes()
+    freeAllAstNodes()
+    if getNumberOfAllocatedAstNodes() != before or inst.getOperands()[0].getLeaAst().evaluate() != 0x1000:
+        print '[KO] freeAllAstNodes(): %d nodes instead of %d' %(getNumberOfAllocatedAstNodes(), before)
+        enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, False)
+        enableSymbolicOptimization(OPTIMIZATION.ALIGNED_MEMORY, False)
+        return -1
+    count += 1
+
+    # The AST of the store is held by the aligned memory and read back as is
+    inst = Instruction()
+    inst.setOpcodes("\x48\x8b\x0c\x24") # mov rcx, qword ptr [rsp]
+    processing(inst)
+    node = inst.getLoadAccess()[0][1]
+    if node.evaluate() != 0x1122334455667788 or not node.isSymbolized():
+        print '[KO] %s' %(node)
+        enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, False)
+        enableSymbolicOptimization(OPTIMIZATION.ALIGNED_MEMORY, False)
+        return -1
+    count += 1
+
+    if getFullAstFromId(getSymbolicRegisterId(REG.RCX)).evaluate() != 0x1122334455667788:
+        print '[KO] getFullAstFromId(rcx)'
+        enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, False)
+        enableSymbolicOptimization(OPTIMIZATION.ALIGNED_MEMORY, False)
+        return -1
+    count += 1
+
+    enableSymbolicOptimization(OPTIMIZATION.AST_DICTIONARIES, False)
+    enableSymbolicOptimization(OPTIMIZATION.ALIGNED_MEMORY, False)
+    return count
+
+
+def test_31():
+    setArchitecture(ARCH.X86_64)
+    enableSymbolicOptimization(OPTIMIZATION.ONLY_ON_SYMBOLIZED, True)
+    count = 0
+
+    setLastRegisterValue(Register(REG.RSP, 0x1000))
+
+    # A concrete loop keeps no expression, the number of nodes must not grow with the trace
+    counts = []
+    for i in range(1000):
+        for opcodes in ["\x48\x83\xc0\x01",        # add rax, 1
+                        "\x48\x89\x44\x24\x08",    # mov qword ptr [rsp+8], rax
+                        "\x48\x8b\x4c\x24\x08"]:   # mov rcx, qword ptr [rsp+8]
+            inst = Instruction()
+            inst.setOpcodes(opcodes)
+            processing(inst)
+        if i == 100 or i == 999:
+            counts.append(getNumberOfAllocatedAstNodes())
+
+    if counts[1] != counts[0]:
+        print '[KO] getNumberOfAllocatedAstNodes(): %d nodes after 100 iterations, %d after 1000' %(counts[0], counts[1])
+        enableSymbolicOptimization(OPTIMIZATION.ONLY_ON_SYMBOLIZED, False)
+        return -1
+    count += 1
+
+    # The solver frees the unrolled copy of the AST it queries
+    x = newSymbolicExpression(variable(newSymbolicVariable(8)))
+    y = newSymbolicExpression(bvadd(reference(x.getId()), bv(1, 8)))
+    query = equal(reference(y.getId()), bv(2, 8))
+    before = getNumberOfAllocatedAstNodes()
+    for i in range(10):
+        getModel(query)
+    if getNumberOfAllocatedAstNodes() != before:
+        print '[KO] getModel(): %d nodes instead of %d' %(getNumberOfAllocatedAstNodes(), before)
+        enableSymbolicOptimization(OPTIMIZATION.ONLY_ON_SYMBOLIZED, False)
+        return -1
+    count += 1
+
+    enableSymbolicOptimization(OPTIMIZATION.ONLY_ON_SYMBOLIZED, False)
+    return count
+
 
 units_testing = [
     ("Testing the arithmetic and logic AST interpreter", test_1),
@@ -1547,6 +2768,31 @@ units_testing = [
     ("Testing the ImmediateOperand class", test_4),
     ("Testing the Instruction class", test_5),
     ("Testing the architectures", test_6),
+    ("Testing the lazy AST evaluation", test_7),
+    ("Testing the AST structural hash", test_8),
+    ("Testing the AST dictionaries", test_9),
+    ("Testing the compact AST node layout", test_10),
+    ("Testing the AST reference counts", test_11),
+    ("Testing the full AST unrolling", test_12),
+    ("Testing the iterative AST traversal", test_13),
+    ("Testing the AST evaluation tape", test_14),
+    ("Testing the AST batch evaluation", test_15),
+    ("Testing the constant folding of the AST builders", test_16),
+    ("Testing the AST rewrite rules", test_17),
+    ("Testing the collapse of the byte-split memory reads", test_18),
+    ("Testing the AST statistics", test_19),
+    ("Testing the shared SMT representation", test_20),
+    ("Testing the serialization of the symbolic state", test_21),
+    ("Testing the id tables of the symbolic engine", test_22),
+    ("Testing the paged symbolic memory references", test_23),
+    ("Testing the invalidation of the aligned memory", test_24),
+    ("Testing the removal of the symbolic expressions", test_25),
+    ("Testing the lookups of the symbolic variables", test_26),
+    ("Testing the collection of the dead symbolic expressions", test_27),
+    ("Testing the backward slices", test_28),
+    ("Testing the copy-on-write backups of the symbolic engine", test_29),
+    ("Testing the free of the AST nodes owned by nothing", test_30),
+    ("Testing the free of the AST nodes built by the instructions", test_31),
 ]
 
 
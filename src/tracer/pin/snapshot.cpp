@@ -41,10 +41,12 @@ namespace tracer {
   namespace pintool {
 
       Snapshot::Snapshot() {
+        this->cpu                 = nullptr;
         this->locked              = true;
         this->snapshotTaintEngine = nullptr;
         this->snapshotSymEngine   = nullptr;
         this->mustBeRestore       = false;
+        this->nodesRegion         = 0;
       }
 
 
@@ -61,22 +63,27 @@ namespace tracer {
 
       /* Enable the snapshot engine. */
       void Snapshot::takeSnapshot(CONTEXT *ctx) {
-        /* 1 - Unlock the engine */
+        /* 1 - Drop the previous snapshot, if any */
+        this->resetEngine();
+
+        /* 2 - Unlock the engine */
         this->locked = false;
 
-        /* 2 - Save current symbolic engine state */
+        /* 3 - Save current symbolic engine state */
         this->snapshotSymEngine = new triton::engines::symbolic::SymbolicEngine(*triton::api.getSymbolicEngine());
 
-        /* 3 - Save current taint engine state */
+        /* 4 - Save current taint engine state */
         this->snapshotTaintEngine = new triton::engines::taint::TaintEngine(*triton::api.getTaintEngine());
 
-        /* 4 - Save current set of nodes */
-        this->nodesList = triton::api.getAllocatedAstNodes();
+        /* 5 - Save current AST region */
+        this->nodesRegion = triton::api.markAstRegion();
 
-        /* 5 - Save current map of variables */
+        /* 6 - Save current map of variables */
         this->variablesMap = triton::api.getAstVariableNodes();
+        for (auto i = this->variablesMap.begin(); i != this->variablesMap.end(); ++i)
+          triton::api.retainAstNode(i->second);
 
-        /* 6 - Save the Triton CPU state */
+        /* 7 - Save the Triton CPU state */
         #if defined(__x86_64__) || defined(_M_X64)
         this->cpu = new triton::arch::x86::x8664Cpu(*reinterpret_cast<triton::arch::x86::x8664Cpu*>(triton::api.getCpu()));
         #endif
@@ -84,7 +91,7 @@ namespace tracer {
         this->cpu = new triton::arch::x86::x86Cpu(*reinterpret_cast<triton::arch::x86::x86Cpu*>(triton::api.getCpu()));
         #endif
 
-        /* 7 - Save Pin registers context */
+        /* 8 - Save Pin registers context */
         PIN_SaveContext(ctx, &this->pinCtx);
       }
 
@@ -101,39 +108,19 @@ namespace tracer {
         }
         this->memory.clear();
 
-        /* 2 - Delete unused expressions */
-        auto currentExpressions     = triton::api.getSymbolicExpressions();
-        auto snapshotExpressions    = this->snapshotSymEngine->getSymbolicExpressions();
-        triton::__uint currentSize  = currentExpressions.size();
-        triton::__uint snapshotSize = snapshotExpressions.size();
-        for (auto i = currentExpressions.begin(); i != currentExpressions.end(); ++i) {
-          if (snapshotExpressions.find(i->first) == snapshotExpressions.end())
-            delete currentExpressions[i->first];
-        }
-
-        /* 3 - Delete unused variables */
-        auto currentSymbolicVars   = triton::api.getSymbolicVariables();
-        auto snapshotSymbolicVars  = this->snapshotSymEngine->getSymbolicVariables();
-        currentSize                = currentSymbolicVars.size();
-        snapshotSize               = snapshotSymbolicVars.size();
-        for (auto i = currentSymbolicVars.begin(); i != currentSymbolicVars.end(); ++i) {
-          if (snapshotSymbolicVars.find(i->first) == snapshotSymbolicVars.end())
-            delete currentSymbolicVars[i->first];
-        }
-
-        /* 4 - Restore current symbolic engine state */
+        /* 2 - Restore current symbolic engine state, the expressions created since the snapshot are deleted */
         *triton::api.getSymbolicEngine() = *this->snapshotSymEngine;
 
-        /* 5 - Restore current taint engine state */
+        /* 3 - Restore current taint engine state */
         *triton::api.getTaintEngine() = *this->snapshotTaintEngine;
 
-        /* 6 - Restore current AST node state */
-        triton::api.setAllocatedAstNodes(this->nodesList);
+        /* 4 - Restore current AST node state */
+        triton::api.freeAstRegion(this->nodesRegion);
 
-        /* 7 - Restore current variables map state */
+        /* 5 - Restore current variables map state */
         triton::api.setAstVariableNodes(this->variablesMap);
 
-        /* 8 - Restore the Triton CPU state */
+        /* 6 - Restore the Triton CPU state */
         #if defined(__x86_64__) || defined(_M_X64)
         *reinterpret_cast<triton::arch::x86::x8664Cpu*>(triton::api.getCpu()) = *this->cpu;
         #endif
@@ -141,7 +128,7 @@ namespace tracer {
         *reinterpret_cast<triton::arch::x86::x86Cpu*>(triton::api.getCpu()) = *this->cpu;
         #endif
 
-        /* 9 - Restore Pin registers context */
+        /* 7 - Restore Pin registers context */
         PIN_SaveContext(&this->pinCtx, ctx);
 
         this->mustBeRestore = false;
@@ -161,11 +148,18 @@ namespace tracer {
       void Snapshot::resetEngine(void) {
         this->memory.clear();
 
+        for (auto i = this->variablesMap.begin(); i != this->variablesMap.end(); ++i)
+          triton::api.releaseAstNode(i->second);
+        this->variablesMap.clear();
+
         delete this->snapshotSymEngine;
         this->snapshotSymEngine = nullptr;
 
         delete this->snapshotTaintEngine;
         this->snapshotTaintEngine = nullptr;
+
+        delete this->cpu;
+        this->cpu = nullptr;
       }
 
 
@@ -51,8 +51,8 @@ namespace tracer {
         //! Flag which defines if we must restore the snapshot.
         bool mustBeRestore;
 
-        //! AST node state.
-        std::set<triton::ast::AbstractNode*> nodesList;
+        //! AST node state. Every node recorded after this region mark is freed on restore.
+        triton::__uint nodesRegion;
 
         //! Variables node state.
         std::map<std::string, triton::ast::AbstractNode*> variablesMap;